@@ -28,6 +28,7 @@ function(open3d_print_configuration_summary)
         open3d_aligned_print("SYCL unified shared memory" "${ENABLE_SYCL_UNIFIED_SHARED_MEMORY}")
     endif()
     open3d_aligned_print("ISPC Support" "${BUILD_ISPC_MODULE}")
+    open3d_aligned_print("Profiler" "${ENABLE_PROFILER}")
     open3d_aligned_print("Build GUI" "${BUILD_GUI}")
     open3d_aligned_print("Build WebRTC visualizer" "${BUILD_WEBRTC}")
     open3d_aligned_print("Build Shared Library" "${BUILD_SHARED_LIBS}")
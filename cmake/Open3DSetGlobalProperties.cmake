@@ -121,6 +121,9 @@ function(open3d_set_global_properties target)
     if (WITH_IPPICV)
         target_compile_definitions(${target} PRIVATE WITH_IPPICV)
     endif()
+    if (ENABLE_PROFILER)
+        target_compile_definitions(${target} PRIVATE ENABLE_PROFILER)
+    endif()
     if (GLIBCXX_USE_CXX11_ABI)
         target_compile_definitions(${target} PUBLIC _GLIBCXX_USE_CXX11_ABI=1)
     else()
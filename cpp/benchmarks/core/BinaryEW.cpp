@@ -120,6 +120,53 @@ void BinaryEW(benchmark::State& state,
     }
 }
 
+/// Memory layouts of the operands for the element-wise fast paths.
+enum class Layout {
+    /// Both operands are contiguous.
+    Contiguous,
+    /// Both operands are views with a stride of 2.
+    Strided,
+    /// The rhs is a single element broadcasted to the lhs.
+    ScalarBroadcast,
+};
+
+void BinaryEWLayout(benchmark::State& state,
+                    int size,
+                    BinaryOpCode op_code,
+                    Layout layout,
+                    const Dtype& dtype,
+                    const Device& device) {
+    Tensor lhs;
+    Tensor rhs;
+    switch (layout) {
+        case Layout::Contiguous:
+            lhs = benchmarks::Rand({1, size}, 1, {1, 127}, dtype, device);
+            rhs = benchmarks::Rand({1, size}, 2, {1, 127}, dtype, device);
+            break;
+        case Layout::Strided:
+            lhs = benchmarks::Rand({1, 2 * size}, 1, {1, 127}, dtype, device)
+                          .Slice(1, 0, 2 * size, 2);
+            rhs = benchmarks::Rand({1, 2 * size}, 2, {1, 127}, dtype, device)
+                          .Slice(1, 0, 2 * size, 2);
+            break;
+        case Layout::ScalarBroadcast:
+            lhs = benchmarks::Rand({1, size}, 1, {1, 127}, dtype, device);
+            rhs = benchmarks::Rand({1, 1}, 2, {1, 127}, dtype, device);
+            break;
+    }
+    auto op = MakeOperation(op_code);
+
+    Tensor result = op(lhs, rhs);
+    benchmark::DoNotOptimize(result);
+
+    for (auto _ : state) {
+        Tensor result = op(lhs, rhs);
+        benchmark::DoNotOptimize(result);
+
+        cuda::Synchronize(device);
+    }
+}
+
 #define ENUM_BM_SIZE(FN, OP, DEVICE, DEVICE_NAME, DTYPE)                   \
     BENCHMARK_CAPTURE(FN, OP##__##DEVICE_NAME##_##DTYPE##__100, 100,       \
                       BinaryOpCode::OP, DTYPE, DEVICE)                     \
@@ -187,5 +234,26 @@ ENUM_BM_TENSOR_WTIH_BOOL(BinaryEW, Le)
 ENUM_BM_TENSOR_WTIH_BOOL(BinaryEW, Eq)
 ENUM_BM_TENSOR_WTIH_BOOL(BinaryEW, Neq)
 
+#define ENUM_BM_LAYOUT(FN, OP, DTYPE, LAYOUT)                             \
+    BENCHMARK_CAPTURE(FN, OP##__CPU_##DTYPE##_##LAYOUT##__100000, 100000, \
+                      BinaryOpCode::OP, Layout::LAYOUT, DTYPE,            \
+                      Device("CPU:0"))                                    \
+            ->Unit(benchmark::kMillisecond);                              \
+    BENCHMARK_CAPTURE(FN, OP##__CPU_##DTYPE##_##LAYOUT##__10000000,       \
+                      10000000, BinaryOpCode::OP, Layout::LAYOUT, DTYPE,  \
+                      Device("CPU:0"))                                    \
+            ->Unit(benchmark::kMillisecond);
+
+#define ENUM_BM_LAYOUTS(FN, OP, DTYPE)        \
+    ENUM_BM_LAYOUT(FN, OP, DTYPE, Contiguous) \
+    ENUM_BM_LAYOUT(FN, OP, DTYPE, Strided)    \
+    ENUM_BM_LAYOUT(FN, OP, DTYPE, ScalarBroadcast)
+
+ENUM_BM_LAYOUTS(BinaryEWLayout, Add, Float32)
+ENUM_BM_LAYOUTS(BinaryEWLayout, Add, Int32)
+ENUM_BM_LAYOUTS(BinaryEWLayout, Mul, Float64)
+ENUM_BM_LAYOUTS(BinaryEWLayout, Gt, Float32)
+ENUM_BM_LAYOUTS(BinaryEWLayout, LogicalAnd, Bool)
+
 }  // namespace core
 }  // namespace open3d
@@ -9,6 +9,7 @@
 
 #include <benchmark/benchmark.h>
 
+#include <algorithm>
 #include <numeric>
 #include <random>
 
@@ -18,7 +19,9 @@
 #include "open3d/core/MemoryManager.h"
 #include "open3d/core/SizeVector.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/core/hashmap/HashMultiMap.h"
 #include "open3d/core/kernel/Kernel.h"
+#include "open3d/utility/Timer.h"
 
 namespace open3d {
 namespace core {
@@ -375,6 +378,31 @@ void HashFindInt3(benchmark::State& state,
     }
 }
 
+void HashActiveIndicesInt3(benchmark::State& state,
+                           int capacity,
+                           int duplicate_factor,
+                           const Device& device,
+                           const HashBackendType& backend) {
+    int slots = std::max(1, capacity / duplicate_factor);
+    HashData<Int3, int> data(capacity, slots);
+
+    std::vector<int> keys_Int3;
+    keys_Int3.assign(reinterpret_cast<int*>(data.keys_.data()),
+                     reinterpret_cast<int*>(data.keys_.data()) + 3 * capacity);
+    Tensor keys(keys_Int3, {capacity, 3}, core::Int32, device);
+    Tensor values(data.vals_, {capacity}, core::Int32, device);
+
+    HashMap hashmap(capacity, core::Int32, {3}, core::Int32, {1}, device,
+                    backend);
+    Tensor buf_indices, masks;
+    hashmap.Insert(keys, values, buf_indices, masks);
+
+    for (auto _ : state) {
+        hashmap.GetActiveIndices(buf_indices);
+        cuda::Synchronize(device);
+    }
+}
+
 void HashClearInt3(benchmark::State& state,
                    int capacity,
                    int duplicate_factor,
@@ -507,13 +535,15 @@ void HashReserveInt3(benchmark::State& state,
     ENUM_BM_CAPACITY(FN, 32, DEVICE, BACKEND)
 
 #ifdef BUILD_CUDA_MODULE
-#define ENUM_BM_BACKEND(FN)                                     \
-    ENUM_BM_FACTOR(FN, Device("CPU:0"), HashBackendType::TBB)   \
-    ENUM_BM_FACTOR(FN, Device("CUDA:0"), HashBackendType::Slab) \
+#define ENUM_BM_BACKEND(FN)                                              \
+    ENUM_BM_FACTOR(FN, Device("CPU:0"), HashBackendType::TBB)            \
+    ENUM_BM_FACTOR(FN, Device("CPU:0"), HashBackendType::OpenAddressing) \
+    ENUM_BM_FACTOR(FN, Device("CUDA:0"), HashBackendType::Slab)          \
     ENUM_BM_FACTOR(FN, Device("CUDA:0"), HashBackendType::StdGPU)
 #else
-#define ENUM_BM_BACKEND(FN) \
-    ENUM_BM_FACTOR(FN, Device("CPU:0"), HashBackendType::TBB)
+#define ENUM_BM_BACKEND(FN)                                              \
+    ENUM_BM_FACTOR(FN, Device("CPU:0"), HashBackendType::TBB)            \
+    ENUM_BM_FACTOR(FN, Device("CPU:0"), HashBackendType::OpenAddressing)
 #endif
 
 ENUM_BM_BACKEND(HashInsertInt)
@@ -522,10 +552,124 @@ ENUM_BM_BACKEND(HashEraseInt)
 ENUM_BM_BACKEND(HashEraseInt3)
 ENUM_BM_BACKEND(HashFindInt)
 ENUM_BM_BACKEND(HashFindInt3)
+ENUM_BM_BACKEND(HashActiveIndicesInt3)
 ENUM_BM_BACKEND(HashClearInt)
 ENUM_BM_BACKEND(HashClearInt3)
 ENUM_BM_BACKEND(HashReserveInt)
 ENUM_BM_BACKEND(HashReserveInt3)
 
+// Inserts batches of new keys into a hash map that starts small and grows
+// to many times its initial capacity, and reports the latency percentiles of
+// the insertions, e.g. of a map of voxel blocks extended frame by frame.
+void HashGrowingInsertInt3(benchmark::State& state,
+                           int batch_size,
+                           int num_batches,
+                           const Device& device,
+                           const HashBackendType& backend) {
+    const int count = batch_size * num_batches;
+    std::vector<int> keys_Int3(3 * count);
+    for (int i = 0; i < count; ++i) {
+        keys_Int3[3 * i + 0] = i % 1024;
+        keys_Int3[3 * i + 1] = (i / 1024) % 1024;
+        keys_Int3[3 * i + 2] = i / (1024 * 1024);
+    }
+    Tensor keys(keys_Int3, {count, 3}, core::Int32, device);
+    Tensor values = Tensor::Zeros({count}, core::Int32, device);
+
+    std::vector<double> latencies;
+    for (auto _ : state) {
+        HashMap hashmap(batch_size, core::Int32, {3}, core::Int32, {1}, device,
+                        backend);
+        Tensor buf_indices, masks;
+        for (int b = 0; b < num_batches; ++b) {
+            Tensor batch_keys = keys.Slice(0, b * batch_size,
+                                           (b + 1) * batch_size);
+            Tensor batch_values = values.Slice(0, b * batch_size,
+                                               (b + 1) * batch_size);
+            utility::Timer timer;
+            timer.Start();
+            hashmap.Insert(batch_keys, batch_values, buf_indices, masks);
+            cuda::Synchronize(device);
+            timer.Stop();
+            latencies.push_back(timer.GetDurationInMillisecond());
+        }
+
+        int64_t s = hashmap.Size();
+        if (s != count) {
+            utility::LogError(
+                    "Error returning hashmap size, expected {}, but got {}.",
+                    count, s);
+        }
+    }
+
+    std::sort(latencies.begin(), latencies.end());
+    auto percentile = [&](double p) {
+        return latencies[static_cast<size_t>(p * (latencies.size() - 1))];
+    };
+    state.counters["p50_ms"] = percentile(0.5);
+    state.counters["p99_ms"] = percentile(0.99);
+    state.counters["max_ms"] = latencies.back();
+}
+
+BENCHMARK_CAPTURE(HashGrowingInsertInt3,
+                  TBB_10000_200,
+                  10000,
+                  200,
+                  Device("CPU:0"),
+                  HashBackendType::TBB)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(HashGrowingInsertInt3,
+                  OpenAddressing_10000_200,
+                  10000,
+                  200,
+                  Device("CPU:0"),
+                  HashBackendType::OpenAddressing)
+        ->Unit(benchmark::kMillisecond);
+
+// Buckets the indices of random points into voxels with a HashMultiMap and
+// gathers the per-voxel lists, e.g. for grid-based neighbor queries.
+void HashMultiMapVoxelBuckets(benchmark::State& state,
+                              int num_points,
+                              int page_size,
+                              const Device& device,
+                              const HashBackendType& backend) {
+    std::vector<int> voxels(3 * num_points);
+    std::default_random_engine rng(0);
+    std::uniform_int_distribution<int> dist(0, 31);
+    for (auto& v : voxels) {
+        v = dist(rng);
+    }
+    Tensor keys(voxels, {num_points, 3}, core::Int32, device);
+    Tensor indices = Tensor::Arange(0, num_points, 1, core::Int64, device);
+
+    for (auto _ : state) {
+        HashMultiMap multimap(num_points / 8, core::Int32, {3}, core::Int64,
+                              {1}, device, page_size, backend);
+        multimap.Append(keys, indices);
+        Tensor active_keys = multimap.GetKeyTensor().IndexGet(
+                {multimap.GetActiveIndices().To(core::Int64)});
+        auto lists = multimap.Gather(active_keys);
+        if (lists.first[0].GetLength() != num_points) {
+            utility::LogError("Error gathering lists, expected {}, but got {}.",
+                              num_points, lists.first[0].GetLength());
+        }
+    }
+}
+
+BENCHMARK_CAPTURE(HashMultiMapVoxelBuckets,
+                  TBB_1000000_16,
+                  1000000,
+                  16,
+                  Device("CPU:0"),
+                  HashBackendType::TBB)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(HashMultiMapVoxelBuckets,
+                  OpenAddressing_1000000_16,
+                  1000000,
+                  16,
+                  Device("CPU:0"),
+                  HashBackendType::OpenAddressing)
+        ->Unit(benchmark::kMillisecond);
+
 }  // namespace core
 }  // namespace open3d
@@ -9,6 +9,10 @@
 
 #include "open3d/core/CUDAUtils.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/core/linalg/Batched.h"
+#include "open3d/core/linalg/Inverse.h"
+#include "open3d/core/linalg/SVD.h"
+#include "open3d/core/linalg/Solve.h"
 #include "open3d/utility/Logging.h"
 
 namespace open3d {
@@ -33,5 +37,75 @@ BENCHMARK_CAPTURE(MatmulAB, CUDA, Device("CUDA:0"))
         ->Unit(benchmark::kMillisecond);
 #endif
 
+enum class BatchedOp { Solve, Inverse, SVD };
+
+// Well-conditioned {batch_size, n, n} matrices and {batch_size, n} vectors.
+static std::pair<Tensor, Tensor> MakeBatch(int64_t batch_size, int64_t n) {
+    Tensor A = Tensor::Arange(0, batch_size * n * n, 1, core::Float64)
+                       .Sin()
+                       .Reshape({batch_size, n, n}) +
+               Tensor::Eye(n, core::Float64, Device("CPU:0")) * 2;
+    Tensor B = Tensor::Arange(0, batch_size * n, 1, core::Float64)
+                       .Cos()
+                       .Reshape({batch_size, n});
+    return std::make_pair(A, B);
+}
+
+// Batched fixed-size kernels, run in parallel across the batch.
+void Batched(benchmark::State& state, const BatchedOp& op) {
+    Tensor A, B;
+    std::tie(A, B) = MakeBatch(state.range(0), state.range(1));
+    Tensor X, U, S, VT;
+    for (auto _ : state) {
+        if (op == BatchedOp::Solve) {
+            BatchedSolve(A, B, X);
+        } else if (op == BatchedOp::Inverse) {
+            BatchedInverse(A, X);
+        } else {
+            BatchedSVD(A, U, S, VT);
+        }
+    }
+}
+
+// The LAPACK path called once per matrix.
+void LapackLoop(benchmark::State& state, const BatchedOp& op) {
+    const int64_t batch_size = state.range(0);
+    Tensor A, B;
+    std::tie(A, B) = MakeBatch(batch_size, state.range(1));
+    Tensor X, U, S, VT;
+    for (auto _ : state) {
+        for (int64_t i = 0; i < batch_size; ++i) {
+            if (op == BatchedOp::Solve) {
+                Solve(A[i], B[i], X);
+            } else if (op == BatchedOp::Inverse) {
+                Inverse(A[i], X);
+            } else {
+                SVD(A[i], U, S, VT);
+            }
+        }
+    }
+}
+
+// Batches of 3x3 systems, e.g. per-point covariances, and 6x6 systems, e.g.
+// per-node pose updates.
+BENCHMARK_CAPTURE(Batched, Solve, BatchedOp::Solve)
+        ->ArgsProduct({{1000, 100000}, {3, 6}})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(LapackLoop, Solve, BatchedOp::Solve)
+        ->ArgsProduct({{1000, 100000}, {3, 6}})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(Batched, Inverse, BatchedOp::Inverse)
+        ->ArgsProduct({{1000, 100000}, {3, 6}})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(LapackLoop, Inverse, BatchedOp::Inverse)
+        ->ArgsProduct({{1000, 100000}, {3, 6}})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(Batched, SVD, BatchedOp::SVD)
+        ->ArgsProduct({{1000, 100000}, {3}})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(LapackLoop, SVD, BatchedOp::SVD)
+        ->ArgsProduct({{1000, 100000}, {3}})
+        ->Unit(benchmark::kMillisecond);
+
 }  // namespace core
 }  // namespace open3d
@@ -10,12 +10,11 @@
 #include <benchmark/benchmark.h>
 
 #include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Tensor.h"
 
 namespace open3d {
 namespace core {
 
-enum class MemoryManagerBackend { Direct, Cached };
-
 std::shared_ptr<MemoryManagerDevice> MakeMemoryManager(
         const Device& device, const MemoryManagerBackend& backend) {
     std::shared_ptr<MemoryManagerDevice> device_mm;
@@ -139,5 +138,55 @@ void Free(benchmark::State& state,
 ENUM_BM_BACKEND(Malloc)
 ENUM_BM_BACKEND(Free)
 
+// Allocates and frees batches of differently sized blocks, similar to the
+// temporaries of an iterative pipeline.
+void MallocFreeChurn(benchmark::State& state,
+                     const MemoryManagerBackend& backend) {
+    Device device("CPU:0");
+    MemoryManagerCached::ReleaseCache(device);
+
+    auto device_mm = MakeMemoryManager(device, backend);
+
+    const std::vector<size_t> byte_sizes = {24,     96,      1200,   12000,
+                                            120000, 1200000, 3600000};
+    std::vector<void*> ptrs(byte_sizes.size());
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < byte_sizes.size(); ++i) {
+            ptrs[i] = device_mm->Malloc(byte_sizes[i], device);
+            static_cast<char*>(ptrs[i])[0] = 0;
+        }
+        for (size_t i = 0; i < byte_sizes.size(); ++i) {
+            device_mm->Free(ptrs[i], device);
+        }
+    }
+
+    MemoryManagerCached::ReleaseCache(device);
+}
+
+// Element-wise arithmetic on point-cloud sized tensors, which creates and
+// drops one temporary tensor per operation. Tensors use the CPU backend of the
+// process, run with OPEN3D_CPU_MEMORY_BACKEND=cached to compare the backends.
+void TensorTemporaries(benchmark::State& state) {
+    Device device("CPU:0");
+    Tensor a = Tensor::Ones({100000, 3}, Float32, device);
+    Tensor b = Tensor::Ones({100000, 3}, Float32, device);
+
+    for (auto _ : state) {
+        Tensor c = ((a - b) * a + b).Abs();
+        benchmark::DoNotOptimize(c.GetDataPtr());
+    }
+    state.SetLabel(MemoryManager::GetCPUBackend() ==
+                                   MemoryManagerBackend::Cached
+                           ? "Cached"
+                           : "Direct");
+}
+
+BENCHMARK_CAPTURE(MallocFreeChurn, Direct_CPU, MemoryManagerBackend::Direct)
+        ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(MallocFreeChurn, Cached_CPU, MemoryManagerBackend::Cached)
+        ->Unit(benchmark::kMicrosecond);
+BENCHMARK(TensorTemporaries)->Unit(benchmark::kMicrosecond);
+
 }  // namespace core
 }  // namespace open3d
@@ -0,0 +1,110 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/nns/NearestNeighborSearch.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/nns/HnswIndex.h"
+#include "open3d/core/nns/KnnIndex.h"
+#include "open3d/core/nns/NanoFlannIndex.h"
+
+namespace open3d {
+namespace core {
+
+enum class KnnBackend { BruteForce, NanoFlann, Hnsw };
+
+// Builds a knn index for random points and searches the neighbors of random
+// queries. The build is included in the timing, since NearestNeighborSearch
+// builds a new index for each dataset.
+void KnnSearch(benchmark::State& state,
+               int64_t num_points,
+               int64_t dim,
+               int knn,
+               const KnnBackend& backend) {
+    const int64_t num_queries = 10000;
+    std::default_random_engine rng(0);
+    std::uniform_real_distribution<float> dist(0, 1);
+    std::vector<float> points_vec(num_points * dim);
+    std::vector<float> queries_vec(num_queries * dim);
+    for (auto& v : points_vec) v = dist(rng);
+    for (auto& v : queries_vec) v = dist(rng);
+    Tensor points(points_vec, {num_points, dim}, core::Float32);
+    Tensor queries(queries_vec, {num_queries, dim}, core::Float32);
+
+    for (auto _ : state) {
+        std::unique_ptr<nns::NNSIndex> index;
+        if (backend == KnnBackend::BruteForce) {
+            index.reset(new nns::KnnIndex());
+        } else if (backend == KnnBackend::NanoFlann) {
+            index.reset(new nns::NanoFlannIndex());
+        } else {
+            index.reset(new nns::HnswIndex());
+        }
+        index->SetTensorData(points, core::Int32);
+        auto result = index->SearchKnn(queries, knn);
+        benchmark::DoNotOptimize(result.first.GetDataPtr());
+    }
+}
+
+#define ENUM_BM_KNN_BACKEND(NUM_POINTS, DIM, KNN)                              \
+    BENCHMARK_CAPTURE(KnnSearch, BruteForce_##NUM_POINTS##_##DIM##_##KNN,      \
+                      NUM_POINTS, DIM, KNN, KnnBackend::BruteForce)            \
+            ->Unit(benchmark::kMillisecond);                                   \
+    BENCHMARK_CAPTURE(KnnSearch, NanoFlann_##NUM_POINTS##_##DIM##_##KNN,       \
+                      NUM_POINTS, DIM, KNN, KnnBackend::NanoFlann)             \
+            ->Unit(benchmark::kMillisecond);                                   \
+    BENCHMARK_CAPTURE(KnnSearch, Hnsw_##NUM_POINTS##_##DIM##_##KNN,            \
+                      NUM_POINTS, DIM, KNN, KnnBackend::Hnsw)                  \
+            ->Unit(benchmark::kMillisecond);
+
+// 3-D points, e.g. point cloud normals and ICP correspondences.
+ENUM_BM_KNN_BACKEND(1000, 3, 16)
+ENUM_BM_KNN_BACKEND(2000, 3, 16)
+ENUM_BM_KNN_BACKEND(10000, 3, 16)
+ENUM_BM_KNN_BACKEND(100000, 3, 16)
+// High-dimensional features, e.g. 33-D FPFH feature matching.
+ENUM_BM_KNN_BACKEND(1000, 33, 1)
+ENUM_BM_KNN_BACKEND(10000, 33, 1)
+ENUM_BM_KNN_BACKEND(30000, 33, 1)
+ENUM_BM_KNN_BACKEND(100000, 33, 1)
+
+// Searches the neighbors of a slightly shifted copy of the dataset points, as
+// in a registration step, with and without sorting the queries by Morton code.
+// Like many point clouds, the random points are not stored in a spatially
+// coherent order.
+static void NanoFlannSortQueries(benchmark::State& state) {
+    const int64_t num_points = state.range(0);
+    const bool sort_queries = state.range(1) != 0;
+    std::default_random_engine rng(0);
+    std::uniform_real_distribution<float> dist(0, 1);
+    std::vector<float> points_vec(num_points * 3);
+    for (auto& v : points_vec) v = dist(rng);
+    std::vector<float> queries_vec(points_vec);
+    for (auto& v : queries_vec) v += 0.001f;
+    Tensor points(points_vec, {num_points, 3}, core::Float32);
+    Tensor queries(queries_vec, {num_points, 3}, core::Float32);
+
+    nns::NanoFlannIndex index(points, core::Int32);
+    index.SetSortQueries(sort_queries);
+    for (auto _ : state) {
+        auto result = index.SearchHybrid(queries, 0.01, 1);
+        benchmark::DoNotOptimize(std::get<0>(result).GetDataPtr());
+    }
+}
+BENCHMARK(NanoFlannSortQueries)
+        ->ArgsProduct({{100000, 1000000}, {0, 1}})
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace core
+}  // namespace open3d
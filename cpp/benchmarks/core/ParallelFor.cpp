@@ -9,9 +9,13 @@
 
 #include <benchmark/benchmark.h>
 
+#include <cmath>
 #include <numeric>
+#include <thread>
 #include <vector>
 
+#include "open3d/utility/Parallel.h"
+
 #ifdef BUILD_ISPC_MODULE
 #include "ParallelFor_ispc.h"
 #endif
@@ -86,5 +90,157 @@ void ParallelForVectorized(benchmark::State& state, int size) {
 ENUM_BM_SIZE(ParallelForScalar)
 ENUM_BM_SIZE(ParallelForVectorized)
 
+/// Cheap loops over few elements, where the thread synchronization dominates.
+/// Compares the default options with a grain size and a serial cutoff.
+void ParallelForSmall(benchmark::State& state, int size, bool use_cutoff) {
+    std::vector<float> input(size);
+    std::vector<float> output(size);
+    std::iota(input.begin(), input.end(), 0.0f);
+    const ParallelForOptions options =
+            use_cutoff ? ParallelForOptions{utility::ParallelSchedule::Static,
+                                            1024, 4096}
+                       : ParallelForOptions{};
+
+    for (auto _ : state) {
+        core::ParallelFor(core::Device("CPU:0"), size, options,
+                          [&](int64_t idx) {
+                              float x = input[idx];
+                              output[idx] = x * x;
+                          });
+        benchmark::DoNotOptimize(output.data());
+    }
+}
+
+#define ENUM_BM_SMALL(SIZE)                                              \
+    BENCHMARK_CAPTURE(ParallelForSmall, Default_##SIZE, SIZE, false)     \
+            ->Unit(benchmark::kMicrosecond);                             \
+    BENCHMARK_CAPTURE(ParallelForSmall, SerialCutoff_##SIZE, SIZE, true) \
+            ->Unit(benchmark::kMicrosecond);
+
+ENUM_BM_SMALL(16)
+ENUM_BM_SMALL(256)
+ENUM_BM_SMALL(4096)
+ENUM_BM_SMALL(65536)
+
+/// Loops whose iterations have very different costs, similar to per-point
+/// processing of neighborhoods of varying size. The iterations of the first
+/// eighth of the range are 64 times more expensive than the others.
+void ParallelForIrregular(benchmark::State& state,
+                          utility::ParallelSchedule schedule) {
+    const int64_t size = 100000;
+    std::vector<float> output(size);
+
+    for (auto _ : state) {
+        core::ParallelFor(core::Device("CPU:0"), size, {schedule, 16},
+                          [&](int64_t idx) {
+                              const int num_steps = idx < size / 8 ? 512 : 8;
+                              float x = static_cast<float>(idx);
+                              for (int i = 0; i < num_steps; ++i) {
+                                  x = std::sqrt(x + 1.0f);
+                              }
+                              output[idx] = x;
+                          });
+        benchmark::DoNotOptimize(output.data());
+    }
+}
+
+BENCHMARK_CAPTURE(ParallelForIrregular, Static,
+                  utility::ParallelSchedule::Static)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ParallelForIrregular, Dynamic,
+                  utility::ParallelSchedule::Dynamic)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ParallelForIrregular, Guided,
+                  utility::ParallelSchedule::Guided)
+        ->Unit(benchmark::kMillisecond);
+
+/// How several independent pipelines are run concurrently.
+enum class PipelineMode {
+    /// One after the other, each using all threads.
+    Sequential,
+    /// Concurrently in a utility::TaskGroup sharing the scheduler's threads.
+    TaskGroup,
+    /// Concurrently in std::threads, each opening its own OpenMP parallel
+    /// regions as the code did before the task scheduler.
+    ThreadsOpenMP,
+};
+
+/// A small processing pipeline of several element-wise passes.
+static void RunPipeline(std::vector<float>& data, bool use_openmp) {
+    const int64_t n = static_cast<int64_t>(data.size());
+    float* ptr = data.data();
+    for (int stage = 0; stage < 4; ++stage) {
+        auto func = [ptr, stage](int64_t idx) {
+            float x = ptr[idx];
+            ptr[idx] = std::sqrt(x * x + 1.0f) * 0.5f + std::sin(x + stage);
+        };
+        if (use_openmp) {
+#pragma omp parallel for num_threads(utility::EstimateMaxThreads())
+            for (int64_t idx = 0; idx < n; ++idx) {
+                func(idx);
+            }
+        } else {
+            core::ParallelFor(core::Device("CPU:0"), n, func);
+        }
+    }
+}
+
+void ParallelPipelines(benchmark::State& state,
+                       PipelineMode mode,
+                       int num_pipelines) {
+    const int64_t size = 1 << 20;
+    std::vector<std::vector<float>> data(num_pipelines,
+                                         std::vector<float>(size));
+    for (auto& d : data) {
+        std::iota(d.begin(), d.end(), 0.0f);
+    }
+
+    auto run = [&]() {
+        if (mode == PipelineMode::Sequential) {
+            for (auto& d : data) {
+                RunPipeline(d, false);
+            }
+        } else if (mode == PipelineMode::TaskGroup) {
+            utility::TaskGroup group;
+            for (auto& d : data) {
+                group.Run([&d]() { RunPipeline(d, false); });
+            }
+            group.Wait();
+        } else {
+            std::vector<std::thread> threads;
+            for (auto& d : data) {
+                threads.emplace_back([&d]() { RunPipeline(d, true); });
+            }
+            for (auto& thread : threads) {
+                thread.join();
+            }
+        }
+    };
+
+    // Warmup.
+    run();
+
+    for (auto _ : state) {
+        run();
+    }
+    state.SetItemsProcessed(state.iterations() * num_pipelines * size);
+}
+
+#define ENUM_BM_PIPELINES(MODE)                                           \
+    BENCHMARK_CAPTURE(ParallelPipelines, MODE##_1, PipelineMode::MODE, 1) \
+            ->UseRealTime()                                               \
+            ->Unit(benchmark::kMillisecond);                              \
+    BENCHMARK_CAPTURE(ParallelPipelines, MODE##_4, PipelineMode::MODE, 4) \
+            ->UseRealTime()                                               \
+            ->Unit(benchmark::kMillisecond);                              \
+    BENCHMARK_CAPTURE(ParallelPipelines, MODE##_16, PipelineMode::MODE,   \
+                      16)                                                 \
+            ->UseRealTime()                                               \
+            ->Unit(benchmark::kMillisecond);
+
+ENUM_BM_PIPELINES(Sequential)
+ENUM_BM_PIPELINES(TaskGroup)
+ENUM_BM_PIPELINES(ThreadsOpenMP)
+
 }  // namespace core
 }  // namespace open3d
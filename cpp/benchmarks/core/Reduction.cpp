@@ -38,5 +38,81 @@ BENCHMARK_CAPTURE(Reduction, CUDA, Device("CUDA:0"))
         ->Unit(benchmark::kMillisecond);
 #endif
 
+enum class PointReductionOp { Sum, Min, Max, ArgMin, Mean };
+
+/// Reduces the points of a Nx3 Float32 tensor, as in PointCloud::GetMinBound,
+/// GetMaxBound and GetCenter. The strided case uses a Nx3 view into a Nx6
+/// tensor, which takes the generic Indexer path.
+void ReductionPoints(benchmark::State& state,
+                     int64_t num_points,
+                     PointReductionOp op_code,
+                     bool strided,
+                     const Device& device) {
+    Tensor points =
+            strided ? Tensor::Ones({num_points, 6}, core::Float32, device)
+                              .Slice(1, 0, 3)
+                    : Tensor::Ones({num_points, 3}, core::Float32, device);
+    auto reduce = [&]() -> Tensor {
+        switch (op_code) {
+            case PointReductionOp::Sum:
+                return points.Sum({0});
+            case PointReductionOp::Min:
+                return points.Min({0});
+            case PointReductionOp::Max:
+                return points.Max({0});
+            case PointReductionOp::ArgMin:
+                return points.ArgMin({0});
+            case PointReductionOp::Mean:
+                return points.Mean({0});
+        }
+        return Tensor();
+    };
+
+    Tensor warm_up = reduce();
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = reduce();
+        cuda::Synchronize(device);
+    }
+    state.SetBytesProcessed(state.iterations() * num_points * 3 *
+                            sizeof(float));
+}
+
+/// Reduces the last dimension of a contiguous tensor.
+void ReductionInner(benchmark::State& state,
+                    int64_t num_rows,
+                    int64_t num_cols,
+                    const Device& device) {
+    Tensor src = Tensor::Ones({num_rows, num_cols}, core::Float32, device);
+    Tensor warm_up = src.Sum({1});
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = src.Sum({1});
+        cuda::Synchronize(device);
+    }
+    state.SetBytesProcessed(state.iterations() * num_rows * num_cols *
+                            sizeof(float));
+}
+
+#define ENUM_BM_REDUCTION_POINTS(OP)                                         \
+    BENCHMARK_CAPTURE(ReductionPoints, OP##__CPU_Contiguous, 10000000,       \
+                      PointReductionOp::OP, false, Device("CPU:0"))           \
+            ->Unit(benchmark::kMillisecond);                                 \
+    BENCHMARK_CAPTURE(ReductionPoints, OP##__CPU_Strided, 10000000,          \
+                      PointReductionOp::OP, true, Device("CPU:0"))            \
+            ->Unit(benchmark::kMillisecond);
+
+ENUM_BM_REDUCTION_POINTS(Sum)
+ENUM_BM_REDUCTION_POINTS(Min)
+ENUM_BM_REDUCTION_POINTS(Max)
+ENUM_BM_REDUCTION_POINTS(ArgMin)
+ENUM_BM_REDUCTION_POINTS(Mean)
+
+BENCHMARK_CAPTURE(ReductionInner, CPU_1000000x32, 1000000, 32,
+                  Device("CPU:0"))
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ReductionInner, CPU_1000x32000, 1000, 32000, Device("CPU:0"))
+        ->Unit(benchmark::kMillisecond);
+
 }  // namespace core
 }  // namespace open3d
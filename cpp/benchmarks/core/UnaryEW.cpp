@@ -105,6 +105,40 @@ void UnaryEW(benchmark::State& state,
     }
 }
 
+/// Memory layouts of the operand for the element-wise fast path.
+enum class Layout {
+    /// The operand is contiguous.
+    Contiguous,
+    /// The operand is a view with a stride of 2.
+    Strided,
+};
+
+void UnaryEWLayout(benchmark::State& state,
+                   int size,
+                   UnaryOpCode op_code,
+                   Layout layout,
+                   const Dtype& dtype,
+                   const Device& device) {
+    Tensor arg;
+    if (layout == Layout::Contiguous) {
+        arg = benchmarks::Rand({1, size}, 1, {1, 127}, dtype, device);
+    } else {
+        arg = benchmarks::Rand({1, 2 * size}, 1, {1, 127}, dtype, device)
+                      .Slice(1, 0, 2 * size, 2);
+    }
+    auto op = MakeOperation(op_code);
+
+    Tensor result = op(arg);
+    benchmark::DoNotOptimize(result);
+
+    for (auto _ : state) {
+        Tensor result = op(arg);
+        benchmark::DoNotOptimize(result);
+
+        cuda::Synchronize(device);
+    }
+}
+
 #define ENUM_BM_SIZE(FN, OP, DEVICE, DEVICE_NAME, DTYPE)                   \
     BENCHMARK_CAPTURE(FN, OP##__##DEVICE_NAME##_##DTYPE##__100, 100,       \
                       UnaryOpCode::OP, DTYPE, DEVICE)                      \
@@ -186,5 +220,24 @@ ENUM_BM_TENSOR(UnaryEW, Round)
 ENUM_BM_TENSOR(UnaryEW, Trunc)
 ENUM_BM_TENSOR_WTIH_BOOL(UnaryEW, LogicalNot)
 
+#define ENUM_BM_LAYOUT(FN, OP, DTYPE, LAYOUT)                             \
+    BENCHMARK_CAPTURE(FN, OP##__CPU_##DTYPE##_##LAYOUT##__100000, 100000, \
+                      UnaryOpCode::OP, Layout::LAYOUT, DTYPE,             \
+                      Device("CPU:0"))                                    \
+            ->Unit(benchmark::kMillisecond);                              \
+    BENCHMARK_CAPTURE(FN, OP##__CPU_##DTYPE##_##LAYOUT##__10000000,       \
+                      10000000, UnaryOpCode::OP, Layout::LAYOUT, DTYPE,   \
+                      Device("CPU:0"))                                    \
+            ->Unit(benchmark::kMillisecond);
+
+#define ENUM_BM_LAYOUTS(FN, OP, DTYPE)        \
+    ENUM_BM_LAYOUT(FN, OP, DTYPE, Contiguous) \
+    ENUM_BM_LAYOUT(FN, OP, DTYPE, Strided)
+
+ENUM_BM_LAYOUTS(UnaryEWLayout, Abs, Float32)
+ENUM_BM_LAYOUTS(UnaryEWLayout, Neg, Int32)
+ENUM_BM_LAYOUTS(UnaryEWLayout, Sqrt, Float64)
+ENUM_BM_LAYOUTS(UnaryEWLayout, LogicalNot, Bool)
+
 }  // namespace core
 }  // namespace open3d
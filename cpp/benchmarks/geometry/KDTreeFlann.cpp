@@ -11,6 +11,7 @@
 
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
+#include "open3d/utility/Random.h"
 
 namespace open3d {
 namespace benchmarks {
@@ -77,5 +78,26 @@ BENCHMARK(BM_TestKDTreeLine0)
         ->MinTime(0.1)
         ->Ranges({{1 << 0, 1 << 14}, {1 << 16, 1 << 22}});
 
+static void BM_KDTreeFlannBuild(benchmark::State& state) {
+    const int num_points = int(state.range(0));
+    const int build_threads = int(state.range(1));
+    utility::random::Seed(0);
+    utility::random::UniformRealGenerator<double> uniform(0.0, 100.0);
+    Eigen::MatrixXd data(3, num_points);
+    for (int i = 0; i < num_points; ++i) {
+        data.col(i) = Eigen::Vector3d(uniform(), uniform(), uniform());
+    }
+    geometry::KDTreeFlann kdtree;
+    kdtree.SetBuildThreads(build_threads);
+    for (auto _ : state) {
+        kdtree.SetMatrixData(data);
+    }
+}
+// Build time of 1M and 16M point trees with 1 to 16 subtrees built
+// concurrently.
+BENCHMARK(BM_KDTreeFlannBuild)
+        ->ArgsProduct({{1 << 20, 1 << 24}, {1, 2, 4, 8, 16}})
+        ->Unit(benchmark::kMillisecond);
+
 }  // namespace benchmarks
 }  // namespace open3d
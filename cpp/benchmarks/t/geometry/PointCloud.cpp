@@ -9,6 +9,8 @@
 
 #include <benchmark/benchmark.h>
 
+#include <numeric>
+
 #include "open3d/core/CUDAUtils.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/data/Dataset.h"
@@ -85,6 +87,48 @@ void VoxelDownSample(benchmark::State& state,
     }
 }
 
+// Voxel downsampling with sort-based grouping instead of a hash map: the
+// voxel coordinates are linearized to int64 keys, grouped with Tensor::Unique
+// and Tensor::ArgSort, and the points of each voxel are averaged with
+// Tensor::SegmentMean. Only the point positions are reduced.
+void SortVoxelDownSample(benchmark::State& state, float voxel_size) {
+    t::geometry::PointCloud pcd;
+    t::io::ReadPointCloud(path, pcd, {"auto", false, false, false});
+    const core::Tensor positions = pcd.GetPointPositions();
+    const int64_t num_points = positions.GetLength();
+
+    auto down_sample = [&]() {
+        core::Tensor voxels = positions.Div(voxel_size).Floor().To(core::Int64);
+        voxels = voxels.Sub(voxels.Min({0}));
+        const std::vector<int64_t> extent =
+                voxels.Max({0}).Add(1).ToFlatVector<int64_t>();
+        const core::Tensor keys = voxels.Slice(1, 0, 1)
+                                          .Mul(extent[1] * extent[2])
+                                          .Add(voxels.Slice(1, 1, 2)
+                                                       .Mul(extent[2]))
+                                          .Add(voxels.Slice(1, 2, 3))
+                                          .Reshape({num_points});
+
+        core::Tensor unique_keys, inverse, counts;
+        std::tie(unique_keys, inverse, counts) = keys.Unique();
+        std::vector<int64_t> row_splits(counts.GetLength() + 1, 0);
+        const std::vector<int64_t> counts_vec = counts.ToFlatVector<int64_t>();
+        std::partial_sum(counts_vec.begin(), counts_vec.end(),
+                         row_splits.begin() + 1);
+        return positions.IndexGet({inverse.ArgSort()})
+                .SegmentMean(core::Tensor(row_splits,
+                                          {int64_t(row_splits.size())},
+                                          core::Int64));
+    };
+
+    // Warm up.
+    down_sample();
+
+    for (auto _ : state) {
+        down_sample();
+    }
+}
+
 void LegacyUniformDownSample(benchmark::State& state, size_t k) {
     auto pcd = open3d::io::CreatePointCloudFromFile(path);
     for (auto _ : state) {
@@ -430,6 +474,18 @@ BENCHMARK_CAPTURE(LegacyVoxelDownSample, Legacy_0_16, 0.16)
 BENCHMARK_CAPTURE(LegacyVoxelDownSample, Legacy_0_32, 0.32)
         ->Unit(benchmark::kMillisecond);
 ENUM_VOXELDOWNSAMPLE_REDUCTION()
+BENCHMARK_CAPTURE(SortVoxelDownSample, CPU_0_01, 0.01)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(SortVoxelDownSample, CPU_0_02, 0.02)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(SortVoxelDownSample, CPU_0_04, 0.04)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(SortVoxelDownSample, CPU_0_08, 0.08)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(SortVoxelDownSample, CPU_0_16, 0.16)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(SortVoxelDownSample, CPU_0_32, 0.32)
+        ->Unit(benchmark::kMillisecond);
 
 BENCHMARK_CAPTURE(LegacyUniformDownSample, Legacy_2, 2)
         ->Unit(benchmark::kMillisecond);
@@ -40,10 +40,11 @@ bool IsAvailable() { return cuda::DeviceCount() > 0; }
 void ReleaseCache() {
 #ifdef BUILD_CUDA_MODULE
 #ifdef ENABLE_CACHED_CUDA_MANAGER
-    // Release cache from all devices. Since only memory from MemoryManagerCUDA
-    // is cached at the moment, this works as expected. In the future, the logic
-    // could become more fine-grained.
-    MemoryManagerCached::ReleaseCache();
+    // Release cache from all CUDA devices. Memory of CPU devices may also be
+    // cached, so a global release would be too coarse.
+    for (int i = 0; i < DeviceCount(); ++i) {
+        MemoryManagerCached::ReleaseCache(Device(Device::DeviceType::CUDA, i));
+    }
 #else
     utility::LogWarning(
             "Built without cached CUDA memory manager, cuda::ReleaseCache() "
@@ -8,6 +8,7 @@
 #pragma once
 
 #include "open3d/core/Dtype.h"
+#include "open3d/core/Half.h"
 #include "open3d/utility/Logging.h"
 
 /// Call a numerical templated function based on Dtype. Wrap the function to
@@ -74,6 +75,32 @@
         }                                                   \
     }()
 
+/// Same as DISPATCH_DTYPE_TO_TEMPLATE, with the half precision storage types
+/// float16_t and bfloat16_t in addition. Kernels dispatched with this macro
+/// must only read and write scalar_t values and compute in float or double.
+#define DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(DTYPE, ...)    \
+    [&] {                                                   \
+        if (DTYPE == open3d::core::Float16) {               \
+            using scalar_t = open3d::core::float16_t;       \
+            return __VA_ARGS__();                           \
+        } else if (DTYPE == open3d::core::BFloat16) {       \
+            using scalar_t = open3d::core::bfloat16_t;      \
+            return __VA_ARGS__();                           \
+        } else {                                            \
+            DISPATCH_DTYPE_TO_TEMPLATE(DTYPE, __VA_ARGS__); \
+        }                                                   \
+    }()
+
+#define DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(DTYPE, ...)     \
+    [&] {                                                             \
+        if (DTYPE == open3d::core::Bool) {                            \
+            using scalar_t = bool;                                    \
+            return __VA_ARGS__();                                     \
+        } else {                                                      \
+            DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(DTYPE, __VA_ARGS__); \
+        }                                                             \
+    }()
+
 #define DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(DTYPE, ...)             \
     [&] {                                                        \
         if (DTYPE == open3d::core::Float32) {                    \
@@ -12,6 +12,7 @@
 
 #include "open3d/Macro.h"
 #include "open3d/core/Dispatch.h"
+#include "open3d/core/Half.h"
 #include "open3d/utility/Logging.h"
 
 namespace open3d {
@@ -22,6 +23,8 @@ public:
     static const Dtype Undefined;
     static const Dtype Float32;
     static const Dtype Float64;
+    static const Dtype Float16;
+    static const Dtype BFloat16;
     static const Dtype Int8;
     static const Dtype Int16;
     static const Dtype Int32;
@@ -77,6 +80,8 @@ private:
 OPEN3D_API extern const Dtype Undefined;
 OPEN3D_API extern const Dtype Float32;
 OPEN3D_API extern const Dtype Float64;
+OPEN3D_API extern const Dtype Float16;
+OPEN3D_API extern const Dtype BFloat16;
 OPEN3D_API extern const Dtype Int8;
 OPEN3D_API extern const Dtype Int16;
 OPEN3D_API extern const Dtype Int32;
@@ -97,6 +102,16 @@ inline const Dtype Dtype::FromType<double>() {
     return Dtype::Float64;
 }
 
+template <>
+inline const Dtype Dtype::FromType<float16_t>() {
+    return Dtype::Float16;
+}
+
+template <>
+inline const Dtype Dtype::FromType<bfloat16_t>() {
+    return Dtype::BFloat16;
+}
+
 template <>
 inline const Dtype Dtype::FromType<int8_t>() {
     return Dtype::Int8;
@@ -0,0 +1,189 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+#include "open3d/core/CUDAUtils.h"
+
+namespace open3d {
+namespace core {
+
+namespace detail {
+
+OPEN3D_HOST_DEVICE OPEN3D_FORCE_INLINE uint32_t FloatToBits(float f) {
+    uint32_t bits;
+    memcpy(&bits, &f, sizeof(bits));
+    return bits;
+}
+
+OPEN3D_HOST_DEVICE OPEN3D_FORCE_INLINE float BitsToFloat(uint32_t bits) {
+    float f;
+    memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+
+}  // namespace detail
+
+/// \class float16_t
+///
+/// IEEE 754 half precision float (1 sign, 5 exponent and 10 mantissa bits).
+///
+/// float16_t is a storage type: values are converted to float on read and
+/// rounded to the nearest even half on write, so arithmetic on float16_t
+/// operands is carried out in single precision.
+struct float16_t {
+    uint16_t bits_;
+
+    float16_t() = default;
+
+    OPEN3D_HOST_DEVICE float16_t(float value) : bits_(FromFloat(value)) {}
+
+    OPEN3D_HOST_DEVICE operator float() const { return ToFloat(bits_); }
+
+    /// Constructs a float16_t from its binary representation.
+    OPEN3D_HOST_DEVICE static float16_t FromBits(uint16_t bits) {
+        float16_t h;
+        h.bits_ = bits;
+        return h;
+    }
+
+    OPEN3D_HOST_DEVICE static uint16_t FromFloat(float value) {
+        const uint32_t f = detail::FloatToBits(value);
+        const uint32_t sign = (f >> 16) & 0x8000u;
+        const uint32_t abs = f & 0x7fffffffu;
+
+        // NaN is kept quiet, overflow becomes infinity.
+        if (abs > 0x7f800000u) {
+            return static_cast<uint16_t>(sign | 0x7e00u);
+        }
+        if (abs >= 0x477ff000u) {
+            return static_cast<uint16_t>(sign | 0x7c00u);
+        }
+        // Subnormal half, including zero. Adding 0.5 shifts the mantissa into
+        // place and the float adder performs the round to nearest even.
+        if (abs < 0x38800000u) {
+            const float r = detail::BitsToFloat(abs) + 0.5f;
+            return static_cast<uint16_t>(
+                    sign | (detail::FloatToBits(r) - 0x3f000000u));
+        }
+        // Normal half. Rebias the exponent and round to nearest even.
+        const uint32_t odd = (abs >> 13) & 1u;
+        const uint32_t rounded = abs + 0xc8000fffu + odd;
+        return static_cast<uint16_t>(sign | (rounded >> 13));
+    }
+
+    OPEN3D_HOST_DEVICE static float ToFloat(uint16_t h) {
+        const uint32_t sign = static_cast<uint32_t>(h & 0x8000u) << 16;
+        const uint32_t exponent = (h >> 10) & 0x1fu;
+        const uint32_t mantissa = h & 0x3ffu;
+        if (exponent == 0x1fu) {
+            return detail::BitsToFloat(sign | 0x7f800000u | (mantissa << 13));
+        }
+        if (exponent == 0) {
+            // Zero or subnormal: mantissa * 2^-24.
+            const float m =
+                    static_cast<float>(mantissa) * 5.9604644775390625e-8f;
+            return detail::BitsToFloat(sign | detail::FloatToBits(m));
+        }
+        return detail::BitsToFloat(sign | ((exponent + 112) << 23) |
+                                   (mantissa << 13));
+    }
+};
+
+/// \class bfloat16_t
+///
+/// Brain floating point (1 sign, 8 exponent and 7 mantissa bits), i.e. the
+/// upper half of a float. It has the range of float with less precision.
+///
+/// Like float16_t, bfloat16_t is a storage type and computes in float.
+struct bfloat16_t {
+    uint16_t bits_;
+
+    bfloat16_t() = default;
+
+    OPEN3D_HOST_DEVICE bfloat16_t(float value) : bits_(FromFloat(value)) {}
+
+    OPEN3D_HOST_DEVICE operator float() const { return ToFloat(bits_); }
+
+    /// Constructs a bfloat16_t from its binary representation.
+    OPEN3D_HOST_DEVICE static bfloat16_t FromBits(uint16_t bits) {
+        bfloat16_t h;
+        h.bits_ = bits;
+        return h;
+    }
+
+    OPEN3D_HOST_DEVICE static uint16_t FromFloat(float value) {
+        const uint32_t f = detail::FloatToBits(value);
+        if ((f & 0x7fffffffu) > 0x7f800000u) {
+            return static_cast<uint16_t>((f >> 16) | 0x0040u);
+        }
+        const uint32_t odd = (f >> 16) & 1u;
+        return static_cast<uint16_t>((f + 0x7fffu + odd) >> 16);
+    }
+
+    OPEN3D_HOST_DEVICE static float ToFloat(uint16_t h) {
+        return detail::BitsToFloat(static_cast<uint32_t>(h) << 16);
+    }
+};
+
+static_assert(sizeof(float16_t) == 2, "float16_t must be 2 bytes.");
+static_assert(sizeof(bfloat16_t) == 2, "bfloat16_t must be 2 bytes.");
+
+}  // namespace core
+}  // namespace open3d
+
+namespace std {
+
+template <>
+class numeric_limits<open3d::core::float16_t> {
+public:
+    using T = open3d::core::float16_t;
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = true;
+    static constexpr bool is_integer = false;
+    static constexpr bool is_exact = false;
+    static constexpr bool has_infinity = true;
+    static constexpr bool has_quiet_NaN = true;
+    static constexpr int digits = 11;
+    static constexpr int max_exponent = 16;
+    static constexpr int min_exponent = -13;
+    static T min() { return T::FromBits(0x0400); }
+    static T lowest() { return T::FromBits(0xfbff); }
+    static T max() { return T::FromBits(0x7bff); }
+    static T epsilon() { return T::FromBits(0x1400); }
+    static T infinity() { return T::FromBits(0x7c00); }
+    static T quiet_NaN() { return T::FromBits(0x7e00); }
+    static T denorm_min() { return T::FromBits(0x0001); }
+};
+
+template <>
+class numeric_limits<open3d::core::bfloat16_t> {
+public:
+    using T = open3d::core::bfloat16_t;
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = true;
+    static constexpr bool is_integer = false;
+    static constexpr bool is_exact = false;
+    static constexpr bool has_infinity = true;
+    static constexpr bool has_quiet_NaN = true;
+    static constexpr int digits = 8;
+    static constexpr int max_exponent = 128;
+    static constexpr int min_exponent = -125;
+    static T min() { return T::FromBits(0x0080); }
+    static T lowest() { return T::FromBits(0xff7f); }
+    static T max() { return T::FromBits(0x7f7f); }
+    static T epsilon() { return T::FromBits(0x3c00); }
+    static T infinity() { return T::FromBits(0x7f80); }
+    static T quiet_NaN() { return T::FromBits(0x7fc0); }
+    static T denorm_min() { return T::FromBits(0x0001); }
+};
+
+}  // namespace std
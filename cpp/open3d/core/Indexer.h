@@ -389,6 +389,38 @@ public:
         return GetOutput(0);
     }
 
+    /// Returns true if the elements of input \p input_idx are laid out
+    /// contiguously in the order of the workloads.
+    bool IsInputContiguous(int64_t input_idx) const {
+        if (input_idx >= num_inputs_ || input_idx < 0) {
+            utility::LogError("0 <= i < {} required, however, i = {}.",
+                              num_inputs_, input_idx);
+        }
+        return inputs_contiguous_[input_idx];
+    }
+
+    /// Returns true if the elements of output \p output_idx are laid out
+    /// contiguously in the order of the workloads.
+    bool IsOutputContiguous(int64_t output_idx = 0) const {
+        if (output_idx >= num_outputs_ || output_idx < 0) {
+            utility::LogError("0 <= i < {} required, however, i = {}.",
+                              num_outputs_, output_idx);
+        }
+        return outputs_contiguous_[output_idx];
+    }
+
+    /// Returns true if input \p input_idx is a single element broadcasted to
+    /// all workloads, i.e. its strides are 0 in all non-trivial dimensions.
+    bool IsInputScalarBroadcast(int64_t input_idx) const {
+        const TensorRef& input = GetInput(input_idx);
+        for (int64_t i = 0; i < ndims_; ++i) {
+            if (master_shape_[i] > 1 && input.byte_strides_[i] != 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
     /// Returns true if the \p dim -th dimension is reduced.
     bool IsReductionDim(int64_t dim) const {
         // All outputs have the same shape and reduction dims. Even if they
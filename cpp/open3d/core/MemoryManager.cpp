@@ -7,7 +7,10 @@
 
 #include "open3d/core/MemoryManager.h"
 
+#include <atomic>
+#include <cstdlib>
 #include <numeric>
+#include <string>
 #include <unordered_map>
 
 #include "open3d/core/Blob.h"
@@ -15,13 +18,57 @@
 #include "open3d/core/MemoryManagerStatistic.h"
 #include "open3d/utility/Helper.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Profiler.h"
 
 namespace open3d {
 namespace core {
 
+/// Marks a CPU backend which has not been selected yet in cpu_backend.
+static constexpr int kCPUBackendUnselected = -1;
+
+/// Backend of the CPU devices. It is selected once, either by
+/// MemoryManager::SetCPUBackend() before the first CPU allocation or by the
+/// OPEN3D_CPU_MEMORY_BACKEND environment variable on the first CPU allocation,
+/// and never changes afterwards, so that every block is freed by the backend
+/// which allocated it.
+static std::atomic<int> cpu_backend{kCPUBackendUnselected};
+
+static MemoryManagerBackend GetEnvCPUBackend() {
+    const char* env_p = std::getenv("OPEN3D_CPU_MEMORY_BACKEND");
+    if (env_p == nullptr) {
+        return MemoryManagerBackend::Direct;
+    }
+    const std::string env_backend = utility::ToLower(env_p);
+    if (env_backend == "cached") {
+        return MemoryManagerBackend::Cached;
+    }
+    if (env_backend != "direct") {
+        utility::LogWarning(
+                "Unknown OPEN3D_CPU_MEMORY_BACKEND \"{}\", expected "
+                "\"direct\" or \"cached\". Using \"direct\".",
+                env_p);
+    }
+    return MemoryManagerBackend::Direct;
+}
+
+/// Returns the CPU backend and selects it from the environment if it has not
+/// been selected yet.
+static MemoryManagerBackend SelectCPUBackend() {
+    int backend = cpu_backend.load();
+    if (backend == kCPUBackendUnselected) {
+        const int env_backend = static_cast<int>(GetEnvCPUBackend());
+        // On failure, backend is set to the one selected by another thread.
+        if (cpu_backend.compare_exchange_strong(backend, env_backend)) {
+            backend = env_backend;
+        }
+    }
+    return static_cast<MemoryManagerBackend>(backend);
+}
+
 void* MemoryManager::Malloc(size_t byte_size, const Device& device) {
     void* ptr = GetMemoryManagerDevice(device)->Malloc(byte_size, device);
     MemoryManagerStatistic::GetInstance().CountMalloc(ptr, byte_size, device);
+    OPEN3D_PROFILE_ALLOCATION(byte_size);
     return ptr;
 }
 
@@ -90,6 +137,23 @@ void MemoryManager::MemcpyToHost(void* host_ptr,
     Memcpy(host_ptr, Device("CPU:0"), src_ptr, src_device, num_bytes);
 }
 
+void MemoryManager::SetCPUBackend(MemoryManagerBackend backend) {
+    int selected_backend = kCPUBackendUnselected;
+    if (!cpu_backend.compare_exchange_strong(selected_backend,
+                                             static_cast<int>(backend)) &&
+        selected_backend != static_cast<int>(backend)) {
+        utility::LogError(
+                "The CPU memory manager backend has already been selected by "
+                "a previous CPU allocation or call. Call SetCPUBackend() "
+                "before allocating CPU memory, or set "
+                "OPEN3D_CPU_MEMORY_BACKEND.");
+    }
+}
+
+MemoryManagerBackend MemoryManager::GetCPUBackend() {
+    return SelectCPUBackend();
+}
+
 std::shared_ptr<MemoryManagerDevice> MemoryManager::GetMemoryManagerDevice(
         const Device& device) {
     static std::unordered_map<Device::DeviceType,
@@ -114,6 +178,14 @@ std::shared_ptr<MemoryManagerDevice> MemoryManager::GetMemoryManagerDevice(
 #endif
             };
 
+    if (device.IsCPU() && SelectCPUBackend() == MemoryManagerBackend::Cached) {
+        static std::shared_ptr<MemoryManagerDevice> cached_cpu_mm =
+                std::make_shared<MemoryManagerCached>(
+                        map_device_type_to_memory_manager.at(
+                                Device::DeviceType::CPU));
+        return cached_cpu_mm;
+    }
+
     if (map_device_type_to_memory_manager.find(device.GetType()) ==
         map_device_type_to_memory_manager.end()) {
         utility::LogError(
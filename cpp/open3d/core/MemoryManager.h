@@ -20,13 +20,23 @@ namespace core {
 
 class MemoryManagerDevice;
 
+/// Memory manager backends which can be selected at startup.
+enum class MemoryManagerBackend {
+    /// Every allocation and deallocation goes to the device directly.
+    Direct,
+    /// Allocations are served from a MemoryManagerCached instance.
+    Cached,
+};
+
 /// Top-level memory interface. Calls to any of the member functions will
 /// automatically dispatch the appropriate MemoryManagerDevice instance based on
 /// the provided device which is used to execute the requested functionality.
 ///
 /// The memory managers are dispatched as follows:
 ///
-/// DeviceType = CPU : MemoryManagerCPU
+/// DeviceType = CPU :
+///   Cached backend :                 MemoryManagerCached w/ MemoryManagerCPU
+///   Otherwise (default) :            MemoryManagerCPU
 /// DeviceType = CUDA :
 ///   ENABLE_CACHED_CUDA_MANAGER = ON : MemoryManagerCached w/ MemoryManagerCUDA
 ///   Otherwise :                      MemoryManagerCUDA
@@ -60,6 +70,22 @@ public:
                              const Device& src_device,
                              size_t num_bytes);
 
+    /// Selects the memory manager backend for CPU devices. The cached backend
+    /// keeps freed blocks in per-thread free lists of size classes and avoids
+    /// calling \p std::malloc and \p std::free for short-lived allocations.
+    ///
+    /// The backend is selected once per process, since blocks must be freed
+    /// by the backend which allocated them. Call this before the first CPU
+    /// allocation, e.g. at the start of main(). Otherwise, the first CPU
+    /// allocation selects the backend from the OPEN3D_CPU_MEMORY_BACKEND
+    /// environment variable ("direct" by default, or "cached"). Selecting a
+    /// different backend afterwards raises an error.
+    static void SetCPUBackend(MemoryManagerBackend backend);
+
+    /// Returns the memory manager backend used for CPU devices. Selects it
+    /// from the environment if it has not been selected yet.
+    static MemoryManagerBackend GetCPUBackend();
+
 protected:
     /// Internally dispatches the appropriate MemoryManagerDevice instance.
     static std::shared_ptr<MemoryManagerDevice> GetMemoryManagerDevice(
@@ -102,6 +128,10 @@ public:
 /// \p ReleaseCache or automatically if a direct allocation fails after
 /// observing a cache miss.
 ///
+/// - On CPU devices, sizes are rounded up to size classes and freed blocks are
+/// first kept in per-thread free lists, which serve subsequent allocations of
+/// the same thread without locking the shared cache.
+///
 class MemoryManagerCached : public MemoryManagerDevice {
 public:
     /// Constructs a cached memory manager instance that wraps the existing
@@ -136,10 +166,66 @@ protected:
     std::shared_ptr<MemoryManagerDevice> device_mm_;
 };
 
+/// Allocation policy of MemoryManagerCPU.
+///
+/// - Every block is aligned to \p alignment_ bytes.
+/// - If huge pages or a NUMA placement other than first-touch are requested,
+/// blocks of at least \p large_byte_size_threshold_ bytes are aligned to huge
+/// page boundaries. On Linux, they are advised to be backed by transparent
+/// huge pages and placed on NUMA nodes accordingly. Both are hints and
+/// silently ignored if the system does not support them.
+struct CPUAllocationPolicy {
+    /// Placement of the pages of large blocks on NUMA nodes.
+    enum class NUMAPlacement {
+        /// Pages are placed on the node of the thread touching them first.
+        FirstTouch = 0,
+        /// Pages are interleaved across all online nodes.
+        Interleave = 1,
+        /// Pages are bound to the node \p numa_node_.
+        Bind = 2,
+    };
+
+    /// Alignment of all blocks in bytes. Must be a power of two and a
+    /// multiple of sizeof(void*). Cached CPU memory managers support
+    /// alignments of up to 64 bytes and raise an error on larger ones.
+    size_t alignment_ = 64;
+
+    /// Size in bytes from which the huge page and NUMA hints are applied.
+    size_t large_byte_size_threshold_ = size_t(4) << 20;
+
+    /// Advise the kernel to back large blocks with transparent huge pages.
+    bool huge_pages_ = false;
+
+    /// NUMA placement of large blocks.
+    NUMAPlacement numa_placement_ = NUMAPlacement::FirstTouch;
+
+    /// NUMA node used by NUMAPlacement::Bind.
+    int numa_node_ = 0;
+};
+
 /// Direct memory manager which performs allocations and deallocations on the
-/// CPU via \p std::malloc and \p std::free.
+/// CPU via aligned variants of \p std::malloc and \p std::free. The
+/// allocations follow the CPUAllocationPolicy of the device.
 class MemoryManagerCPU : public MemoryManagerDevice {
 public:
+    /// Sets the allocation policy used for all CPU devices without a
+    /// device-specific policy.
+    static void SetAllocationPolicy(const CPUAllocationPolicy& policy);
+
+    /// Sets the allocation policy of the CPU device \p device, which
+    /// overrides the global policy. Device-specific policies are also kept by
+    /// cached CPU memory managers, since their caches are separated by device.
+    static void SetAllocationPolicy(const CPUAllocationPolicy& policy,
+                                    const Device& device);
+
+    /// Returns the allocation policy used for the CPU device \p device.
+    static CPUAllocationPolicy GetAllocationPolicy(
+            const Device& device = Device("CPU:0"));
+
+    /// Removes all device-specific policies and resets the global policy to
+    /// the default one.
+    static void ResetAllocationPolicy();
+
     /// Allocates memory of \p byte_size bytes on device \p device and returns a
     /// pointer to the beginning of the allocated memory block.
     void* Malloc(size_t byte_size, const Device& device) override;
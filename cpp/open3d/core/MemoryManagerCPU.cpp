@@ -5,26 +5,265 @@
 // SPDX-License-Identifier: MIT
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
+#include <atomic>
 #include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "open3d/core/MemoryManager.h"
 #include "open3d/utility/Logging.h"
 
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 namespace open3d {
 namespace core {
 
+/// Boundary of transparent huge pages on x86-64 and most AArch64 systems.
+static constexpr size_t kHugePageByteSize = size_t(2) << 20;
+
+/// Global and device-specific allocation policies.
+///
+/// Malloc reads the policies on every allocation, so they are kept in
+/// immutable snapshots which are read without locking and replaced on every
+/// change. Replaced snapshots are kept until exit since concurrent readers may
+/// still refer to them, which is cheap as policies are rarely changed.
+class CPUAllocationPolicyRegistry {
+public:
+    static CPUAllocationPolicyRegistry& GetInstance() {
+        static CPUAllocationPolicyRegistry instance;
+        return instance;
+    }
+
+    void Set(const CPUAllocationPolicy& policy) {
+        Check(policy);
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto policies = std::make_unique<Policies>(*policies_.load());
+        policies->global_policy_ = policy;
+        Publish(std::move(policies));
+    }
+
+    void Set(const CPUAllocationPolicy& policy, const Device& device) {
+        if (!device.IsCPU()) {
+            utility::LogError("Expected a CPU device, but got {}.",
+                              device.ToString());
+        }
+        Check(policy);
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto policies = std::make_unique<Policies>(*policies_.load());
+        policies->device_policies_[device.GetID()] = policy;
+        Publish(std::move(policies));
+    }
+
+    const CPUAllocationPolicy& Get(const Device& device) const {
+        const Policies* policies = policies_.load(std::memory_order_acquire);
+        if (policies->device_policies_.empty()) {
+            return policies->global_policy_;
+        }
+        auto it = policies->device_policies_.find(device.GetID());
+        return it != policies->device_policies_.end()
+                       ? it->second
+                       : policies->global_policy_;
+    }
+
+    void Reset() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        Publish(std::make_unique<Policies>());
+    }
+
+private:
+    struct Policies {
+        CPUAllocationPolicy global_policy_;
+        /// Policies of CPU devices by device ID.
+        std::unordered_map<int, CPUAllocationPolicy> device_policies_;
+    };
+
+    CPUAllocationPolicyRegistry() { Publish(std::make_unique<Policies>()); }
+
+    static void Check(const CPUAllocationPolicy& policy) {
+        const size_t alignment = policy.alignment_;
+        if (alignment < sizeof(void*) || (alignment & (alignment - 1)) != 0) {
+            utility::LogError(
+                    "Alignment must be a power of two and a multiple of {}, "
+                    "but got {}.",
+                    sizeof(void*), alignment);
+        }
+    }
+
+    /// Makes \p policies the current snapshot. Must be called with the mutex
+    /// being locked, except in the constructor.
+    void Publish(std::unique_ptr<Policies> policies) {
+        policies_.store(policies.get(), std::memory_order_release);
+        snapshots_.push_back(std::move(policies));
+    }
+
+    std::atomic<const Policies*> policies_{nullptr};
+    std::vector<std::unique_ptr<const Policies>> snapshots_;
+    std::mutex mutex_;
+};
+
+#ifdef __linux__
+/// Returns the bit mask of online NUMA nodes, e.g. "0-1" -> {0b11}.
+static std::vector<unsigned long> GetOnlineNUMANodeMask() {
+    std::vector<unsigned long> mask;
+    std::ifstream file("/sys/devices/system/node/online");
+    std::string ranges;
+    if (!(file >> ranges)) {
+        return mask;
+    }
+
+    const size_t bits = 8 * sizeof(unsigned long);
+    size_t pos = 0;
+    while (pos < ranges.size()) {
+        size_t end = ranges.find(',', pos);
+        if (end == std::string::npos) {
+            end = ranges.size();
+        }
+        const std::string range = ranges.substr(pos, end - pos);
+        const size_t dash = range.find('-');
+        const unsigned long first = std::stoul(range.substr(0, dash));
+        const unsigned long last = dash == std::string::npos
+                                           ? first
+                                           : std::stoul(range.substr(dash + 1));
+        for (unsigned long node = first; node <= last; ++node) {
+            if (mask.size() <= node / bits) {
+                mask.resize(node / bits + 1, 0);
+            }
+            mask[node / bits] |= 1UL << (node % bits);
+        }
+        pos = end + 1;
+    }
+    return mask;
+}
+
+/// Applies the huge page and NUMA hints to a block aligned to huge pages.
+static void AdviseLargeBlock(void* ptr,
+                             size_t byte_size,
+                             const CPUAllocationPolicy& policy,
+                             const Device& device) {
+    if (policy.huge_pages_) {
+#ifdef MADV_HUGEPAGE
+        if (madvise(ptr, byte_size, MADV_HUGEPAGE) != 0) {
+            utility::LogDebug("madvise(MADV_HUGEPAGE) failed for {} bytes.",
+                              byte_size);
+        }
+#endif
+    }
+
+    if (policy.numa_placement_ ==
+        CPUAllocationPolicy::NUMAPlacement::FirstTouch) {
+        return;
+    }
+
+#ifdef SYS_mbind
+    // Values of MPOL_BIND and MPOL_INTERLEAVE from <linux/mempolicy.h>.
+    static const std::vector<unsigned long> online_mask =
+            GetOnlineNUMANodeMask();
+    const size_t bits = 8 * sizeof(unsigned long);
+    int mode = 0;
+    std::vector<unsigned long> mask;
+    if (policy.numa_placement_ ==
+        CPUAllocationPolicy::NUMAPlacement::Interleave) {
+        mode = 3;
+        mask = online_mask;
+    } else {
+        mode = 2;
+        const size_t node = static_cast<size_t>(policy.numa_node_);
+        if (policy.numa_node_ >= 0 && node / bits < online_mask.size() &&
+            (online_mask[node / bits] >> (node % bits)) & 1UL) {
+            mask.resize(node / bits + 1, 0);
+            mask[node / bits] = 1UL << (node % bits);
+        }
+    }
+    if (mask.empty()) {
+        utility::LogDebug("NUMA node {} is not available.", policy.numa_node_);
+        return;
+    }
+    if (syscall(SYS_mbind, ptr, byte_size, mode, mask.data(),
+                mask.size() * bits + 1, 0) != 0) {
+        utility::LogDebug("mbind failed for {} bytes on {}.", byte_size,
+                          device.ToString());
+    }
+#endif
+}
+#endif
+
+void MemoryManagerCPU::SetAllocationPolicy(const CPUAllocationPolicy& policy) {
+    CPUAllocationPolicyRegistry::GetInstance().Set(policy);
+}
+
+void MemoryManagerCPU::SetAllocationPolicy(const CPUAllocationPolicy& policy,
+                                           const Device& device) {
+    CPUAllocationPolicyRegistry::GetInstance().Set(policy, device);
+}
+
+CPUAllocationPolicy MemoryManagerCPU::GetAllocationPolicy(
+        const Device& device) {
+    return CPUAllocationPolicyRegistry::GetInstance().Get(device);
+}
+
+void MemoryManagerCPU::ResetAllocationPolicy() {
+    CPUAllocationPolicyRegistry::GetInstance().Reset();
+}
+
 void* MemoryManagerCPU::Malloc(size_t byte_size, const Device& device) {
-    void* ptr;
-    ptr = std::malloc(byte_size);
+    const CPUAllocationPolicy& policy =
+            CPUAllocationPolicyRegistry::GetInstance().Get(device);
+    const bool has_hints =
+            policy.huge_pages_ ||
+            policy.numa_placement_ !=
+                    CPUAllocationPolicy::NUMAPlacement::FirstTouch;
+    const bool is_large =
+            has_hints && byte_size >= policy.large_byte_size_threshold_;
+    const size_t alignment =
+            is_large ? std::max(policy.alignment_, kHugePageByteSize)
+                     : policy.alignment_;
+
+    void* ptr = nullptr;
+#ifdef _WIN32
+    ptr = _aligned_malloc(byte_size, alignment);
+#else
+    if (posix_memalign(&ptr, alignment, byte_size) != 0) {
+        ptr = nullptr;
+    }
+#endif
     if (byte_size != 0 && !ptr) {
         utility::LogError("CPU malloc failed");
     }
+
+#ifdef __linux__
+    if (ptr && is_large) {
+        // Only advise full pages, the tail may be shared with other blocks.
+        const size_t advised_byte_size =
+                byte_size / kHugePageByteSize * kHugePageByteSize;
+        if (advised_byte_size > 0) {
+            AdviseLargeBlock(ptr, advised_byte_size, policy, device);
+        }
+    }
+#endif
+
     return ptr;
 }
 
 void MemoryManagerCPU::Free(void* ptr, const Device& device) {
     if (ptr) {
+#ifdef _WIN32
+        _aligned_free(ptr);
+#else
         std::free(ptr);
+#endif
     }
 }
 
@@ -12,6 +12,7 @@
 #include <mutex>
 #include <set>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "open3d/core/MemoryManager.h"
@@ -340,6 +341,156 @@ private:
     std::recursive_mutex mutex_;
 };
 
+class Cacher;
+
+/// Guards the registration of ThreadCache instances. It is instantiated before
+/// the Cacher instance and thus destroyed after it.
+static std::mutex& GetThreadCacheRegistryMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+/// Per-thread free lists of CPU blocks grouped by size classes.
+///
+/// Each block is preceded by a header which stores its size class, so that
+/// blocks can be returned to the free lists without querying the shared cache.
+/// Blocks in the free lists are still considered allocated by the shared
+/// MemoryCache and are returned to it if the lists are full, on
+/// \p ReleaseCache and when the thread exits.
+class ThreadCache {
+public:
+    /// Size of the block header. Keeps the default cache line alignment of
+    /// MemoryManagerCPU blocks, which is the largest supported alignment.
+    static constexpr size_t kHeaderByteSize = 64;
+
+    /// Largest size class that is kept in the free lists.
+    static constexpr size_t kMaxPooledByteSize = size_t(16) << 20;
+
+    /// Maximum total size of the blocks kept in the free lists of one thread.
+    static constexpr size_t kMaxThreadCacheByteSize = size_t(256) << 20;
+
+    explicit ThreadCache(Cacher* cacher);
+    ~ThreadCache();
+
+    ThreadCache(const ThreadCache&) = delete;
+    ThreadCache& operator=(const ThreadCache&) = delete;
+
+    /// Rounds the block size (including the header) up to its size class.
+    /// Classes are spaced at a quarter of the enclosing power of two, which
+    /// bounds the internal fragmentation to 25%. Blocks larger than the pooled
+    /// range are only aligned.
+    static size_t SizeClass(size_t byte_size) {
+        size_t block_byte_size = byte_size + kHeaderByteSize;
+        if (block_byte_size > kMaxPooledByteSize) {
+            return MemoryCache::AlignByteSize(block_byte_size,
+                                              kHeaderByteSize);
+        }
+        if (block_byte_size <= 4 * kHeaderByteSize) {
+            return 4 * kHeaderByteSize;
+        }
+        size_t msb = 0;
+        for (size_t v = block_byte_size - 1; v > 1; v >>= 1) {
+            ++msb;
+        }
+        size_t step = (size_t(1) << msb) / 4;
+        return ((block_byte_size - 1) / step + 1) * step;
+    }
+
+    /// Writes the header to \p block_ptr and returns the user pointer.
+    static void* ToUserPtr(void* block_ptr, size_t class_byte_size) {
+        *static_cast<size_t*>(block_ptr) = class_byte_size;
+        return static_cast<char*>(block_ptr) + kHeaderByteSize;
+    }
+
+    /// Returns the block pointer of \p user_ptr and reads its size class.
+    static void* ToBlockPtr(void* user_ptr, size_t& class_byte_size) {
+        void* block_ptr = static_cast<char*>(user_ptr) - kHeaderByteSize;
+        class_byte_size = *static_cast<size_t*>(block_ptr);
+        return block_ptr;
+    }
+
+    /// Pops a block of the given size class. Returns nullptr on a miss.
+    void* Malloc(size_t class_byte_size, const Device& device) {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        auto device_it = free_lists_.find(device);
+        if (device_it == free_lists_.end()) {
+            return nullptr;
+        }
+        auto list_it = device_it->second.find(class_byte_size);
+        if (list_it == device_it->second.end() || list_it->second.empty()) {
+            return nullptr;
+        }
+
+        void* block_ptr = list_it->second.back();
+        list_it->second.pop_back();
+        byte_size_ -= class_byte_size;
+        return block_ptr;
+    }
+
+    /// Pushes a block to the free list of its size class. Returns false if the
+    /// block should be returned to the shared cache instead.
+    bool Free(void* block_ptr, size_t class_byte_size, const Device& device) {
+        if (class_byte_size > kMaxPooledByteSize) {
+            return false;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        if (byte_size_ + class_byte_size > kMaxThreadCacheByteSize) {
+            return false;
+        }
+        free_lists_[device][class_byte_size].push_back(block_ptr);
+        byte_size_ += class_byte_size;
+        return true;
+    }
+
+    /// Empties the free lists of \p device and returns the contained blocks.
+    std::vector<void*> Flush(const Device& device) {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        std::vector<void*> block_ptrs;
+        auto device_it = free_lists_.find(device);
+        if (device_it == free_lists_.end()) {
+            return block_ptrs;
+        }
+        for (auto& list_pair : device_it->second) {
+            const auto& class_byte_size = list_pair.first;
+            auto& free_list = list_pair.second;
+
+            block_ptrs.insert(block_ptrs.end(), free_list.begin(),
+                              free_list.end());
+            byte_size_ -= class_byte_size * free_list.size();
+        }
+        free_lists_.erase(device_it);
+        return block_ptrs;
+    }
+
+    /// Returns the devices with non-empty free lists.
+    std::vector<Device> GetDevices() {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        std::vector<Device> devices;
+        for (const auto& device_pair : free_lists_) {
+            devices.push_back(device_pair.first);
+        }
+        return devices;
+    }
+
+    /// Detaches the thread cache from the Cacher. Must be called with the
+    /// registry mutex being locked.
+    void Detach() { cacher_ = nullptr; }
+
+private:
+    Cacher* cacher_ = nullptr;
+
+    std::unordered_map<Device, std::unordered_map<size_t, std::vector<void*>>>
+            free_lists_;
+    size_t byte_size_ = 0;
+
+    std::mutex mutex_;
+};
+
 class Cacher {
 public:
     static Cacher& GetInstance() {
@@ -359,6 +510,17 @@ public:
     }
 
     ~Cacher() {
+        // Threads may outlive the Cacher instance. Detach their caches, so
+        // that they do not access the Cacher on exit.
+        {
+            std::lock_guard<std::mutex> lock(GetThreadCacheRegistryMutex());
+            while (!thread_caches_.empty()) {
+                ThreadCache* thread_cache = *thread_caches_.begin();
+                Unregister(thread_cache);
+                thread_cache->Detach();
+            }
+        }
+
         for (const auto& cache_pair : device_caches_) {
             // Simulate C++17 structured bindings for better readability.
             const auto& device = cache_pair.first;
@@ -381,50 +543,65 @@ public:
                  const std::shared_ptr<MemoryManagerDevice>& device_mm) {
         Init(device);
 
-        size_t internal_byte_size = MemoryCache::AlignByteSize(byte_size);
-
-        // Malloc from cache.
-        void* ptr = device_caches_.at(device).Malloc(internal_byte_size);
-        if (ptr != nullptr) {
-            return ptr;
-        }
+        if (device.IsCPU()) {
+            // Blocks are split and offset by multiples of the header size, so
+            // larger alignments cannot be kept.
+            const size_t alignment =
+                    MemoryManagerCPU::GetAllocationPolicy(device).alignment_;
+            const size_t header_byte_size = ThreadCache::kHeaderByteSize;
+            if (alignment > header_byte_size) {
+                utility::LogError(
+                        "Cached CPU memory managers support alignments of up "
+                        "to {} bytes, but got {} on {}.",
+                        header_byte_size, alignment, device.ToString());
+            }
 
-        // Malloc from real memory manager.
-        try {
-            ptr = device_mm->Malloc(internal_byte_size, device);
-        } catch (const std::runtime_error&) {
-        }
+            size_t class_byte_size = ThreadCache::SizeClass(byte_size);
 
-        // Free cached memory and try again.
-        if (ptr == nullptr) {
-            auto old_ptrs =
-                    device_caches_.at(device).Release(internal_byte_size);
-            for (const auto& old_pair : old_ptrs) {
-                // Simulate C++17 structured bindings for better readability.
-                const auto& old_ptr = old_pair.first;
-                const auto& old_device_mm = old_pair.second;
-
-                old_device_mm->Free(old_ptr, device);
+            // Malloc from thread cache.
+            void* block_ptr =
+                    GetThreadCache().Malloc(class_byte_size, device);
+            if (block_ptr == nullptr) {
+                block_ptr = MallocFromCache(class_byte_size, device, device_mm);
             }
 
-            // Do not catch the error if the allocation still fails.
-            ptr = device_mm->Malloc(internal_byte_size, device);
+            return ThreadCache::ToUserPtr(block_ptr, class_byte_size);
         }
 
-        device_caches_.at(device).Acquire(ptr, internal_byte_size, device_mm);
-
-        return ptr;
+        return MallocFromCache(MemoryCache::AlignByteSize(byte_size), device,
+                               device_mm);
     }
 
     void Free(void* ptr, const Device& device) {
         Init(device);
 
+        if (device.IsCPU()) {
+            size_t class_byte_size = 0;
+            ptr = ThreadCache::ToBlockPtr(ptr, class_byte_size);
+
+            // Free to thread cache.
+            if (GetThreadCache().Free(ptr, class_byte_size, device)) {
+                return;
+            }
+        }
+
         device_caches_.at(device).Free(ptr);
     }
 
     void Clear(const Device& device) {
         Init(device);
 
+        if (device.IsCPU()) {
+            // Return the blocks of all thread caches to the shared cache
+            // first, so that their real blocks become releasable.
+            std::lock_guard<std::mutex> lock(GetThreadCacheRegistryMutex());
+            for (ThreadCache* thread_cache : thread_caches_) {
+                for (void* block_ptr : thread_cache->Flush(device)) {
+                    device_caches_.at(device).Free(block_ptr);
+                }
+            }
+        }
+
         auto old_ptrs = device_caches_.at(device).ReleaseAll();
         for (const auto& old_pair : old_ptrs) {
             // Simulate C++17 structured bindings for better readability.
@@ -452,8 +629,71 @@ public:
         }
     }
 
+    /// Registers a thread cache. Must be called with the registry mutex
+    /// being locked.
+    void Register(ThreadCache* thread_cache) {
+        thread_caches_.insert(thread_cache);
+    }
+
+    /// Unregisters a thread cache and returns its blocks to the shared cache.
+    /// Must be called with the registry mutex being locked.
+    void Unregister(ThreadCache* thread_cache) {
+        thread_caches_.erase(thread_cache);
+
+        for (const auto& device : thread_cache->GetDevices()) {
+            for (void* block_ptr : thread_cache->Flush(device)) {
+                device_caches_.at(device).Free(block_ptr);
+            }
+        }
+    }
+
 private:
-    Cacher() = default;
+    Cacher() { GetThreadCacheRegistryMutex(); }
+
+    /// Returns the cache of the calling thread.
+    ThreadCache& GetThreadCache() {
+        thread_local ThreadCache thread_cache(this);
+        return thread_cache;
+    }
+
+    /// Allocates \p internal_byte_size bytes from the shared cache of
+    /// \p device. Falls back to direct allocations on a cache miss.
+    void* MallocFromCache(
+            size_t internal_byte_size,
+            const Device& device,
+            const std::shared_ptr<MemoryManagerDevice>& device_mm) {
+        // Malloc from cache.
+        void* ptr = device_caches_.at(device).Malloc(internal_byte_size);
+        if (ptr != nullptr) {
+            return ptr;
+        }
+
+        // Malloc from real memory manager.
+        try {
+            ptr = device_mm->Malloc(internal_byte_size, device);
+        } catch (const std::runtime_error&) {
+        }
+
+        // Free cached memory and try again.
+        if (ptr == nullptr) {
+            auto old_ptrs =
+                    device_caches_.at(device).Release(internal_byte_size);
+            for (const auto& old_pair : old_ptrs) {
+                // Simulate C++17 structured bindings for better readability.
+                const auto& old_ptr = old_pair.first;
+                const auto& old_device_mm = old_pair.second;
+
+                old_device_mm->Free(old_ptr, device);
+            }
+
+            // Do not catch the error if the allocation still fails.
+            ptr = device_mm->Malloc(internal_byte_size, device);
+        }
+
+        device_caches_.at(device).Acquire(ptr, internal_byte_size, device_mm);
+
+        return ptr;
+    }
 
     /// Resolves race conditions and avoids locking in the operations.
     /// Must be called at the beginning of all operations.
@@ -468,8 +708,23 @@ private:
 
     std::unordered_map<Device, MemoryCache> device_caches_;
     std::recursive_mutex init_mutex_;
+
+    /// Guarded by the registry mutex.
+    std::unordered_set<ThreadCache*> thread_caches_;
 };
 
+ThreadCache::ThreadCache(Cacher* cacher) : cacher_(cacher) {
+    std::lock_guard<std::mutex> lock(GetThreadCacheRegistryMutex());
+    cacher_->Register(this);
+}
+
+ThreadCache::~ThreadCache() {
+    std::lock_guard<std::mutex> lock(GetThreadCacheRegistryMutex());
+    if (cacher_ != nullptr) {
+        cacher_->Unregister(this);
+    }
+}
+
 MemoryManagerCached::MemoryManagerCached(
         const std::shared_ptr<MemoryManagerDevice>& device_mm)
     : device_mm_(device_mm) {
@@ -10,12 +10,21 @@
 #include <algorithm>
 #include <cstdlib>
 #include <numeric>
+#include <vector>
 
 #include "open3d/utility/Logging.h"
 
 namespace open3d {
 namespace core {
 
+namespace {
+/// Tags of the ScopedMemoryTag instances of the current thread.
+std::vector<const char*>& GetTagStack() {
+    thread_local std::vector<const char*> tags;
+    return tags;
+}
+}  // namespace
+
 MemoryManagerStatistic& MemoryManagerStatistic::GetInstance() {
     // Ensure the static Logger instance is instantiated before the
     // MemoryManagerStatistic instance.
@@ -101,6 +110,23 @@ void MemoryManagerStatistic::Print() const {
             utility::LogInfo("{}: {} {}", device.ToString(),
                              statistics.count_malloc_, statistics.count_free_);
         }
+
+        if (statistics.arena_count_malloc_ > 0) {
+            utility::LogInfo(
+                    "    Arena: {} blocks, peak {} bytes used, peak {} bytes "
+                    "reserved",
+                    statistics.arena_count_malloc_,
+                    statistics.arena_peak_byte_size_,
+                    statistics.arena_peak_reserved_byte_size_);
+        }
+
+        for (const auto& tag_pair : statistics.tag_statistics_) {
+            utility::LogInfo(
+                    "    Tag {}: {} mallocs, {} bytes live, peak {} bytes",
+                    tag_pair.first, tag_pair.second.count_malloc_,
+                    tag_pair.second.live_byte_size_,
+                    tag_pair.second.peak_byte_size_);
+        }
     }
     utility::LogInfo("---------------------------------------------");
 
@@ -125,9 +151,21 @@ void MemoryManagerStatistic::CountMalloc(void* ptr,
         return;
     }
 
-    auto it = statistics_[device].active_allocations_.emplace(ptr, byte_size);
+    auto& statistics = statistics_[device];
+    auto it = statistics.active_allocations_.emplace(ptr, byte_size);
     if (it.second) {
-        statistics_[device].count_malloc_++;
+        statistics.count_malloc_++;
+        const std::vector<const char*>& tags = GetTagStack();
+        if (!tags.empty()) {
+            TagStatistics& tag_statistics =
+                    statistics.tag_statistics_[tags.back()];
+            tag_statistics.count_malloc_++;
+            tag_statistics.live_byte_size_ += byte_size;
+            tag_statistics.peak_byte_size_ =
+                    std::max(tag_statistics.peak_byte_size_,
+                             tag_statistics.live_byte_size_);
+            statistics.active_tags_.emplace(ptr, &tag_statistics);
+        }
         if (print_at_malloc_free_) {
             utility::LogInfo("[Malloc] {}: {} @ {} bytes",
                              fmt::sprintf("%6s", device.ToString()),
@@ -156,8 +194,15 @@ void MemoryManagerStatistic::CountFree(void* ptr, const Device& device) {
                              fmt::ptr(ptr),
                              statistics_[device].active_allocations_.at(ptr));
         }
-        statistics_[device].active_allocations_.erase(ptr);
-        statistics_[device].count_free_++;
+        auto& statistics = statistics_[device];
+        auto tag_it = statistics.active_tags_.find(ptr);
+        if (tag_it != statistics.active_tags_.end()) {
+            tag_it->second->live_byte_size_ -=
+                    statistics.active_allocations_.at(ptr);
+            statistics.active_tags_.erase(tag_it);
+        }
+        statistics.active_allocations_.erase(ptr);
+        statistics.count_free_++;
     } else if (num_to_erase == 0) {
         // Either the statistics were reset before or the given pointer is
         // invalid. Do not increase any counts and ignore both cases.
@@ -169,6 +214,45 @@ void MemoryManagerStatistic::CountFree(void* ptr, const Device& device) {
     }
 }
 
+void MemoryManagerStatistic::CountArena(const Device& device,
+                                        int64_t count_malloc,
+                                        size_t peak_byte_size,
+                                        size_t peak_reserved_byte_size) {
+    std::lock_guard<std::mutex> lock(statistics_mutex_);
+
+    if (count_malloc == 0) {
+        return;
+    }
+
+    auto& statistics = statistics_[device];
+    statistics.arena_count_malloc_ += count_malloc;
+    statistics.arena_peak_byte_size_ =
+            std::max(statistics.arena_peak_byte_size_, peak_byte_size);
+    statistics.arena_peak_reserved_byte_size_ =
+            std::max(statistics.arena_peak_reserved_byte_size_,
+                     peak_reserved_byte_size);
+}
+
+int64_t MemoryManagerStatistic::GetArenaMallocCount(const Device& device) {
+    std::lock_guard<std::mutex> lock(statistics_mutex_);
+    auto it = statistics_.find(device);
+    return it != statistics_.end() ? it->second.arena_count_malloc_ : 0;
+}
+
+size_t MemoryManagerStatistic::GetArenaPeakByteSize(const Device& device) {
+    std::lock_guard<std::mutex> lock(statistics_mutex_);
+    auto it = statistics_.find(device);
+    return it != statistics_.end() ? it->second.arena_peak_byte_size_ : 0;
+}
+
+std::map<std::string, MemoryManagerStatistic::TagStatistics>
+MemoryManagerStatistic::GetTagStatistics(const Device& device) {
+    std::lock_guard<std::mutex> lock(statistics_mutex_);
+    auto it = statistics_.find(device);
+    return it != statistics_.end() ? it->second.tag_statistics_
+                                   : std::map<std::string, TagStatistics>();
+}
+
 void MemoryManagerStatistic::Reset() {
     std::lock_guard<std::mutex> lock(statistics_mutex_);
     statistics_.clear();
@@ -178,5 +262,11 @@ bool MemoryManagerStatistic::MemoryStatistics::IsBalanced() const {
     return count_malloc_ == count_free_;
 }
 
+ScopedMemoryTag::ScopedMemoryTag(const char* tag) {
+    GetTagStack().push_back(tag);
+}
+
+ScopedMemoryTag::~ScopedMemoryTag() { GetTagStack().pop_back(); }
+
 }  // namespace core
 }  // namespace open3d
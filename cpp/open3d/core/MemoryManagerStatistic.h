@@ -10,6 +10,7 @@
 #include <cstddef>
 #include <map>
 #include <mutex>
+#include <string>
 #include <unordered_map>
 
 #include "open3d/core/Device.h"
@@ -29,6 +30,16 @@ public:
         None = 2,
     };
 
+    /// Statistics of the allocations made within a ScopedMemoryTag.
+    struct TagStatistics {
+        /// Number of allocations with the tag.
+        int64_t count_malloc_ = 0;
+        /// Bytes of the allocations with the tag that are not freed yet.
+        size_t live_byte_size_ = 0;
+        /// High-water mark of live_byte_size_.
+        size_t peak_byte_size_ = 0;
+    };
+
     static MemoryManagerStatistic& GetInstance();
 
     MemoryManagerStatistic(const MemoryManagerStatistic&) = delete;
@@ -62,6 +73,26 @@ public:
     /// consistency.
     void CountFree(void* ptr, const Device& device);
 
+    /// Adds the usage of a ScopedArena that went out of scope to the
+    /// statistics. Arenas allocate their chunks through the MemoryManager, so
+    /// the chunks are additionally counted as regular allocations.
+    void CountArena(const Device& device,
+                    int64_t count_malloc,
+                    size_t peak_byte_size,
+                    size_t peak_reserved_byte_size);
+
+    /// Returns the number of blocks served by arenas on \p device.
+    int64_t GetArenaMallocCount(const Device& device);
+
+    /// Returns the largest high-water mark of the bytes used within the chunks
+    /// of a single arena on \p device.
+    size_t GetArenaPeakByteSize(const Device& device);
+
+    /// Returns the statistics of the allocations on \p device by the tag of
+    /// the innermost ScopedMemoryTag of the allocating thread. Untagged
+    /// allocations are not included.
+    std::map<std::string, TagStatistics> GetTagStatistics(const Device& device);
+
     /// Resets the statistics.
     void Reset();
 
@@ -74,6 +105,14 @@ private:
         int64_t count_malloc_ = 0;
         int64_t count_free_ = 0;
         std::unordered_map<void*, size_t> active_allocations_;
+
+        int64_t arena_count_malloc_ = 0;
+        size_t arena_peak_byte_size_ = 0;
+        size_t arena_peak_reserved_byte_size_ = 0;
+
+        std::map<std::string, TagStatistics> tag_statistics_;
+        /// Tags of the active allocations that were made within a tag scope.
+        std::unordered_map<void*, TagStatistics*> active_tags_;
     };
 
     /// Only print unbalanced statistics by default.
@@ -90,5 +129,33 @@ private:
     std::map<Device, MemoryStatistics> statistics_;
 };
 
+/// \class ScopedMemoryTag
+///
+/// Labels the allocations of the current thread with \p tag while in scope,
+/// so that MemoryManagerStatistic::GetTagStatistics() can report the live and
+/// peak bytes by tag. Tags nest, and allocations are counted for the
+/// innermost tag only. Allocations made by other threads, e.g. in parallel
+/// kernels, are not tagged. Only the pointer to \p tag is kept, so it must
+/// outlive the scope, e.g. a string literal.
+///
+/// Example:
+/// \code
+/// {
+///     core::ScopedMemoryTag tag("LinearSystem");
+///     core::Tensor AtA = core::Tensor::Zeros({n, n}, core::Float32);
+/// }
+/// auto stats = core::MemoryManagerStatistic::GetInstance()
+///                      .GetTagStatistics(core::Device("CPU:0"));
+/// utility::LogInfo("Peak: {} bytes", stats["LinearSystem"].peak_byte_size_);
+/// \endcode
+class ScopedMemoryTag {
+public:
+    explicit ScopedMemoryTag(const char* tag);
+    ~ScopedMemoryTag();
+
+    ScopedMemoryTag(const ScopedMemoryTag&) = delete;
+    ScopedMemoryTag& operator=(const ScopedMemoryTag&) = delete;
+};
+
 }  // namespace core
 }  // namespace open3d
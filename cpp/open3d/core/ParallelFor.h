@@ -26,6 +26,17 @@
 namespace open3d {
 namespace core {
 
+/// Scheduling options of ParallelFor on CPU. They are ignored on CUDA.
+struct ParallelForOptions {
+    /// How the workloads are distributed over the threads.
+    utility::ParallelSchedule schedule_ = utility::ParallelSchedule::Guided;
+    /// Minimum number of consecutive workloads run by one task.
+    int64_t grain_size_ = 1;
+    /// Up to this number of workloads, the loop runs serially in the calling
+    /// thread.
+    int64_t serial_cutoff_ = 0;
+};
+
 #ifdef __CUDACC__
 
 static constexpr int64_t OPEN3D_PARFOR_BLOCK = 128;
@@ -68,9 +79,12 @@ void ParallelForCUDA_(const Device& device, int64_t n, const func_t& func) {
 
 #else
 
-/// Run a function in parallel on CPU.
-template <typename func_t>
-void ParallelForCPU_(const Device& device, int64_t n, const func_t& func) {
+/// Run a function on sub-ranges of [0, n) in parallel on CPU.
+template <typename range_func_t>
+void ParallelForRangeCPU_(const Device& device,
+                          int64_t n,
+                          const range_func_t& range_func,
+                          const ParallelForOptions& options = {}) {
     if (!device.IsCPU()) {
         utility::LogError("ParallelFor for CPU cannot run on device {}.",
                           device.ToString());
@@ -78,11 +92,29 @@ void ParallelForCPU_(const Device& device, int64_t n, const func_t& func) {
     if (n == 0) {
         return;
     }
-
-#pragma omp parallel for num_threads(utility::EstimateMaxThreads())
-    for (int64_t i = 0; i < n; ++i) {
-        func(i);
+    if (n <= options.serial_cutoff_) {
+        range_func(0, n);
+        return;
     }
+
+    utility::ParallelForRange(0, n, options.grain_size_, range_func,
+                              options.schedule_);
+}
+
+/// Run a function in parallel on CPU.
+template <typename func_t>
+void ParallelForCPU_(const Device& device,
+                     int64_t n,
+                     const func_t& func,
+                     const ParallelForOptions& options = {}) {
+    ParallelForRangeCPU_(
+            device, n,
+            [&func](int64_t start, int64_t end) {
+                for (int64_t i = start; i < end; ++i) {
+                    func(i);
+                }
+            },
+            options);
 }
 
 #endif
@@ -94,6 +126,10 @@ void ParallelForCPU_(const Device& device, int64_t n, const func_t& func) {
 /// \param func The function to be executed in parallel. The function should
 /// take an int64_t workload index and returns void, i.e., `void func(int64_t)`.
 ///
+/// On CPU, the work is distributed by the work-stealing task scheduler of
+/// utility::ParallelForRange(), so that nested calls and concurrent calls from
+/// several threads share one pool of utility::GetMaxConcurrency() threads.
+///
 /// \note This is optimized for uniform work items, i.e. where each call to \p
 /// func takes the same time.
 /// \note If you use a lambda function, capture only the required variables
@@ -108,6 +144,37 @@ void ParallelFor(const Device& device, int64_t n, const func_t& func) {
 #endif
 }
 
+/// Run a function in parallel on CPU or CUDA with scheduling options.
+///
+/// \param device The device for the parallel for loop to run on.
+/// \param n The number of workloads.
+/// \param options The scheduling options on CPU. Use a grain size and a serial
+/// cutoff for cheap workloads, so that small loops do not pay for the thread
+/// synchronization, and the Dynamic or Guided schedules for workloads of
+/// varying cost, e.g. per-point loops over neighborhoods of varying size.
+/// \param func The function to be executed in parallel. The function should
+/// take an int64_t workload index and returns void, i.e., `void func(int64_t)`.
+///
+/// Example:
+///
+/// \code
+/// core::ParallelForOptions options{utility::ParallelSchedule::Dynamic, 16};
+/// core::ParallelFor(device, n, options, [=] OPEN3D_DEVICE(int64_t idx) {
+///     ProcessNeighbors(idx);
+/// });
+/// \endcode
+template <typename func_t>
+void ParallelFor(const Device& device,
+                 int64_t n,
+                 const ParallelForOptions& options,
+                 const func_t& func) {
+#ifdef __CUDACC__
+    ParallelForCUDA_(device, n, func);
+#else
+    ParallelForCPU_(device, n, func, options);
+#endif
+}
+
 /// Run a potentially vectorized function in parallel on CPU or CUDA.
 ///
 /// \param device The device for the parallel for loop to run on.
@@ -164,10 +231,7 @@ void ParallelFor(const Device& device,
 #ifdef __CUDACC__
     ParallelForCUDA_(device, n, func);
 #else
-    int num_threads = utility::EstimateMaxThreads();
-    ParallelForCPU_(device, num_threads, [&](int64_t i) {
-        int64_t start = n * i / num_threads;
-        int64_t end = std::min<int64_t>(n * (i + 1) / num_threads, n);
+    ParallelForRangeCPU_(device, n, [&vec_func](int64_t start, int64_t end) {
         vec_func(start, end);
     });
 #endif
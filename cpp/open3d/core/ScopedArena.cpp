@@ -0,0 +1,174 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/ScopedArena.h"
+
+#include <algorithm>
+#include <atomic>
+
+#include "open3d/core/MemoryManager.h"
+#include "open3d/core/MemoryManagerStatistic.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+
+/// Contiguous memory block from which the arena serves allocations. Chunks are
+/// reference counted by the arena and the deleters of its blocks, so that they
+/// stay valid as long as any of them is alive.
+struct ArenaChunk {
+    ArenaChunk(size_t byte_size, const Device& device)
+        : ptr_(MemoryManager::Malloc(byte_size, device)),
+          byte_size_(byte_size),
+          device_(device) {}
+
+    ~ArenaChunk() { MemoryManager::Free(ptr_, device_); }
+
+    ArenaChunk(const ArenaChunk&) = delete;
+    ArenaChunk& operator=(const ArenaChunk&) = delete;
+
+    void* ptr_ = nullptr;
+    size_t byte_size_ = 0;
+    Device device_;
+
+    /// Bump offset. Only accessed by the thread owning the arena.
+    size_t offset_ = 0;
+
+    /// References of the arena and of the live blocks. Blocks may be freed
+    /// from any thread.
+    std::atomic<int64_t> num_refs_{1};
+
+    /// Only meaningful in the thread owning the arena, which is the only one
+    /// adding references.
+    bool HasLiveBlocks() const {
+        return num_refs_.load(std::memory_order_acquire) > 1;
+    }
+
+    /// Drops a reference and deletes the chunk with the last one.
+    static void Release(ArenaChunk* chunk) {
+        if (chunk->num_refs_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            delete chunk;
+        }
+    }
+};
+
+/// Deleter of the arena blocks. It only holds a pointer, so that it is stored
+/// within std::function without a heap allocation.
+struct ArenaBlockDeleter {
+    ArenaChunk* chunk_;
+    void operator()(void*) const { ArenaChunk::Release(chunk_); }
+};
+
+/// Stack of active arenas of the current thread, innermost last.
+static std::vector<ScopedArena*>& GetThreadArenas() {
+    thread_local std::vector<ScopedArena*> arenas;
+    return arenas;
+}
+
+static size_t AlignUp(size_t byte_size, size_t alignment) {
+    return (byte_size + alignment - 1) / alignment * alignment;
+}
+
+ScopedArena::ScopedArena(const Device& device, size_t chunk_byte_size)
+    : device_(device), chunk_byte_size_(AlignUp(chunk_byte_size, kAlignment)) {
+    if (chunk_byte_size_ == 0) {
+        utility::LogError("Chunk size must be positive.");
+    }
+    GetThreadArenas().push_back(this);
+}
+
+ScopedArena::~ScopedArena() {
+    auto& arenas = GetThreadArenas();
+    auto it = std::find(arenas.rbegin(), arenas.rend(), this);
+    if (it != arenas.rend()) {
+        arenas.erase(std::next(it).base());
+    }
+
+    MemoryManagerStatistic::GetInstance().CountArena(
+            device_, count_malloc_, peak_byte_size_, peak_reserved_byte_size_);
+
+    // Chunks with live blocks are released by the deleter of the last block.
+    for (ArenaChunk* chunk : chunks_) {
+        ArenaChunk::Release(chunk);
+    }
+    chunks_.clear();
+}
+
+void* ScopedArena::Malloc(size_t byte_size,
+                          const Device& device,
+                          std::function<void(void*)>& deleter) {
+    auto& arenas = GetThreadArenas();
+    for (auto it = arenas.rbegin(); it != arenas.rend(); ++it) {
+        if ((*it)->device_ == device) {
+            return (*it)->MallocBlock(byte_size, deleter);
+        }
+    }
+    return nullptr;
+}
+
+size_t ScopedArena::GetReservedByteSize() const {
+    size_t reserved_byte_size = 0;
+    for (const auto& chunk : chunks_) {
+        reserved_byte_size += chunk->byte_size_;
+    }
+    return reserved_byte_size;
+}
+
+void* ScopedArena::MallocBlock(size_t byte_size,
+                               std::function<void(void*)>& deleter) {
+    const size_t block_byte_size = AlignUp(byte_size, kAlignment);
+    if (block_byte_size == 0 || block_byte_size > chunk_byte_size_) {
+        return nullptr;
+    }
+
+    ArenaChunk* chunk = GetChunk(block_byte_size);
+    void* ptr = static_cast<char*>(chunk->ptr_) + chunk->offset_;
+    chunk->offset_ += block_byte_size;
+    chunk->num_refs_.fetch_add(1, std::memory_order_relaxed);
+
+    ++count_malloc_;
+    used_byte_size_ += block_byte_size;
+    peak_byte_size_ = std::max(peak_byte_size_, used_byte_size_);
+
+    deleter = ArenaBlockDeleter{chunk};
+    return ptr;
+}
+
+ArenaChunk* ScopedArena::GetChunk(size_t byte_size) {
+    // Rewinds the chunk if all of its blocks have been freed.
+    auto rewind = [this](ArenaChunk& chunk) {
+        if (chunk.offset_ != 0 && !chunk.HasLiveBlocks()) {
+            used_byte_size_ -= chunk.offset_;
+            chunk.offset_ = 0;
+        }
+    };
+
+    if (!chunks_.empty()) {
+        ArenaChunk& current = *chunks_[current_chunk_idx_];
+        rewind(current);
+        if (current.offset_ + byte_size <= current.byte_size_) {
+            return &current;
+        }
+    }
+
+    for (size_t i = 0; i < chunks_.size(); ++i) {
+        rewind(*chunks_[i]);
+        if (chunks_[i]->offset_ + byte_size <= chunks_[i]->byte_size_) {
+            current_chunk_idx_ = i;
+            return chunks_[i];
+        }
+    }
+
+    chunks_.push_back(new ArenaChunk(chunk_byte_size_, device_));
+    current_chunk_idx_ = chunks_.size() - 1;
+    peak_reserved_byte_size_ =
+            std::max(peak_reserved_byte_size_, GetReservedByteSize());
+    return chunks_.back();
+}
+
+}  // namespace core
+}  // namespace open3d
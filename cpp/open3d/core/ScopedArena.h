@@ -0,0 +1,103 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "open3d/core/Device.h"
+
+namespace open3d {
+namespace core {
+
+struct ArenaChunk;
+
+/// \class ScopedArena
+///
+/// Routes all Blob allocations on a device of the current thread into a
+/// bump-pointer arena while the ScopedArena is alive.
+///
+/// The arena requests large chunks from the MemoryManager and serves Blob
+/// allocations by advancing an offset within the current chunk. Freeing a Blob
+/// only decrements the number of live blocks of its chunk. Once a chunk has no
+/// live blocks anymore, it is rewound and reused. All chunks are returned to
+/// the MemoryManager together when the scope exits.
+///
+/// Blobs may outlive the arena, e.g. if they are returned from the scope. In
+/// this case, they keep their whole chunk alive until they are freed, so
+/// long-lived results should be cloned after the scope exits.
+///
+/// Allocations larger than the chunk size, allocations on other devices and
+/// allocations of other threads are not affected.
+///
+/// Example:
+/// ```cpp
+/// for (int i = 0; i < num_iterations; ++i) {
+///     core::ScopedArena arena(device);
+///     // Temporaries of the iteration are allocated from the arena.
+/// }
+/// ```
+class ScopedArena {
+public:
+    /// Default size of the chunks requested from the MemoryManager.
+    static constexpr size_t kDefaultChunkByteSize = size_t(32) << 20;
+
+    /// Alignment of the blocks within a chunk.
+    static constexpr size_t kAlignment = 64;
+
+    /// Activates an arena for allocations on \p device of the current thread.
+    /// Nested arenas shadow the outer ones until they go out of scope.
+    explicit ScopedArena(const Device& device,
+                         size_t chunk_byte_size = kDefaultChunkByteSize);
+
+    /// Deactivates the arena, releases its chunks and adds its usage to the
+    /// MemoryManagerStatistic.
+    ~ScopedArena();
+
+    ScopedArena(const ScopedArena&) = delete;
+    ScopedArena& operator=(const ScopedArena&) = delete;
+
+    /// Allocates \p byte_size bytes from the innermost arena of the current
+    /// thread on \p device and sets \p deleter to release the block. Returns
+    /// nullptr if no arena is active or the block does not fit into a chunk.
+    static void* Malloc(size_t byte_size,
+                        const Device& device,
+                        std::function<void(void*)>& deleter);
+
+    /// Returns the number of blocks allocated from the arena.
+    int64_t GetMallocCount() const { return count_malloc_; }
+
+    /// Returns the high-water mark of the bytes used within the chunks.
+    size_t GetPeakByteSize() const { return peak_byte_size_; }
+
+    /// Returns the total size of the chunks held by the arena.
+    size_t GetReservedByteSize() const;
+
+private:
+    void* MallocBlock(size_t byte_size, std::function<void(void*)>& deleter);
+
+    /// Returns a chunk with at least \p byte_size free bytes.
+    ArenaChunk* GetChunk(size_t byte_size);
+
+    Device device_;
+    size_t chunk_byte_size_;
+
+    /// Chunks referenced by the arena, see ArenaChunk.
+    std::vector<ArenaChunk*> chunks_;
+    size_t current_chunk_idx_ = 0;
+
+    int64_t count_malloc_ = 0;
+    size_t used_byte_size_ = 0;
+    size_t peak_byte_size_ = 0;
+    size_t peak_reserved_byte_size_ = 0;
+};
+
+}  // namespace core
+}  // namespace open3d
@@ -19,11 +19,13 @@
 #include "open3d/core/ShapeUtil.h"
 #include "open3d/core/SizeVector.h"
 #include "open3d/core/TensorCheck.h"
+#include "open3d/core/TensorExpr.h"
 #include "open3d/core/TensorFunction.h"
 #include "open3d/core/TensorKey.h"
 #include "open3d/core/kernel/Arange.h"
 #include "open3d/core/kernel/IndexReduction.h"
 #include "open3d/core/kernel/Kernel.h"
+#include "open3d/core/kernel/Sort.h"
 #include "open3d/core/linalg/Det.h"
 #include "open3d/core/linalg/Inverse.h"
 #include "open3d/core/linalg/LU.h"
@@ -41,6 +43,8 @@ namespace core {
 static DLDataTypeCode DtypeToDLDataTypeCode(const Dtype& dtype) {
     if (dtype == core::Float32) return DLDataTypeCode::kDLFloat;
     if (dtype == core::Float64) return DLDataTypeCode::kDLFloat;
+    if (dtype == core::Float16) return DLDataTypeCode::kDLFloat;
+    if (dtype == core::BFloat16) return DLDataTypeCode::kDLBfloat;
     if (dtype == core::Int8) return DLDataTypeCode::kDLInt;
     if (dtype == core::Int16) return DLDataTypeCode::kDLInt;
     if (dtype == core::Int32) return DLDataTypeCode::kDLInt;
@@ -91,6 +95,8 @@ static Dtype DLDataTypeToDtype(const DLDataType& dltype) {
             break;
         case DLDataTypeCode::kDLFloat:
             switch (dltype.bits) {
+                case 16:
+                    return core::Float16;
                 case 32:
                     return core::Float32;
                 case 64:
@@ -100,6 +106,15 @@ static Dtype DLDataTypeToDtype(const DLDataType& dltype) {
                                       dltype.bits);
             }
             break;
+        case DLDataTypeCode::kDLBfloat:
+            switch (dltype.bits) {
+                case 16:
+                    return core::BFloat16;
+                default:
+                    utility::LogError("Unsupported kDLBfloat bits {}",
+                                      dltype.bits);
+            }
+            break;
         default:
             utility::LogError("Unsupported dtype code {}", dltype.code);
     }
@@ -371,6 +386,52 @@ Tensor Tensor::Empty(const SizeVector& shape,
     return Tensor(shape, dtype, device);
 }
 
+/// Returns the byte range [begin, end) spanned by the elements of \p tensor.
+static std::pair<const char*, const char*> GetByteRange(const Tensor& tensor) {
+    const int64_t element_byte_size = tensor.GetDtype().ByteSize();
+    int64_t begin_offset = 0;
+    int64_t end_offset = 0;
+    for (int64_t i = 0; i < tensor.NumDims(); ++i) {
+        const int64_t extent = (tensor.GetShape(i) - 1) * tensor.GetStride(i);
+        if (extent < 0) {
+            begin_offset += extent;
+        } else {
+            end_offset += extent;
+        }
+    }
+    const char* data_ptr = static_cast<const char*>(tensor.GetDataPtr());
+    return {data_ptr + begin_offset * element_byte_size,
+            data_ptr + (end_offset + 1) * element_byte_size};
+}
+
+bool Tensor::MayShareMemory(const Tensor& other) const {
+    if (NumElements() == 0 || other.NumElements() == 0 ||
+        GetDevice() != other.GetDevice()) {
+        return false;
+    }
+    if (blob_ != nullptr && blob_ == other.blob_) {
+        return true;
+    }
+    const auto range = GetByteRange(*this);
+    const auto other_range = GetByteRange(other);
+    return range.first < other_range.second && other_range.first < range.second;
+}
+
+void Tensor::PrepareOutput(Tensor& out,
+                           const SizeVector& shape,
+                           Dtype dtype,
+                           const Device& device,
+                           const std::vector<Tensor>& inputs) {
+    bool reuse = out.GetShape() == shape && out.GetDtype() == dtype &&
+                 out.GetDevice() == device && out.IsContiguous();
+    for (size_t i = 0; reuse && i < inputs.size(); ++i) {
+        reuse = !out.MayShareMemory(inputs[i]);
+    }
+    if (!reuse) {
+        out = Tensor(shape, dtype, device);
+    }
+}
+
 Tensor Tensor::Zeros(const SizeVector& shape,
                      Dtype dtype,
                      const Device& device) {
@@ -745,6 +806,8 @@ Tensor Tensor::Contiguous() const {
     }
 }
 
+TensorExpr Tensor::Lazy() const { return TensorExpr(*this); }
+
 std::string Tensor::ToString(bool with_suffix,
                              const std::string& indent) const {
     std::ostringstream rc;
@@ -796,6 +859,12 @@ std::string Tensor::ScalarPtrToString(const void* ptr) const {
         str = *static_cast<const unsigned char*>(ptr) ? "True" : "False";
     } else if (dtype_.IsObject()) {
         str = fmt::format("{}", fmt::ptr(ptr));
+    } else if (dtype_ == core::Float16) {
+        str = fmt::format("{}", static_cast<float>(
+                                        *static_cast<const float16_t*>(ptr)));
+    } else if (dtype_ == core::BFloat16) {
+        str = fmt::format("{}", static_cast<float>(
+                                        *static_cast<const bfloat16_t*>(ptr)));
     } else {
         DISPATCH_DTYPE_TO_TEMPLATE(dtype_, [&]() {
             str = fmt::format("{}", *static_cast<const scalar_t*>(ptr));
@@ -892,13 +961,25 @@ Tensor Tensor::IndexGet(const std::vector<Tensor>& index_tensors) const {
         }
     }
 
+    Tensor dst;
+    IndexGet(index_tensors, dst);
+    return dst;
+}
+
+void Tensor::IndexGet(const std::vector<Tensor>& index_tensors,
+                      Tensor& out) const {
+    if (NumDims() == 0) {
+        out = IndexGet(index_tensors);
+        return;
+    }
+
     AdvancedIndexPreprocessor aip(*this, index_tensors);
-    Tensor dst = Tensor(aip.GetOutputShape(), dtype_, GetDevice());
+    std::vector<Tensor> inputs = index_tensors;
+    inputs.push_back(*this);
+    PrepareOutput(out, aip.GetOutputShape(), dtype_, GetDevice(), inputs);
 
-    kernel::IndexGet(aip.GetTensor(), dst, aip.GetIndexTensors(),
+    kernel::IndexGet(aip.GetTensor(), out, aip.GetIndexTensors(),
                      aip.GetIndexedShape(), aip.GetIndexedStrides());
-
-    return dst;
 }
 
 void Tensor::IndexSet(const std::vector<Tensor>& index_tensors,
@@ -942,9 +1023,9 @@ void Tensor::IndexSet(const std::vector<Tensor>& index_tensors,
                     src_tensor.NumElements());
         }
         if (index_tensors[0].IsNonZero()) {
-            DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src_tensor.GetDtype(), [&]() {
-                AsRvalue() = src_tensor.Item<scalar_t>();
-            });
+            DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(
+                    src_tensor.GetDtype(),
+                    [&]() { AsRvalue() = src_tensor.Item<scalar_t>(); });
         }
         return;
     }
@@ -1075,7 +1156,7 @@ Tensor Tensor::Add(const Tensor& value) const {
 
 Tensor Tensor::Add(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         dst_tensor = Add(
                 Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1092,7 +1173,7 @@ Tensor Tensor::Add_(const Tensor& value) {
 }
 
 Tensor Tensor::Add_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         Add_(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
     return *this;
@@ -1111,7 +1192,7 @@ Tensor Tensor::Sub(const Tensor& value) const {
 
 Tensor Tensor::Sub(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         dst_tensor = Sub(
                 Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1128,7 +1209,7 @@ Tensor Tensor::Sub_(const Tensor& value) {
 }
 
 Tensor Tensor::Sub_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         Sub_(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
     return *this;
@@ -1147,7 +1228,7 @@ Tensor Tensor::Mul(const Tensor& value) const {
 
 Tensor Tensor::Mul(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         dst_tensor = Mul(
                 Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1164,7 +1245,7 @@ Tensor Tensor::Mul_(const Tensor& value) {
 }
 
 Tensor Tensor::Mul_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         Mul_(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
     return *this;
@@ -1183,7 +1264,7 @@ Tensor Tensor::Div(const Tensor& value) const {
 
 Tensor Tensor::Div(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         dst_tensor = Div(
                 Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1199,21 +1280,39 @@ Tensor Tensor::Div_(const Tensor& value) {
 }
 
 Tensor Tensor::Div_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         Div_(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
     return *this;
 }
 
 Tensor Tensor::Sum(const SizeVector& dims, bool keepdim) const {
-    Tensor dst(shape_util::ReductionShape(shape_, dims, keepdim), dtype_,
-               GetDevice());
-    kernel::Reduction(*this, dst, dims, keepdim, kernel::ReductionOpCode::Sum);
+    Tensor dst;
+    Sum(dims, keepdim, dst);
     return dst;
 }
 
+void Tensor::Sum(const SizeVector& dims, bool keepdim, Tensor& out) const {
+    PrepareOutput(out, shape_util::ReductionShape(shape_, dims, keepdim),
+                  dtype_, GetDevice(), {*this});
+    kernel::Reduction(*this, out, dims, keepdim, kernel::ReductionOpCode::Sum);
+}
+
 Tensor Tensor::Mean(const SizeVector& dims, bool keepdim) const {
-    AssertTensorDtypes(*this, {Float32, Float64});
+    Tensor dst;
+    Mean(dims, keepdim, dst);
+    return dst;
+}
+
+void Tensor::Mean(const SizeVector& dims, bool keepdim, Tensor& out) const {
+    AssertTensorDtypes(*this, {Float32, Float64, Float16, BFloat16});
+    if (dtype_ == core::Float16 || dtype_ == core::BFloat16) {
+        // Round once, after the division.
+        Tensor mean = To(core::Float32).Mean(dims, keepdim);
+        PrepareOutput(out, mean.GetShape(), dtype_, GetDevice());
+        out.AsRvalue() = mean;
+        return;
+    }
 
     // Following Numpy's semantics, reduction on 0-sized Tensor will result in
     // NaNs and a warning. A straightforward method is used now. Later it can be
@@ -1221,32 +1320,46 @@ Tensor Tensor::Mean(const SizeVector& dims, bool keepdim) const {
     if (NumElements() == 0) {
         utility::LogWarning("Computing mean of 0-sized Tensor.");
     }
-    Tensor sum = Sum(dims, keepdim);
-    double factor = static_cast<double>(sum.NumElements()) / NumElements();
-    return sum * factor;
+    Sum(dims, keepdim, out);
+    out.Mul_(static_cast<double>(out.NumElements()) / NumElements());
 }
 
 Tensor Tensor::Prod(const SizeVector& dims, bool keepdim) const {
-    Tensor dst(shape_util::ReductionShape(shape_, dims, keepdim), dtype_,
-               GetDevice());
-    kernel::Reduction(*this, dst, dims, keepdim, kernel::ReductionOpCode::Prod);
+    Tensor dst;
+    Prod(dims, keepdim, dst);
     return dst;
 }
 
+void Tensor::Prod(const SizeVector& dims, bool keepdim, Tensor& out) const {
+    PrepareOutput(out, shape_util::ReductionShape(shape_, dims, keepdim),
+                  dtype_, GetDevice(), {*this});
+    kernel::Reduction(*this, out, dims, keepdim, kernel::ReductionOpCode::Prod);
+}
+
 Tensor Tensor::Min(const SizeVector& dims, bool keepdim) const {
-    Tensor dst(shape_util::ReductionShape(shape_, dims, keepdim), dtype_,
-               GetDevice());
-    kernel::Reduction(*this, dst, dims, keepdim, kernel::ReductionOpCode::Min);
+    Tensor dst;
+    Min(dims, keepdim, dst);
     return dst;
 }
 
+void Tensor::Min(const SizeVector& dims, bool keepdim, Tensor& out) const {
+    PrepareOutput(out, shape_util::ReductionShape(shape_, dims, keepdim),
+                  dtype_, GetDevice(), {*this});
+    kernel::Reduction(*this, out, dims, keepdim, kernel::ReductionOpCode::Min);
+}
+
 Tensor Tensor::Max(const SizeVector& dims, bool keepdim) const {
-    Tensor dst(shape_util::ReductionShape(shape_, dims, keepdim), dtype_,
-               GetDevice());
-    kernel::Reduction(*this, dst, dims, keepdim, kernel::ReductionOpCode::Max);
+    Tensor dst;
+    Max(dims, keepdim, dst);
     return dst;
 }
 
+void Tensor::Max(const SizeVector& dims, bool keepdim, Tensor& out) const {
+    PrepareOutput(out, shape_util::ReductionShape(shape_, dims, keepdim),
+                  dtype_, GetDevice(), {*this});
+    kernel::Reduction(*this, out, dims, keepdim, kernel::ReductionOpCode::Max);
+}
+
 Tensor Tensor::ArgMin(const SizeVector& dims) const {
     Tensor dst(shape_util::ReductionShape(shape_, dims, false), core::Int64,
                GetDevice());
@@ -1328,7 +1441,7 @@ Tensor Tensor::Abs_() {
 }
 
 Tensor Tensor::IsNan() const {
-    if (dtype_ == core::Float32 || dtype_ == core::Float64) {
+    if (dtype_.GetDtypeCode() == Dtype::DtypeCode::Float) {
         Tensor dst_tensor(shape_, core::Bool, GetDevice());
         kernel::UnaryEW(*this, dst_tensor, kernel::UnaryEWOpCode::IsNan);
         return dst_tensor;
@@ -1338,7 +1451,7 @@ Tensor Tensor::IsNan() const {
 }
 
 Tensor Tensor::IsInf() const {
-    if (dtype_ == core::Float32 || dtype_ == core::Float64) {
+    if (dtype_.GetDtypeCode() == Dtype::DtypeCode::Float) {
         Tensor dst_tensor(shape_, core::Bool, GetDevice());
         kernel::UnaryEW(*this, dst_tensor, kernel::UnaryEWOpCode::IsInf);
         return dst_tensor;
@@ -1348,7 +1461,7 @@ Tensor Tensor::IsInf() const {
 }
 
 Tensor Tensor::IsFinite() const {
-    if (dtype_ == core::Float32 || dtype_ == core::Float64) {
+    if (dtype_.GetDtypeCode() == Dtype::DtypeCode::Float) {
         Tensor dst_tensor(shape_, core::Bool, GetDevice());
         kernel::UnaryEW(*this, dst_tensor, kernel::UnaryEWOpCode::IsFinite);
         return dst_tensor;
@@ -1364,7 +1477,7 @@ Tensor Tensor::Clip(Scalar min_val, Scalar max_val) const {
 
 // TODO: Implement with kernel.
 Tensor Tensor::Clip_(Scalar min_val, Scalar max_val) {
-    DISPATCH_DTYPE_TO_TEMPLATE(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(dtype_, [&]() {
         scalar_t min_val_casted = min_val.To<scalar_t>();
         this->SetItem(TensorKey::IndexTensor(this->Lt(min_val_casted)),
                       Full({}, min_val_casted, dtype_, GetDevice()));
@@ -1430,7 +1543,7 @@ Tensor Tensor::LogicalAnd(const Tensor& value) const {
 
 Tensor Tensor::LogicalAnd(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         dst_tensor = LogicalAnd(
                 Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1445,7 +1558,7 @@ Tensor Tensor::LogicalAnd_(const Tensor& value) {
 }
 
 Tensor Tensor::LogicalAnd_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         LogicalAnd_(
                 Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1464,7 +1577,7 @@ Tensor Tensor::LogicalOr(const Tensor& value) const {
 
 Tensor Tensor::LogicalOr(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         dst_tensor = LogicalOr(
                 Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1479,7 +1592,7 @@ Tensor Tensor::LogicalOr_(const Tensor& value) {
 }
 
 Tensor Tensor::LogicalOr_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         LogicalOr_(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
     return *this;
@@ -1497,7 +1610,7 @@ Tensor Tensor::LogicalXor(const Tensor& value) const {
 
 Tensor Tensor::LogicalXor(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         dst_tensor = LogicalXor(
                 Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1512,7 +1625,7 @@ Tensor Tensor::LogicalXor_(const Tensor& value) {
 }
 
 Tensor Tensor::LogicalXor_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         LogicalXor_(
                 Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1530,7 +1643,7 @@ Tensor Tensor::Gt(const Tensor& value) const {
 
 Tensor Tensor::Gt(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         dst_tensor =
                 Gt(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1545,7 +1658,7 @@ Tensor Tensor::Gt_(const Tensor& value) {
 }
 
 Tensor Tensor::Gt_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         Gt_(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
     return *this;
@@ -1562,7 +1675,7 @@ Tensor Tensor::Lt(const Tensor& value) const {
 
 Tensor Tensor::Lt(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         dst_tensor =
                 Lt(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1577,7 +1690,7 @@ Tensor Tensor::Lt_(const Tensor& value) {
 }
 
 Tensor Tensor::Lt_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         Lt_(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
     return *this;
@@ -1594,7 +1707,7 @@ Tensor Tensor::Ge(const Tensor& value) const {
 
 Tensor Tensor::Ge(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         dst_tensor =
                 Ge(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1609,7 +1722,7 @@ Tensor Tensor::Ge_(const Tensor& value) {
 }
 
 Tensor Tensor::Ge_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         Ge_(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
     return *this;
@@ -1626,7 +1739,7 @@ Tensor Tensor::Le(const Tensor& value) const {
 
 Tensor Tensor::Le(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         dst_tensor =
                 Le(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1641,7 +1754,7 @@ Tensor Tensor::Le_(const Tensor& value) {
 }
 
 Tensor Tensor::Le_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         Le_(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
     return *this;
@@ -1658,7 +1771,7 @@ Tensor Tensor::Eq(const Tensor& value) const {
 
 Tensor Tensor::Eq(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         dst_tensor =
                 Eq(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1673,7 +1786,7 @@ Tensor Tensor::Eq_(const Tensor& value) {
 }
 
 Tensor Tensor::Eq_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         Eq_(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
     return *this;
@@ -1690,7 +1803,7 @@ Tensor Tensor::Ne(const Tensor& value) const {
 
 Tensor Tensor::Ne(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         dst_tensor =
                 Ne(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1705,7 +1818,7 @@ Tensor Tensor::Ne_(const Tensor& value) {
 }
 
 Tensor Tensor::Ne_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         Ne_(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
     return *this;
@@ -1722,6 +1835,38 @@ std::vector<Tensor> Tensor::NonZeroNumpy() const {
 
 Tensor Tensor::NonZero() const { return kernel::NonZero(*this); }
 
+Tensor Tensor::Sort() const { return kernel::Sort(*this); }
+
+Tensor Tensor::ArgSort() const {
+    Tensor indices;
+    kernel::Sort(*this, &indices);
+    return indices;
+}
+
+std::tuple<Tensor, Tensor, Tensor> Tensor::Unique() const {
+    return kernel::Unique(*this);
+}
+
+Tensor Tensor::SegmentSum(const Tensor& row_splits) const {
+    return kernel::SegmentReduce(*this, row_splits,
+                                 kernel::SegmentReductionOpCode::Sum);
+}
+
+Tensor Tensor::SegmentMean(const Tensor& row_splits) const {
+    return kernel::SegmentReduce(*this, row_splits,
+                                 kernel::SegmentReductionOpCode::Mean);
+}
+
+Tensor Tensor::SegmentMin(const Tensor& row_splits) const {
+    return kernel::SegmentReduce(*this, row_splits,
+                                 kernel::SegmentReductionOpCode::Min);
+}
+
+Tensor Tensor::SegmentMax(const Tensor& row_splits) const {
+    return kernel::SegmentReduce(*this, row_splits,
+                                 kernel::SegmentReductionOpCode::Max);
+}
+
 bool Tensor::IsNonZero() const {
     if (shape_.NumElements() != 1) {
         utility::LogError(
@@ -1729,7 +1874,7 @@ bool Tensor::IsNonZero() const {
                 "boolean.");
     }
     bool rc = false;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         rc = Item<scalar_t>() != static_cast<scalar_t>(0);
     });
     return rc;
@@ -1872,6 +2017,12 @@ Tensor Tensor::Matmul(const Tensor& rhs) const {
     return output;
 }
 
+void Tensor::Matmul(const Tensor& rhs, Tensor& out) const {
+    AssertTensorDevice(rhs, GetDevice());
+    AssertTensorDtype(rhs, GetDtype());
+    core::MatmulInto(*this, rhs, out);
+}
+
 Tensor Tensor::Solve(const Tensor& rhs) const {
     AssertTensorDtypes(*this, {Float32, Float64});
     AssertTensorDevice(rhs, GetDevice());
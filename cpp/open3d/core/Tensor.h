@@ -27,6 +27,8 @@
 namespace open3d {
 namespace core {
 
+class TensorExpr;
+
 /// A Tensor is a "view" of a data Blob with shape, stride, data_ptr.
 /// Tensor can also be used to perform numerical operations.
 class Tensor : public IsDevice {
@@ -247,6 +249,18 @@ public:
         return Tensor::Empty(other.shape_, other.dtype_, other.GetDevice());
     }
 
+    /// Makes \p out a contiguous tensor of the given shape, dtype and device.
+    /// The memory of \p out is reused if it already matches and does not
+    /// overlap any of \p inputs, otherwise a new tensor with uninitialized
+    /// values is assigned to \p out. This is how the overloads taking an
+    /// output tensor, e.g. Sum(dims, keepdim, out), write into buffers kept by
+    /// the caller across calls.
+    static void PrepareOutput(Tensor& out,
+                              const SizeVector& shape,
+                              Dtype dtype,
+                              const Device& device,
+                              const std::vector<Tensor>& inputs = {});
+
     /// Create a tensor fill with specified value.
     template <typename T>
     static Tensor Full(const SizeVector& shape,
@@ -565,6 +579,12 @@ public:
     /// https://docs.scipy.org/doc/numpy/reference/arrays.indexing.html
     Tensor IndexGet(const std::vector<Tensor>& index_tensors) const;
 
+    /// \brief Advanced indexing getter writing into \p out, whose memory is
+    /// reused if it is contiguous and has the output shape and dtype. If \p out
+    /// shares memory with this tensor or the indices, a new tensor is assigned
+    /// to it instead.
+    void IndexGet(const std::vector<Tensor>& index_tensors, Tensor& out) const;
+
     /// \brief Advanced indexing getter.
     ///
     /// We use the Numpy advanced indexing semantics, see:
@@ -703,6 +723,16 @@ public:
     /// \param keepdim If true, the reduced dims will be retained as size 1.
     Tensor Max(const SizeVector& dims, bool keepdim = false) const;
 
+    /// Reductions writing into \p out instead of returning a new tensor. The
+    /// memory of \p out is reused if it is contiguous and has the reduced
+    /// shape and the dtype of this tensor, see PrepareOutput(). Reusing \p out
+    /// across the iterations of a loop avoids an allocation per iteration.
+    void Sum(const SizeVector& dims, bool keepdim, Tensor& out) const;
+    void Mean(const SizeVector& dims, bool keepdim, Tensor& out) const;
+    void Prod(const SizeVector& dims, bool keepdim, Tensor& out) const;
+    void Min(const SizeVector& dims, bool keepdim, Tensor& out) const;
+    void Max(const SizeVector& dims, bool keepdim, Tensor& out) const;
+
     /// Returns minimum index of the tensor along the given \p dim. The returned
     /// tensor has dtype int64_t, and has the same shape as original tensor
     /// except that the reduced dimension is removed.
@@ -937,6 +967,36 @@ public:
     /// tensor.
     Tensor NonZero() const;
 
+    /// Sorts the elements of a 1D tensor in ascending order with a parallel
+    /// radix sort. Only CPU tensors are supported.
+    Tensor Sort() const;
+
+    /// Returns the int64 indices that sort a 1D tensor in ascending order.
+    /// The sort is stable, equal elements keep their order.
+    Tensor ArgSort() const;
+
+    /// Find the unique elements of a 1D tensor. Returns a tuple of the sorted
+    /// unique elements, the int64 indices of each element of the tensor in the
+    /// unique elements, and the int64 number of occurrences of each unique
+    /// element. Only CPU tensors are supported.
+    std::tuple<Tensor, Tensor, Tensor> Unique() const;
+
+    /// Sums the rows of the tensor in each segment. Segment i contains rows
+    /// [row_splits[i], row_splits[i + 1]), and row_splits is an int64 tensor
+    /// of shape {num_segments + 1} starting with 0 and ending with the number
+    /// of rows. Returns a tensor of shape {num_segments, ...}, where the rows
+    /// of empty segments are 0. Only CPU tensors are supported.
+    Tensor SegmentSum(const Tensor& row_splits) const;
+
+    /// Averages the rows of the float tensor in each segment, see SegmentSum.
+    Tensor SegmentMean(const Tensor& row_splits) const;
+
+    /// Element-wise minimum of the rows in each segment, see SegmentSum.
+    Tensor SegmentMin(const Tensor& row_splits) const;
+
+    /// Element-wise maximum of the rows in each segment, see SegmentSum.
+    Tensor SegmentMax(const Tensor& row_splits) const;
+
     /// Evaluate a single-element Tensor as a boolean value. This can be used to
     /// implement Tensor.__bool__() in Python, e.g.
     /// ```python
@@ -1019,6 +1079,10 @@ public:
     /// strides and etc.
     bool IsSame(const Tensor& other) const;
 
+    /// Returns true if this tensor and \p other use the same blob or their
+    /// memory ranges overlap, so that writing into one may modify the other.
+    bool MayShareMemory(const Tensor& other) const;
+
     /// Retrieve all values as an std::vector, for debugging and testing
     template <typename T>
     std::vector<T> ToFlatVector() const {
@@ -1041,10 +1105,21 @@ public:
     /// used.
     Tensor Contiguous() const;
 
+    /// Returns a lazily evaluated element-wise expression with this tensor as
+    /// its leaf. Operations on the expression are fused into a single pass
+    /// when TensorExpr::Eval() is called.
+    TensorExpr Lazy() const;
+
     /// Computes matrix multiplication with *this and rhs and returns the
     /// result.
     Tensor Matmul(const Tensor& rhs) const;
 
+    /// Computes matrix multiplication with *this and rhs into \p out, whose
+    /// memory is reused if it is contiguous and has the output shape and
+    /// dtype. If \p out shares memory with *this or rhs, e.g. in
+    /// `a.Matmul(b, b)`, a new tensor is assigned to it instead.
+    void Matmul(const Tensor& rhs, Tensor& out) const;
+
     /// Solves the linear system AX = B with LU decomposition and returns X.
     /// A must be a square matrix.
     Tensor Solve(const Tensor& rhs) const;
@@ -1390,7 +1465,7 @@ inline bool Tensor::Item() const {
 
 template <typename S>
 inline void Tensor::Fill(S v) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(GetDtype(), [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(GetDtype(), [&]() {
         scalar_t casted_v = static_cast<scalar_t>(v);
         Tensor tmp(std::vector<scalar_t>({casted_v}), SizeVector({}),
                    GetDtype(), GetDevice());
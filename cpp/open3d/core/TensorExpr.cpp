@@ -0,0 +1,383 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/TensorExpr.h"
+
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/Indexer.h"
+#include "open3d/core/ShapeUtil.h"
+#include "open3d/core/kernel/BinaryEW.h"
+#include "open3d/core/kernel/FusedEW.h"
+#include "open3d/core/kernel/UnaryEW.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+
+using kernel::BinaryEWOpCode;
+using kernel::FusedEWInstruction;
+using kernel::FusedEWInstructionType;
+using kernel::UnaryEWOpCode;
+
+struct TensorExpr::Node {
+    FusedEWInstructionType type_ = FusedEWInstructionType::Input;
+
+    /// Leaf tensor of Input nodes.
+    Tensor tensor_;
+
+    /// Value of Constant nodes.
+    Scalar constant_ = Scalar(0);
+
+    UnaryEWOpCode unary_op_code_ = UnaryEWOpCode::Neg;
+    BinaryEWOpCode binary_op_code_ = BinaryEWOpCode::Add;
+    std::shared_ptr<const Node> lhs_;
+    std::shared_ptr<const Node> rhs_;
+
+    SizeVector shape_;
+    Dtype dtype_ = core::Undefined;
+    Device device_;
+};
+
+namespace {
+
+using Node = TensorExpr::Node;
+
+std::shared_ptr<const Node> MakeConstant(Scalar value, const Node& like) {
+    auto node = std::make_shared<Node>();
+    node->type_ = FusedEWInstructionType::Constant;
+    node->constant_ = value;
+    node->shape_ = {};
+    node->dtype_ = like.dtype_;
+    node->device_ = like.device_;
+    return node;
+}
+
+void AssertFloatDtype(Dtype dtype) {
+    if (dtype.GetDtypeCode() != Dtype::DtypeCode::Float) {
+        utility::LogError(
+                "Only supports floating point dtypes, but {} is used.",
+                dtype.ToString());
+    }
+}
+
+std::shared_ptr<const Node> MakeUnary(const std::shared_ptr<const Node>& src,
+                                      UnaryEWOpCode op_code) {
+    const bool is_boolean_op = op_code == UnaryEWOpCode::IsNan ||
+                               op_code == UnaryEWOpCode::IsInf ||
+                               op_code == UnaryEWOpCode::IsFinite ||
+                               op_code == UnaryEWOpCode::LogicalNot;
+    if (op_code != UnaryEWOpCode::LogicalNot && src->dtype_ == core::Bool) {
+        utility::LogError("Unsupported data type {} for unary op.",
+                          src->dtype_.ToString());
+    }
+    if (op_code == UnaryEWOpCode::Sqrt || op_code == UnaryEWOpCode::Sin ||
+        op_code == UnaryEWOpCode::Cos || op_code == UnaryEWOpCode::Exp ||
+        op_code == UnaryEWOpCode::IsNan || op_code == UnaryEWOpCode::IsInf ||
+        op_code == UnaryEWOpCode::IsFinite) {
+        AssertFloatDtype(src->dtype_);
+    }
+
+    auto node = std::make_shared<Node>();
+    node->type_ = FusedEWInstructionType::Unary;
+    node->unary_op_code_ = op_code;
+    node->lhs_ = src;
+    node->shape_ = src->shape_;
+    node->dtype_ = is_boolean_op ? core::Bool : src->dtype_;
+    node->device_ = src->device_;
+    return node;
+}
+
+std::shared_ptr<const Node> MakeBinary(const std::shared_ptr<const Node>& lhs,
+                                       const std::shared_ptr<const Node>& rhs,
+                                       BinaryEWOpCode op_code) {
+    if (lhs->device_ != rhs->device_) {
+        utility::LogError("Tensor has device {}, but is expected to be {}.",
+                          rhs->device_.ToString(), lhs->device_.ToString());
+    }
+    if (lhs->dtype_ != rhs->dtype_) {
+        utility::LogError("Tensor has dtype {}, but is expected to be {}.",
+                          rhs->dtype_.ToString(), lhs->dtype_.ToString());
+    }
+    const bool is_boolean_op =
+            kernel::s_boolean_binary_ew_op_codes.count(op_code) != 0;
+    const bool is_arithmetic_op =
+            op_code == BinaryEWOpCode::Add || op_code == BinaryEWOpCode::Sub ||
+            op_code == BinaryEWOpCode::Mul || op_code == BinaryEWOpCode::Div;
+    if (is_arithmetic_op && lhs->dtype_ == core::Bool) {
+        utility::LogError("Unsupported data type {} for arithmetic op.",
+                          lhs->dtype_.ToString());
+    }
+
+    auto node = std::make_shared<Node>();
+    node->type_ = FusedEWInstructionType::Binary;
+    node->binary_op_code_ = op_code;
+    node->lhs_ = lhs;
+    node->rhs_ = rhs;
+    node->shape_ = shape_util::BroadcastedShape(lhs->shape_, rhs->shape_);
+    node->dtype_ = is_boolean_op ? core::Bool : lhs->dtype_;
+    node->device_ = lhs->device_;
+    return node;
+}
+
+/// Flattened expression tree. Shared sub-expressions and repeated leaf tensors
+/// are emitted once.
+struct Program {
+    std::vector<Tensor> inputs_;
+    std::vector<FusedEWInstruction> instructions_;
+};
+
+class ProgramBuilder {
+public:
+    Program Build(const Node& root) {
+        Emit(root);
+        return std::move(program_);
+    }
+
+private:
+    int64_t Emit(const Node& node) {
+        auto it = node_indices_.find(&node);
+        if (it != node_indices_.end()) {
+            return it->second;
+        }
+
+        FusedEWInstruction instruction;
+        instruction.type_ = node.type_;
+        instruction.dtype_ = node.dtype_;
+        switch (node.type_) {
+            case FusedEWInstructionType::Input:
+                instruction.input_idx_ = GetInputIndex(node.tensor_);
+                break;
+            case FusedEWInstructionType::Constant:
+                instruction.constant_ = node.constant_;
+                break;
+            case FusedEWInstructionType::Unary:
+                instruction.unary_op_code_ = node.unary_op_code_;
+                instruction.lhs_ = Emit(*node.lhs_);
+                break;
+            case FusedEWInstructionType::Binary:
+                instruction.binary_op_code_ = node.binary_op_code_;
+                instruction.lhs_ = Emit(*node.lhs_);
+                instruction.rhs_ = Emit(*node.rhs_);
+                break;
+        }
+
+        const int64_t idx = static_cast<int64_t>(program_.instructions_.size());
+        program_.instructions_.push_back(instruction);
+        node_indices_[&node] = idx;
+        return idx;
+    }
+
+    int64_t GetInputIndex(const Tensor& tensor) {
+        for (size_t i = 0; i < program_.inputs_.size(); ++i) {
+            const Tensor& input = program_.inputs_[i];
+            if (input.GetDataPtr() == tensor.GetDataPtr() &&
+                input.GetShape() == tensor.GetShape() &&
+                input.GetStrides() == tensor.GetStrides() &&
+                input.GetDtype() == tensor.GetDtype()) {
+                return static_cast<int64_t>(i);
+            }
+        }
+        program_.inputs_.push_back(tensor);
+        return static_cast<int64_t>(program_.inputs_.size()) - 1;
+    }
+
+    Program program_;
+    std::unordered_map<const Node*, int64_t> node_indices_;
+};
+
+/// Returns the dtype shared by all non-boolean inputs, Bool if all inputs are
+/// boolean and Undefined if the inputs have several non-boolean dtypes.
+Dtype GetComputeDtype(const std::vector<Tensor>& inputs) {
+    Dtype compute_dtype = core::Bool;
+    for (const Tensor& input : inputs) {
+        if (input.GetDtype() == core::Bool) {
+            continue;
+        }
+        if (compute_dtype == core::Bool) {
+            compute_dtype = input.GetDtype();
+        } else if (compute_dtype != input.GetDtype()) {
+            return core::Undefined;
+        }
+    }
+    return compute_dtype;
+}
+
+/// Evaluates the program instruction by instruction with the eager kernels.
+Tensor EvalEager(const Program& program, const Device& device) {
+    std::vector<Tensor> values;
+    values.reserve(program.instructions_.size());
+    for (const FusedEWInstruction& instruction : program.instructions_) {
+        switch (instruction.type_) {
+            case FusedEWInstructionType::Input:
+                values.push_back(program.inputs_[instruction.input_idx_]);
+                break;
+            case FusedEWInstructionType::Constant:
+                DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(
+                        instruction.dtype_, [&]() {
+                            values.push_back(Tensor::Full(
+                                    {}, instruction.constant_.To<scalar_t>(),
+                                    instruction.dtype_, device));
+                        });
+                break;
+            case FusedEWInstructionType::Unary: {
+                const Tensor& src = values[instruction.lhs_];
+                Tensor dst(src.GetShape(), instruction.dtype_, device);
+                kernel::UnaryEW(src, dst, instruction.unary_op_code_);
+                values.push_back(dst);
+                break;
+            }
+            case FusedEWInstructionType::Binary: {
+                const Tensor& lhs = values[instruction.lhs_];
+                const Tensor& rhs = values[instruction.rhs_];
+                Tensor dst(shape_util::BroadcastedShape(lhs.GetShape(),
+                                                        rhs.GetShape()),
+                           instruction.dtype_, device);
+                kernel::BinaryEW(lhs, rhs, dst, instruction.binary_op_code_);
+                values.push_back(dst);
+                break;
+            }
+        }
+    }
+    return values.back();
+}
+
+}  // namespace
+
+TensorExpr::TensorExpr(const Tensor& tensor) {
+    auto node = std::make_shared<Node>();
+    node->type_ = FusedEWInstructionType::Input;
+    node->tensor_ = tensor;
+    node->shape_ = tensor.GetShape();
+    node->dtype_ = tensor.GetDtype();
+    node->device_ = tensor.GetDevice();
+    node_ = node;
+}
+
+TensorExpr::TensorExpr(std::shared_ptr<const Node> node)
+    : node_(std::move(node)) {}
+
+#define OPEN3D_TENSOR_EXPR_BINARY(NAME)                                    \
+    TensorExpr TensorExpr::NAME(const TensorExpr& value) const {           \
+        return TensorExpr(                                                 \
+                MakeBinary(node_, value.node_, BinaryEWOpCode::NAME));     \
+    }                                                                      \
+    TensorExpr TensorExpr::NAME(Scalar value) const {                      \
+        return TensorExpr(MakeBinary(node_, MakeConstant(value, *node_),   \
+                                     BinaryEWOpCode::NAME));               \
+    }
+
+OPEN3D_TENSOR_EXPR_BINARY(Add)
+OPEN3D_TENSOR_EXPR_BINARY(Sub)
+OPEN3D_TENSOR_EXPR_BINARY(Mul)
+OPEN3D_TENSOR_EXPR_BINARY(Div)
+OPEN3D_TENSOR_EXPR_BINARY(Maximum)
+OPEN3D_TENSOR_EXPR_BINARY(Minimum)
+OPEN3D_TENSOR_EXPR_BINARY(LogicalAnd)
+OPEN3D_TENSOR_EXPR_BINARY(LogicalOr)
+OPEN3D_TENSOR_EXPR_BINARY(LogicalXor)
+OPEN3D_TENSOR_EXPR_BINARY(Gt)
+OPEN3D_TENSOR_EXPR_BINARY(Lt)
+OPEN3D_TENSOR_EXPR_BINARY(Ge)
+OPEN3D_TENSOR_EXPR_BINARY(Le)
+OPEN3D_TENSOR_EXPR_BINARY(Eq)
+OPEN3D_TENSOR_EXPR_BINARY(Ne)
+
+#undef OPEN3D_TENSOR_EXPR_BINARY
+
+#define OPEN3D_TENSOR_EXPR_UNARY(NAME)                             \
+    TensorExpr TensorExpr::NAME() const {                          \
+        return TensorExpr(MakeUnary(node_, UnaryEWOpCode::NAME));  \
+    }
+
+OPEN3D_TENSOR_EXPR_UNARY(Sqrt)
+OPEN3D_TENSOR_EXPR_UNARY(Sin)
+OPEN3D_TENSOR_EXPR_UNARY(Cos)
+OPEN3D_TENSOR_EXPR_UNARY(Neg)
+OPEN3D_TENSOR_EXPR_UNARY(Exp)
+OPEN3D_TENSOR_EXPR_UNARY(Abs)
+OPEN3D_TENSOR_EXPR_UNARY(Floor)
+OPEN3D_TENSOR_EXPR_UNARY(Ceil)
+OPEN3D_TENSOR_EXPR_UNARY(Round)
+OPEN3D_TENSOR_EXPR_UNARY(Trunc)
+OPEN3D_TENSOR_EXPR_UNARY(LogicalNot)
+
+#undef OPEN3D_TENSOR_EXPR_UNARY
+
+// Like Tensor::IsNan, IsInf and IsFinite, non-float values are never NaN or
+// infinite. Comparing the value to itself yields the constant result with the
+// right shape.
+TensorExpr TensorExpr::IsNan() const {
+    if (node_->dtype_.GetDtypeCode() == Dtype::DtypeCode::Float) {
+        return TensorExpr(MakeUnary(node_, UnaryEWOpCode::IsNan));
+    }
+    return Ne(*this);
+}
+
+TensorExpr TensorExpr::IsInf() const {
+    if (node_->dtype_.GetDtypeCode() == Dtype::DtypeCode::Float) {
+        return TensorExpr(MakeUnary(node_, UnaryEWOpCode::IsInf));
+    }
+    return Ne(*this);
+}
+
+TensorExpr TensorExpr::IsFinite() const {
+    if (node_->dtype_.GetDtypeCode() == Dtype::DtypeCode::Float) {
+        return TensorExpr(MakeUnary(node_, UnaryEWOpCode::IsFinite));
+    }
+    return Eq(*this);
+}
+
+TensorExpr operator+(Scalar scalar_lhs, const TensorExpr& rhs) {
+    return rhs.Add(scalar_lhs);
+}
+
+TensorExpr operator-(Scalar scalar_lhs, const TensorExpr& rhs) {
+    return TensorExpr(MakeBinary(MakeConstant(scalar_lhs, *rhs.node_),
+                                 rhs.node_, BinaryEWOpCode::Sub));
+}
+
+TensorExpr operator*(Scalar scalar_lhs, const TensorExpr& rhs) {
+    return rhs.Mul(scalar_lhs);
+}
+
+TensorExpr operator/(Scalar scalar_lhs, const TensorExpr& rhs) {
+    return TensorExpr(MakeBinary(MakeConstant(scalar_lhs, *rhs.node_),
+                                 rhs.node_, BinaryEWOpCode::Div));
+}
+
+SizeVector TensorExpr::GetShape() const { return node_->shape_; }
+
+Dtype TensorExpr::GetDtype() const { return node_->dtype_; }
+
+Device TensorExpr::GetDevice() const { return node_->device_; }
+
+Tensor TensorExpr::Eval() const {
+    if (node_->type_ == FusedEWInstructionType::Input) {
+        return node_->tensor_;
+    }
+
+    Program program = ProgramBuilder().Build(*node_);
+    const Dtype compute_dtype = GetComputeDtype(program.inputs_);
+    // Half precision inputs are evaluated eagerly, which computes in Float32.
+    const bool is_half = compute_dtype == core::Float16 ||
+                         compute_dtype == core::BFloat16;
+    if (node_->device_.IsCPU() && compute_dtype != core::Undefined &&
+        !is_half && program.inputs_.size() <= MAX_INPUTS) {
+        Tensor dst(node_->shape_, node_->dtype_, node_->device_);
+        kernel::FusedEWCPU(program.inputs_, program.instructions_,
+                           compute_dtype, dst);
+        return dst;
+    }
+    return EvalEager(program, node_->device_);
+}
+
+}  // namespace core
+}  // namespace open3d
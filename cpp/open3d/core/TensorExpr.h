@@ -0,0 +1,141 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Scalar.h"
+#include "open3d/core/SizeVector.h"
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+
+/// \class TensorExpr
+///
+/// Lazily evaluated element-wise expression over tensors.
+///
+/// Building a TensorExpr only records the operations. The shapes, dtypes and
+/// devices are checked in the same way as the corresponding Tensor operations,
+/// but no memory is allocated and no kernel is launched. Eval() compiles the
+/// expression tree into a single element-wise program and evaluates it in one
+/// pass over the output, so the intermediate results never materialize in
+/// memory.
+///
+/// Fused evaluation is implemented for CPU tensors. On other devices, for
+/// expressions with more than Indexer's maximum number of inputs, for half
+/// precision inputs, or when the inputs have several non-boolean dtypes, Eval()
+/// falls back to evaluating the operations one by one with the eager kernels.
+/// The results are identical in all cases.
+///
+/// Example:
+/// ```cpp
+/// // One pass over a, b, w and c instead of four.
+/// core::Tensor r = ((a.Lazy() - b) * w + c).Abs().Eval();
+/// ```
+class TensorExpr {
+public:
+    /// Wraps a tensor as a leaf of an expression.
+    TensorExpr(const Tensor& tensor);
+
+    TensorExpr Add(const TensorExpr& value) const;
+    TensorExpr Add(Scalar value) const;
+    TensorExpr Sub(const TensorExpr& value) const;
+    TensorExpr Sub(Scalar value) const;
+    TensorExpr Mul(const TensorExpr& value) const;
+    TensorExpr Mul(Scalar value) const;
+    TensorExpr Div(const TensorExpr& value) const;
+    TensorExpr Div(Scalar value) const;
+    TensorExpr Maximum(const TensorExpr& value) const;
+    TensorExpr Maximum(Scalar value) const;
+    TensorExpr Minimum(const TensorExpr& value) const;
+    TensorExpr Minimum(Scalar value) const;
+
+    /// Boolean operations. The result has dtype Bool.
+    TensorExpr LogicalAnd(const TensorExpr& value) const;
+    TensorExpr LogicalAnd(Scalar value) const;
+    TensorExpr LogicalOr(const TensorExpr& value) const;
+    TensorExpr LogicalOr(Scalar value) const;
+    TensorExpr LogicalXor(const TensorExpr& value) const;
+    TensorExpr LogicalXor(Scalar value) const;
+    TensorExpr Gt(const TensorExpr& value) const;
+    TensorExpr Gt(Scalar value) const;
+    TensorExpr Lt(const TensorExpr& value) const;
+    TensorExpr Lt(Scalar value) const;
+    TensorExpr Ge(const TensorExpr& value) const;
+    TensorExpr Ge(Scalar value) const;
+    TensorExpr Le(const TensorExpr& value) const;
+    TensorExpr Le(Scalar value) const;
+    TensorExpr Eq(const TensorExpr& value) const;
+    TensorExpr Eq(Scalar value) const;
+    TensorExpr Ne(const TensorExpr& value) const;
+    TensorExpr Ne(Scalar value) const;
+
+    TensorExpr Sqrt() const;
+    TensorExpr Sin() const;
+    TensorExpr Cos() const;
+    TensorExpr Neg() const;
+    TensorExpr Exp() const;
+    TensorExpr Abs() const;
+    TensorExpr Floor() const;
+    TensorExpr Ceil() const;
+    TensorExpr Round() const;
+    TensorExpr Trunc() const;
+
+    /// Boolean unary operations. The result has dtype Bool.
+    TensorExpr IsNan() const;
+    TensorExpr IsInf() const;
+    TensorExpr IsFinite() const;
+    TensorExpr LogicalNot() const;
+
+    // The Tensor overloads take precedence over the scalar operators of
+    // Tensor.h, which would otherwise match a Tensor right-hand side exactly.
+    TensorExpr operator+(const TensorExpr& value) const { return Add(value); }
+    TensorExpr operator+(const Tensor& value) const { return Add(value); }
+    TensorExpr operator+(Scalar value) const { return Add(value); }
+    TensorExpr operator-(const TensorExpr& value) const { return Sub(value); }
+    TensorExpr operator-(const Tensor& value) const { return Sub(value); }
+    TensorExpr operator-(Scalar value) const { return Sub(value); }
+    TensorExpr operator*(const TensorExpr& value) const { return Mul(value); }
+    TensorExpr operator*(const Tensor& value) const { return Mul(value); }
+    TensorExpr operator*(Scalar value) const { return Mul(value); }
+    TensorExpr operator/(const TensorExpr& value) const { return Div(value); }
+    TensorExpr operator/(const Tensor& value) const { return Div(value); }
+    TensorExpr operator/(Scalar value) const { return Div(value); }
+    TensorExpr operator-() const { return Neg(); }
+
+    friend TensorExpr operator+(Scalar scalar_lhs, const TensorExpr& rhs);
+    friend TensorExpr operator-(Scalar scalar_lhs, const TensorExpr& rhs);
+    friend TensorExpr operator*(Scalar scalar_lhs, const TensorExpr& rhs);
+    friend TensorExpr operator/(Scalar scalar_lhs, const TensorExpr& rhs);
+
+    /// Shape of the result after broadcasting.
+    SizeVector GetShape() const;
+
+    /// Dtype of the result.
+    Dtype GetDtype() const;
+
+    /// Device of the result.
+    Device GetDevice() const;
+
+    /// Evaluates the expression into a new contiguous tensor. If the
+    /// expression is a single leaf, the leaf tensor is returned.
+    Tensor Eval() const;
+
+    struct Node;
+
+private:
+    explicit TensorExpr(std::shared_ptr<const Node> node);
+
+    std::shared_ptr<const Node> node_;
+};
+
+}  // namespace core
+}  // namespace open3d
@@ -12,8 +12,9 @@
 namespace open3d {
 namespace core {
 
-static Tensor ConcatenateImpl(const std::vector<Tensor>& tensors,
-                              const int64_t axis) {
+static void ConcatenateImpl(const std::vector<Tensor>& tensors,
+                            const int64_t axis,
+                            Tensor& out) {
     const int num_tensors = tensors.size();
     const int64_t num_dims = tensors[0].NumDims();
     const int64_t axis_d = shape_util::WrapDim(axis, num_dims);
@@ -56,7 +57,7 @@ static Tensor ConcatenateImpl(const std::vector<Tensor>& tensors,
         common_tks.push_back(TensorKey::Slice(0, combined_shape[i], 1));
     }
 
-    Tensor combined_tensor(combined_shape, dtype, device);
+    Tensor::PrepareOutput(out, combined_shape, dtype, device, tensors);
 
     // Cumulate length along `axis`.
     int64_t cumulated_length = 0;
@@ -70,14 +71,20 @@ static Tensor ConcatenateImpl(const std::vector<Tensor>& tensors,
 
         cumulated_length += local_length;
 
-        combined_tensor.SetItem(local_tks, tensors[i]);
+        out.SetItem(local_tks, tensors[i]);
     }
-
-    return combined_tensor;
 }
 
 Tensor Concatenate(const std::vector<Tensor>& tensors,
                    const utility::optional<int64_t>& axis) {
+    Tensor output;
+    Concatenate(tensors, axis, output);
+    return output;
+}
+
+void Concatenate(const std::vector<Tensor>& tensors,
+                 const utility::optional<int64_t>& axis,
+                 Tensor& out) {
     const int num_tensors = tensors.size();
 
     if (num_tensors < 1) {
@@ -91,18 +98,25 @@ Tensor Concatenate(const std::vector<Tensor>& tensors,
             split_tensors.push_back(tensors[0][i]);
         }
 
-        return Concatenate(split_tensors, axis);
+        Concatenate(split_tensors, axis, out);
+        return;
     }
 
     if (!axis.has_value()) {
         std::vector<Tensor> flattened_tensors;
+        int64_t num_elements = 0;
         for (int i = 0; i < num_tensors; ++i) {
             // TODO: Implement Tensor::FlattenTensor
             flattened_tensors.push_back(
                     tensors[i].Reshape({tensors[i].NumElements(), 1}));
+            num_elements += tensors[i].NumElements();
         }
 
-        return ConcatenateImpl(flattened_tensors, 0).Reshape({-1});
+        // The flattened tensors are written through a 2D view of out.
+        Tensor::PrepareOutput(out, {num_elements}, tensors[0].GetDtype(),
+                              tensors[0].GetDevice(), tensors);
+        Tensor out_2d = out.Reshape({num_elements, 1});
+        ConcatenateImpl(flattened_tensors, 0, out_2d);
     } else {
         if (tensors[0].NumDims() == 0) {
             utility::LogError(
@@ -111,7 +125,7 @@ Tensor Concatenate(const std::vector<Tensor>& tensors,
                     axis.value());
         }
 
-        return ConcatenateImpl(tensors, axis.value());
+        ConcatenateImpl(tensors, axis.value(), out);
     }
 }
 
@@ -55,6 +55,14 @@ namespace core {
 Tensor Concatenate(const std::vector<Tensor>& tensors,
                    const utility::optional<int64_t>& axis = 0);
 
+/// \brief Concatenates the list of tensors into \p out, whose memory is
+/// reused if it is contiguous and has the concatenated shape and dtype, see
+/// Tensor::PrepareOutput(). If \p out shares memory with one of the inputs, a
+/// new tensor is assigned to it instead.
+void Concatenate(const std::vector<Tensor>& tensors,
+                 const utility::optional<int64_t>& axis,
+                 Tensor& out);
+
 /// \brief Appends the two tensors, along the given axis into a new tensor.
 /// Both the tensors must have same data-type, device, and number of
 /// dimensions. All dimensions must be the same, except the dimension along
@@ -0,0 +1,849 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include "open3d/core/ParallelFor.h"
+#include "open3d/core/hashmap/CPU/CPUHashBackendBufferAccessor.hpp"
+#include "open3d/core/hashmap/DeviceHashBackend.h"
+
+namespace open3d {
+namespace core {
+
+/// Zero-initialized array of 64-bit atomics. The memory comes from calloc,
+/// so that the pages of large arrays are only cleared when first used, i.e.
+/// spread over the operations after a growth rather than in the growth.
+struct AtomicUInt64Array {
+    explicit AtomicUInt64Array(int64_t size)
+        : size_(size),
+          data_(static_cast<std::atomic<uint64_t>*>(
+                  std::calloc(std::max(size, int64_t(1)),
+                              sizeof(std::atomic<uint64_t>)))) {
+        if (!data_) {
+            utility::LogError("Failed to allocate {} slots.", size);
+        }
+    }
+
+    /// Starts with the values of the smaller array \p prefix.
+    AtomicUInt64Array(int64_t size, const AtomicUInt64Array& prefix)
+        : AtomicUInt64Array(size) {
+        std::memcpy(static_cast<void*>(data_.get()),
+                    static_cast<const void*>(prefix.data_.get()),
+                    prefix.size_ * sizeof(std::atomic<uint64_t>));
+    }
+
+    std::atomic<uint64_t>& operator[](int64_t i) const {
+        return data_.get()[i];
+    }
+
+    struct Deleter {
+        void operator()(std::atomic<uint64_t>* ptr) const { std::free(ptr); }
+    };
+
+    int64_t size_;
+    std::unique_ptr<std::atomic<uint64_t>, Deleter> data_;
+};
+
+/// Slots and key/value buffer of an OpenAddressingHashBackend. The backend
+/// modifies its state in place and publishes copies of it for snapshots, which
+/// share the slot tables and buffers with the backend.
+///
+/// The table is an array of 64-bit slots. A slot is empty, busy (an insertion
+/// is in progress), erased, or holds an entry made of a 32-bit tag from the
+/// hash of the key and the buffer index of the key/value pair. A probe walks
+/// consecutive slots, eight per cache line, and only reads the key from the
+/// buffer when the tags match.
+///
+/// After a growth, the entries of the previous table are moved to the current
+/// table in batches. The migration leaves the previous table unchanged, probes
+/// skip its slots before num_migrated_ instead.
+template <typename Key, typename Hash, typename Eq>
+struct OpenAddressingHashState {
+    static constexpr uint64_t kEmpty = 0;
+    static constexpr uint64_t kBusy = 1;
+    static constexpr uint64_t kErased = 2;
+
+    /// Epoch of the backend itself, which sees all entries.
+    static constexpr uint64_t kLatestEpoch =
+            std::numeric_limits<uint64_t>::max();
+
+    /// Mixes the bits of the key hash, so that the low bits used for the slot
+    /// position depend on all bits of the key.
+    static uint64_t HashKey(const Key& key) {
+        uint64_t h = Hash()(key);
+        h ^= h >> 33;
+        h *= UINT64_C(0xff51afd7ed558ccd);
+        h ^= h >> 33;
+        h *= UINT64_C(0xc4ceb9fe1a85ec53);
+        h ^= h >> 33;
+        return h;
+    }
+
+    /// The tag has its highest bit set, so that entries never collide with
+    /// the special slot values.
+    static uint64_t MakeEntry(uint64_t hash, buf_index_t buf_index) {
+        const uint64_t tag = (hash >> 32) | UINT64_C(0x80000000);
+        return (tag << 32) | buf_index;
+    }
+
+    static bool IsEntry(uint64_t slot) { return slot > kErased; }
+
+    static bool TagMatches(uint64_t slot, uint64_t hash) {
+        return (slot >> 32) == ((hash >> 32) | UINT64_C(0x80000000));
+    }
+
+    static buf_index_t GetBufIndex(uint64_t slot) {
+        return static_cast<buf_index_t>(slot & UINT64_C(0xffffffff));
+    }
+
+    const Key& GetKey(buf_index_t buf_index) const {
+        return *static_cast<const Key*>(
+                buffer_accessor_->GetKeyPtr(buf_index));
+    }
+
+    /// Returns true if \p slot holds an entry inserted before epoch_.
+    /// A growth that needs no more slots keeps the table shared with the
+    /// snapshots, so it may hold buffer indices beyond their capacity_, which
+    /// were inserted after them.
+    bool IsVisible(uint64_t slot) const {
+        if (!IsEntry(slot)) {
+            return false;
+        }
+        if (epoch_ == kLatestEpoch) {
+            return true;
+        }
+        const buf_index_t buf_index = GetBufIndex(slot);
+        return static_cast<int64_t>(buf_index) < capacity_ &&
+               (*epochs_)[buf_index].load(std::memory_order_relaxed) < epoch_;
+    }
+
+    /// Returns the position of \p key in \p table, or -1 if not found.
+    /// Positions before \p num_skipped are treated as erased. Busy slots hold
+    /// keys that are not inserted yet, so probes do not wait for them.
+    int64_t FindSlot(const AtomicUInt64Array& table,
+                     int64_t num_skipped,
+                     const Key& key,
+                     uint64_t hash) const {
+        const uint64_t mask = static_cast<uint64_t>(table.size_ - 1);
+        for (uint64_t pos = hash & mask;; pos = (pos + 1) & mask) {
+            const uint64_t slot = table[pos].load(std::memory_order_acquire);
+            if (slot == kEmpty) {
+                return -1;
+            }
+            if (static_cast<int64_t>(pos) >= num_skipped && IsVisible(slot) &&
+                TagMatches(slot, hash) &&
+                Eq()(GetKey(GetBufIndex(slot)), key)) {
+                return static_cast<int64_t>(pos);
+            }
+        }
+    }
+
+    /// Looks up \p key in the current table, then in the previous one. Returns
+    /// the slot of the entry, or nullptr if not found.
+    std::atomic<uint64_t>* Find(const Key& key,
+                                uint64_t hash,
+                                bool* in_current = nullptr) const {
+        int64_t pos = FindSlot(*slots_, 0, key, hash);
+        if (in_current != nullptr) {
+            *in_current = pos >= 0;
+        }
+        if (pos >= 0) {
+            return &(*slots_)[pos];
+        }
+        if (old_slots_) {
+            pos = FindSlot(*old_slots_, num_migrated_, key, hash);
+            if (pos >= 0) {
+                return &(*old_slots_)[pos];
+            }
+        }
+        return nullptr;
+    }
+
+    /// Number of slots of the previous table that are not migrated yet.
+    int64_t NumOldSlots() const {
+        return old_slots_ ? old_slots_->size_ - num_migrated_ : 0;
+    }
+
+    /// Writes the buffer indices of the visible entries and returns their
+    /// number.
+    int64_t GetActiveIndices(const Device& device,
+                             buf_index_t* output_buf_indices) const;
+
+    std::shared_ptr<AtomicUInt64Array> slots_;
+    std::shared_ptr<AtomicUInt64Array> old_slots_;
+    int64_t num_migrated_ = 0;
+
+    std::shared_ptr<HashBackendBuffer> buffer_;
+    std::shared_ptr<CPUHashBackendBufferAccessor> buffer_accessor_;
+
+    /// Epoch of the insertion of each buffer index. Only the entries inserted
+    /// before epoch_ are visible.
+    std::shared_ptr<AtomicUInt64Array> epochs_;
+    uint64_t epoch_ = kLatestEpoch;
+
+    int64_t size_ = 0;
+    int64_t capacity_ = 0;
+
+    /// Number of Erase and Clear calls that removed entries, shared by the
+    /// backend and its snapshots. Removals modify the slots and reuse buffer
+    /// indices in place, so they invalidate the snapshots taken before.
+    std::shared_ptr<std::atomic<int64_t>> num_removals_;
+    /// Value of num_removals_ when the state was published.
+    int64_t published_num_removals_ = 0;
+};
+
+/// Flat concurrent hash table with linear probing for fixed-size keys, see
+/// OpenAddressingHashState for the layout. Insert, Find, Erase and
+/// GetActiveIndices are all parallel and lock-free, except that concurrent
+/// insertions of the same key wait for each other.
+///
+/// Erased slots are kept as tombstones until the next Insert that would fill
+/// the table beyond its maximum load, which rebuilds the table.
+///
+/// The table grows incrementally (GrowInPlace): the key/value buffer is copied
+/// with the buffer indices unchanged and a larger table is allocated, while
+/// the entries of the previous table are moved to it in batches at the start
+/// of the following operations. Until then, lookups probe both tables.
+///
+/// Snapshots (GetSnapshot) see the entries inserted by the Insert calls that
+/// completed before they were taken, and may be read while further entries are
+/// inserted. Tables and buffers are only freed when no snapshot refers to them.
+/// Erase and Clear modify them in place, so the snapshots taken before an
+/// Erase or Clear that removed entries raise an error when they are read.
+template <typename Key, typename Hash, typename Eq>
+class OpenAddressingHashBackend : public DeviceHashBackend {
+public:
+    using State = OpenAddressingHashState<Key, Hash, Eq>;
+
+    OpenAddressingHashBackend(int64_t init_capacity,
+                              int64_t key_dsize,
+                              const std::vector<int64_t>& value_dsizes,
+                              const Device& device);
+    ~OpenAddressingHashBackend();
+
+    void Reserve(int64_t capacity) override;
+
+    bool GrowInPlace(int64_t capacity) override;
+
+    void Insert(const void* input_keys,
+                const std::vector<const void*>& input_values_soa,
+                buf_index_t* output_buf_indices,
+                bool* output_masks,
+                int64_t count) override;
+
+    void Find(const void* input_keys,
+              buf_index_t* output_buf_indices,
+              bool* output_masks,
+              int64_t count) override;
+
+    void Erase(const void* input_keys,
+               bool* output_masks,
+               int64_t count) override;
+
+    int64_t GetActiveIndices(buf_index_t* output_indices) override;
+
+    void Clear() override;
+
+    int64_t Size() const override;
+    int64_t GetBucketCount() const override;
+    std::vector<int64_t> BucketSizes() const override;
+    float LoadFactor() const override;
+
+    std::shared_ptr<DeviceHashBackend> GetSnapshot() const override;
+
+    void Allocate(int64_t capacity) override;
+    void Free() override{};
+
+    /// Returns the buffer index of \p key, or -1 if it is not found. Unlike
+    /// Find, no entries are migrated, so that kernels can look up keys one by
+    /// one from parallel loops while the table is not modified.
+    int64_t FindBufIndex(const Key& key) const {
+        const std::atomic<uint64_t>* slot =
+                state_.Find(key, State::HashKey(key));
+        return slot != nullptr ? State::GetBufIndex(slot->load()) : -1;
+    }
+
+protected:
+    /// Slots are rebuilt when entries and tombstones would exceed this
+    /// fraction of the slots.
+    static constexpr double kMaxLoadFactor = 0.75;
+
+    /// Minimum number of slots of the previous table migrated per operation.
+    static constexpr int64_t kMigrationBatch = 16384;
+
+    /// Number of slots for a capacity, at most half full when full.
+    static int64_t NumSlotsFor(int64_t capacity) {
+        int64_t num_slots = 2;
+        while (num_slots < 2 * capacity) {
+            num_slots *= 2;
+        }
+        return num_slots;
+    }
+
+    /// Waits until the insertion in progress at \p pos is published.
+    uint64_t WaitForSlot(int64_t pos) const {
+        const AtomicUInt64Array& slots = *state_.slots_;
+        uint64_t slot = slots[pos].load(std::memory_order_acquire);
+        while (slot == State::kBusy) {
+            std::this_thread::yield();
+            slot = slots[pos].load(std::memory_order_acquire);
+        }
+        return slot;
+    }
+
+    /// Puts an entry whose key is not in the slots into the first empty slot.
+    void PlaceEntry(buf_index_t buf_index) {
+        const AtomicUInt64Array& slots = *state_.slots_;
+        const uint64_t hash = State::HashKey(state_.GetKey(buf_index));
+        const uint64_t entry = State::MakeEntry(hash, buf_index);
+        const uint64_t mask = static_cast<uint64_t>(slots.size_ - 1);
+        for (uint64_t pos = hash & mask;; pos = (pos + 1) & mask) {
+            uint64_t slot = State::kEmpty;
+            if (slots[pos].compare_exchange_strong(slot, entry)) {
+                break;
+            }
+        }
+    }
+
+    /// Moves the entries of the next \p count slots of the previous table to
+    /// the current table, and drops the previous table when all are moved.
+    void Migrate(int64_t count);
+
+    void FinishMigration() { Migrate(state_.NumOldSlots()); }
+
+    /// Rebuilds the slots with \p num_slots slots, dropping the tombstones.
+    void Rehash(int64_t num_slots);
+
+    /// Makes the entries inserted so far visible to new snapshots.
+    void Publish();
+
+    State state_;
+    std::atomic<int64_t> num_erased_{0};
+
+    /// Epoch of the running Insert.
+    uint64_t epoch_ = 0;
+    /// Accessed with std::atomic_load and std::atomic_store only.
+    std::shared_ptr<const State> published_;
+};
+
+/// Read-only view of an OpenAddressingHashBackend, see HashMap::GetSnapshot.
+template <typename Key, typename Hash, typename Eq>
+class OpenAddressingHashSnapshot : public DeviceHashBackend {
+public:
+    using State = OpenAddressingHashState<Key, Hash, Eq>;
+
+    OpenAddressingHashSnapshot(const std::shared_ptr<const State>& state,
+                               int64_t key_dsize,
+                               const std::vector<int64_t>& value_dsizes,
+                               const Device& device)
+        : DeviceHashBackend(state->capacity_, key_dsize, value_dsizes, device),
+          state_(state) {
+        this->buffer_ = state_->buffer_;
+    }
+
+    /// Raises an error if entries were erased or cleared from the hash map
+    /// after the snapshot was taken.
+    void CheckValid() const {
+        if (state_->num_removals_->load() != state_->published_num_removals_) {
+            utility::LogError(
+                    "The hash map snapshot is invalid, as entries were erased "
+                    "or cleared after it was taken.");
+        }
+    }
+
+    void Reserve(int64_t capacity) override { ReadOnlyError(); }
+
+    void Insert(const void* input_keys,
+                const std::vector<const void*>& input_values_soa,
+                buf_index_t* output_buf_indices,
+                bool* output_masks,
+                int64_t count) override {
+        ReadOnlyError();
+    }
+
+    void Find(const void* input_keys,
+              buf_index_t* output_buf_indices,
+              bool* output_masks,
+              int64_t count) override {
+        CheckValid();
+        const Key* input_keys_templated = static_cast<const Key*>(input_keys);
+        ParallelFor(this->device_, count, [&](int64_t i) {
+            const Key& key = input_keys_templated[i];
+            const std::atomic<uint64_t>* slot =
+                    state_->Find(key, State::HashKey(key));
+            output_masks[i] = slot != nullptr;
+            output_buf_indices[i] =
+                    slot != nullptr ? State::GetBufIndex(slot->load()) : 0;
+        });
+    }
+
+    void Erase(const void* input_keys,
+               bool* output_masks,
+               int64_t count) override {
+        ReadOnlyError();
+    }
+
+    int64_t GetActiveIndices(buf_index_t* output_indices) override {
+        CheckValid();
+        return state_->GetActiveIndices(this->device_, output_indices);
+    }
+
+    void Clear() override { ReadOnlyError(); }
+
+    int64_t Size() const override { return state_->size_; }
+
+    int64_t GetBucketCount() const override { return state_->slots_->size_; }
+
+    std::vector<int64_t> BucketSizes() const override {
+        CheckValid();
+        std::vector<buf_index_t> buf_indices(Size());
+        state_->GetActiveIndices(this->device_, buf_indices.data());
+        std::vector<int64_t> ret(GetBucketCount(), 0);
+        const uint64_t mask = static_cast<uint64_t>(GetBucketCount() - 1);
+        for (buf_index_t buf_index : buf_indices) {
+            ret[State::HashKey(state_->GetKey(buf_index)) & mask]++;
+        }
+        return ret;
+    }
+
+    float LoadFactor() const override {
+        return static_cast<float>(Size()) /
+               static_cast<float>(GetBucketCount());
+    }
+
+    void Allocate(int64_t capacity) override { ReadOnlyError(); }
+    void Free() override{};
+
+    /// Returns the buffer index of \p key, or -1 if it is not in the snapshot.
+    /// Kernels looking up keys one by one call CheckValid once beforehand.
+    int64_t FindBufIndex(const Key& key) const {
+        const std::atomic<uint64_t>* slot =
+                state_->Find(key, State::HashKey(key));
+        return slot != nullptr ? State::GetBufIndex(slot->load()) : -1;
+    }
+
+protected:
+    [[noreturn]] static void ReadOnlyError() {
+        utility::LogError("Hash map snapshots are read-only.");
+    }
+
+    std::shared_ptr<const State> state_;
+};
+
+/// Writes the buffer indices of the slots [0, num_slots) for which
+/// \p is_active(pos, slot_at(pos)) is true, and returns their number.
+template <typename SlotFunc, typename ActiveFunc>
+int64_t CollectActiveEntries(const Device& device,
+                             int64_t num_slots,
+                             SlotFunc slot_at,
+                             ActiveFunc is_active,
+                             buf_index_t* output_buf_indices) {
+    // Counts the entries per block of slots, then writes the buffer indices
+    // of each block at the offset given by the prefix sum of the counts.
+    constexpr int64_t kBlockSize = 4096;
+    const int64_t num_blocks = (num_slots + kBlockSize - 1) / kBlockSize;
+    std::vector<int64_t> offsets(num_blocks + 1, 0);
+    ParallelFor(device, num_blocks, [&](int64_t block) {
+        const int64_t end = std::min((block + 1) * kBlockSize, num_slots);
+        int64_t block_count = 0;
+        for (int64_t pos = block * kBlockSize; pos < end; ++pos) {
+            block_count += is_active(pos, slot_at(pos)) ? 1 : 0;
+        }
+        offsets[block + 1] = block_count;
+    });
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+    ParallelFor(device, num_blocks, [&](int64_t block) {
+        const int64_t end = std::min((block + 1) * kBlockSize, num_slots);
+        int64_t offset = offsets[block];
+        for (int64_t pos = block * kBlockSize; pos < end; ++pos) {
+            const uint64_t slot = slot_at(pos);
+            if (is_active(pos, slot)) {
+                output_buf_indices[offset++] =
+                        static_cast<buf_index_t>(slot & UINT64_C(0xffffffff));
+            }
+        }
+    });
+
+    return offsets[num_blocks];
+}
+
+template <typename Key, typename Hash, typename Eq>
+int64_t OpenAddressingHashState<Key, Hash, Eq>::GetActiveIndices(
+        const Device& device, buf_index_t* output_buf_indices) const {
+    const int64_t num_old = NumOldSlots();
+    const std::atomic<uint64_t>* slots = &(*slots_)[0];
+    if (num_old == 0 && epoch_ == kLatestEpoch) {
+        return CollectActiveEntries(
+                device, slots_->size_,
+                [slots](int64_t pos) { return slots[pos].load(); },
+                [](int64_t pos, uint64_t slot) { return IsEntry(slot); },
+                output_buf_indices);
+    }
+
+    // The slots of the previous table that are not migrated yet come first.
+    // In a snapshot, an entry of the current table may also be in one of
+    // them if it was migrated after the snapshot was taken.
+    const std::atomic<uint64_t>* old_slots =
+            num_old > 0 ? &(*old_slots_)[num_migrated_] : nullptr;
+    const bool check_old = epoch_ != kLatestEpoch && num_old > 0;
+    return CollectActiveEntries(
+            device, num_old + slots_->size_,
+            [&](int64_t pos) {
+                return pos < num_old ? old_slots[pos].load()
+                                     : slots[pos - num_old].load();
+            },
+            [&](int64_t pos, uint64_t slot) {
+                if (!IsVisible(slot)) {
+                    return false;
+                }
+                if (check_old && pos >= num_old) {
+                    const Key& key = GetKey(GetBufIndex(slot));
+                    return FindSlot(*old_slots_, num_migrated_, key,
+                                    HashKey(key)) < 0;
+                }
+                return true;
+            },
+            output_buf_indices);
+}
+
+template <typename Key, typename Hash, typename Eq>
+OpenAddressingHashBackend<Key, Hash, Eq>::OpenAddressingHashBackend(
+        int64_t init_capacity,
+        int64_t key_dsize,
+        const std::vector<int64_t>& value_dsizes,
+        const Device& device)
+    : DeviceHashBackend(init_capacity, key_dsize, value_dsizes, device) {
+    Allocate(init_capacity);
+}
+
+template <typename Key, typename Hash, typename Eq>
+OpenAddressingHashBackend<Key, Hash, Eq>::~OpenAddressingHashBackend() {}
+
+template <typename Key, typename Hash, typename Eq>
+int64_t OpenAddressingHashBackend<Key, Hash, Eq>::Size() const {
+    return state_.buffer_accessor_->heap_top_->load();
+}
+
+template <typename Key, typename Hash, typename Eq>
+void OpenAddressingHashBackend<Key, Hash, Eq>::Find(
+        const void* input_keys,
+        buf_index_t* output_buf_indices,
+        bool* output_masks,
+        int64_t count) {
+    Migrate(kMigrationBatch);
+
+    const Key* input_keys_templated = static_cast<const Key*>(input_keys);
+    ParallelFor(this->device_, count, [&](int64_t i) {
+        const Key& key = input_keys_templated[i];
+        const std::atomic<uint64_t>* slot =
+                state_.Find(key, State::HashKey(key));
+        output_masks[i] = slot != nullptr;
+        output_buf_indices[i] =
+                slot != nullptr ? State::GetBufIndex(slot->load()) : 0;
+    });
+}
+
+template <typename Key, typename Hash, typename Eq>
+void OpenAddressingHashBackend<Key, Hash, Eq>::Erase(const void* input_keys,
+                                                     bool* output_masks,
+                                                     int64_t count) {
+    Migrate(kMigrationBatch);
+
+    const Key* input_keys_templated = static_cast<const Key*>(input_keys);
+    ParallelFor(this->device_, count, [&](int64_t i) {
+        const Key& key = input_keys_templated[i];
+        bool in_current = false;
+        std::atomic<uint64_t>* slot =
+                state_.Find(key, State::HashKey(key), &in_current);
+
+        // Only one of several erasures of the same key succeeds. Tombstones
+        // are only counted for the current table, the previous one is dropped
+        // after the migration.
+        output_masks[i] = false;
+        uint64_t entry = slot != nullptr ? slot->load() : State::kEmpty;
+        if (State::IsEntry(entry) &&
+            slot->compare_exchange_strong(entry, State::kErased)) {
+            state_.buffer_accessor_->DeviceFree(State::GetBufIndex(entry));
+            if (in_current) {
+                num_erased_.fetch_add(1);
+            }
+            output_masks[i] = true;
+        }
+    });
+    if (std::any_of(output_masks, output_masks + count,
+                    [](bool mask) { return mask; })) {
+        state_.num_removals_->fetch_add(1);
+    }
+    Publish();
+}
+
+template <typename Key, typename Hash, typename Eq>
+int64_t OpenAddressingHashBackend<Key, Hash, Eq>::GetActiveIndices(
+        buf_index_t* output_buf_indices) {
+    return state_.GetActiveIndices(this->device_, output_buf_indices);
+}
+
+template <typename Key, typename Hash, typename Eq>
+void OpenAddressingHashBackend<Key, Hash, Eq>::Clear() {
+    // The slots may be shared with snapshots, so they are replaced instead of
+    // being cleared in place. The buffer indices are reused, which
+    // invalidates the snapshots.
+    if (Size() > 0) {
+        state_.num_removals_->fetch_add(1);
+    }
+    state_.slots_ = std::make_shared<AtomicUInt64Array>(GetBucketCount());
+    state_.old_slots_.reset();
+    state_.num_migrated_ = 0;
+    num_erased_.store(0);
+    this->buffer_->ResetHeap();
+    Publish();
+}
+
+template <typename Key, typename Hash, typename Eq>
+void OpenAddressingHashBackend<Key, Hash, Eq>::Reserve(int64_t capacity) {
+    const int64_t num_slots = NumSlotsFor(capacity);
+    if (num_slots > GetBucketCount()) {
+        Rehash(num_slots);
+    }
+}
+
+template <typename Key, typename Hash, typename Eq>
+bool OpenAddressingHashBackend<Key, Hash, Eq>::GrowInPlace(int64_t capacity) {
+    // Shrinking compacts the buffer, which requires a rebuild.
+    if (capacity < this->capacity_) {
+        return false;
+    }
+    FinishMigration();
+
+    // The accessor clears the values, so it is created before the copy.
+    auto buffer = std::make_shared<HashBackendBuffer>(
+            capacity, this->key_dsize_, this->value_dsizes_, this->device_);
+    auto buffer_accessor =
+            std::make_shared<CPUHashBackendBufferAccessor>(*buffer);
+    buffer->CopyFrom(*this->buffer_);
+    auto epochs =
+            std::make_shared<AtomicUInt64Array>(capacity, *state_.epochs_);
+
+    this->buffer_ = buffer;
+    this->capacity_ = capacity;
+    state_.buffer_ = buffer;
+    state_.buffer_accessor_ = buffer_accessor;
+    state_.epochs_ = epochs;
+    state_.capacity_ = capacity;
+
+    const int64_t num_slots = NumSlotsFor(capacity);
+    if (num_slots > GetBucketCount()) {
+        state_.old_slots_ = state_.slots_;
+        state_.num_migrated_ = 0;
+        state_.slots_ = std::make_shared<AtomicUInt64Array>(num_slots);
+        num_erased_.store(0);
+    }
+    return true;
+}
+
+template <typename Key, typename Hash, typename Eq>
+void OpenAddressingHashBackend<Key, Hash, Eq>::Migrate(int64_t count) {
+    if (!state_.old_slots_) {
+        return;
+    }
+    const AtomicUInt64Array& old_slots = *state_.old_slots_;
+    const int64_t begin = state_.num_migrated_;
+    const int64_t end = std::min(begin + count, old_slots.size_);
+    ParallelFor(this->device_, end - begin, [&](int64_t i) {
+        const uint64_t slot = old_slots[begin + i].load();
+        if (State::IsEntry(slot)) {
+            PlaceEntry(State::GetBufIndex(slot));
+        }
+    });
+    state_.num_migrated_ = end;
+
+    if (state_.num_migrated_ == old_slots.size_) {
+        state_.old_slots_.reset();
+        state_.num_migrated_ = 0;
+    }
+}
+
+template <typename Key, typename Hash, typename Eq>
+int64_t OpenAddressingHashBackend<Key, Hash, Eq>::GetBucketCount() const {
+    return state_.slots_->size_;
+}
+
+template <typename Key, typename Hash, typename Eq>
+std::vector<int64_t> OpenAddressingHashBackend<Key, Hash, Eq>::BucketSizes()
+        const {
+    const AtomicUInt64Array& slots = *state_.slots_;
+    std::vector<int64_t> ret(slots.size_);
+    for (int64_t pos = 0; pos < slots.size_; ++pos) {
+        ret[pos] = State::IsEntry(slots[pos].load()) ? 1 : 0;
+    }
+    // Entries not yet migrated are counted at their first probe position.
+    const uint64_t mask = static_cast<uint64_t>(slots.size_ - 1);
+    for (int64_t pos = state_.num_migrated_;
+         state_.old_slots_ && pos < state_.old_slots_->size_; ++pos) {
+        const uint64_t slot = (*state_.old_slots_)[pos].load();
+        if (State::IsEntry(slot)) {
+            const uint64_t hash =
+                    State::HashKey(state_.GetKey(State::GetBufIndex(slot)));
+            ret[hash & mask]++;
+        }
+    }
+    return ret;
+}
+
+template <typename Key, typename Hash, typename Eq>
+float OpenAddressingHashBackend<Key, Hash, Eq>::LoadFactor() const {
+    return static_cast<float>(Size()) / static_cast<float>(GetBucketCount());
+}
+
+template <typename Key, typename Hash, typename Eq>
+std::shared_ptr<DeviceHashBackend>
+OpenAddressingHashBackend<Key, Hash, Eq>::GetSnapshot() const {
+    return std::make_shared<OpenAddressingHashSnapshot<Key, Hash, Eq>>(
+            std::atomic_load(&published_), this->key_dsize_,
+            this->value_dsizes_, this->device_);
+}
+
+template <typename Key, typename Hash, typename Eq>
+void OpenAddressingHashBackend<Key, Hash, Eq>::Insert(
+        const void* input_keys,
+        const std::vector<const void*>& input_values_soa,
+        buf_index_t* output_buf_indices,
+        bool* output_masks,
+        int64_t count) {
+    if (Size() + num_erased_.load() + count >
+        kMaxLoadFactor * GetBucketCount()) {
+        Rehash(GetBucketCount());
+    } else if (state_.old_slots_) {
+        // Migrates in proportion to the insertions, so that the previous
+        // table is empty at the latest when the capacity is reached.
+        const int64_t headroom =
+                std::max(this->capacity_ - Size(), static_cast<int64_t>(1));
+        Migrate(std::max<int64_t>(int64_t(kMigrationBatch),
+                                  state_.NumOldSlots() * count / headroom + 1));
+    }
+
+    const Key* input_keys_templated = static_cast<const Key*>(input_keys);
+    const size_t n_values = input_values_soa.size();
+    const AtomicUInt64Array& slots = *state_.slots_;
+    const uint64_t mask = static_cast<uint64_t>(slots.size_ - 1);
+    CPUHashBackendBufferAccessor& buffer_accessor = *state_.buffer_accessor_;
+    AtomicUInt64Array& epochs = *state_.epochs_;
+
+    ParallelFor(this->device_, count, [&](int64_t i) {
+        const Key& key = input_keys_templated[i];
+        const uint64_t hash = State::HashKey(key);
+
+        output_masks[i] = false;
+        output_buf_indices[i] = 0;
+        if (state_.old_slots_ &&
+            state_.FindSlot(*state_.old_slots_, state_.num_migrated_, key,
+                            hash) >= 0) {
+            return;
+        }
+        uint64_t pos = hash & mask;
+        while (true) {
+            uint64_t slot = WaitForSlot(pos);
+            if (slot == State::kEmpty) {
+                // Claim the slot, then publish the entry once the key and
+                // values are in the buffer. Concurrent insertions of the same
+                // key wait for it, snapshots skip it.
+                if (!slots[pos].compare_exchange_strong(slot, State::kBusy)) {
+                    continue;
+                }
+                buf_index_t buf_index = buffer_accessor.DeviceAllocate();
+                *static_cast<Key*>(buffer_accessor.GetKeyPtr(buf_index)) = key;
+                for (size_t j = 0; j < n_values; ++j) {
+                    const uint8_t* src_value =
+                            static_cast<const uint8_t*>(input_values_soa[j]) +
+                            this->value_dsizes_[j] * i;
+                    std::memcpy(buffer_accessor.GetValuePtr(buf_index, j),
+                                src_value, this->value_dsizes_[j]);
+                }
+                epochs[buf_index].store(epoch_, std::memory_order_relaxed);
+                slots[pos].store(State::MakeEntry(hash, buf_index),
+                                 std::memory_order_release);
+
+                output_buf_indices[i] = buf_index;
+                output_masks[i] = true;
+                break;
+            }
+            if (State::IsEntry(slot) && State::TagMatches(slot, hash) &&
+                Eq()(state_.GetKey(State::GetBufIndex(slot)), key)) {
+                break;
+            }
+            pos = (pos + 1) & mask;
+        }
+    });
+
+    ++epoch_;
+    Publish();
+}
+
+template <typename Key, typename Hash, typename Eq>
+void OpenAddressingHashBackend<Key, Hash, Eq>::Allocate(int64_t capacity) {
+    this->capacity_ = capacity;
+
+    this->buffer_ = std::make_shared<HashBackendBuffer>(
+            this->capacity_, this->key_dsize_, this->value_dsizes_,
+            this->device_);
+
+    state_.buffer_ = this->buffer_;
+    state_.buffer_accessor_ =
+            std::make_shared<CPUHashBackendBufferAccessor>(*this->buffer_);
+    state_.epochs_ = std::make_shared<AtomicUInt64Array>(capacity);
+    state_.capacity_ = capacity;
+    if (!state_.num_removals_) {
+        state_.num_removals_ = std::make_shared<std::atomic<int64_t>>(0);
+    }
+
+    state_.slots_ = std::make_shared<AtomicUInt64Array>(NumSlotsFor(capacity));
+    state_.old_slots_.reset();
+    state_.num_migrated_ = 0;
+    num_erased_.store(0);
+    Publish();
+}
+
+template <typename Key, typename Hash, typename Eq>
+void OpenAddressingHashBackend<Key, Hash, Eq>::Rehash(int64_t num_slots) {
+    // Collects the entries of both tables if a migration is in progress.
+    std::vector<buf_index_t> buf_indices(Size());
+    GetActiveIndices(buf_indices.data());
+
+    // The current table may be shared with snapshots, so a new one is built.
+    state_.slots_ = std::make_shared<AtomicUInt64Array>(num_slots);
+    state_.old_slots_.reset();
+    state_.num_migrated_ = 0;
+    num_erased_.store(0);
+
+    // The keys are unique, so each entry takes the first free slot.
+    ParallelFor(this->device_, static_cast<int64_t>(buf_indices.size()),
+                [&](int64_t i) { PlaceEntry(buf_indices[i]); });
+    Publish();
+}
+
+template <typename Key, typename Hash, typename Eq>
+void OpenAddressingHashBackend<Key, Hash, Eq>::Publish() {
+    auto state = std::make_shared<State>(state_);
+    state->epoch_ = epoch_;
+    state->size_ = Size();
+    state->published_num_removals_ = state_.num_removals_->load();
+    std::atomic_store(&published_, std::shared_ptr<const State>(state));
+}
+
+}  // namespace core
+}  // namespace open3d
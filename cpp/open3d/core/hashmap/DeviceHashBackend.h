@@ -37,6 +37,12 @@ public:
     /// 4) deallocating old hash table
     virtual void Reserve(int64_t capacity) = 0;
 
+    /// Grow the capacity without rebuilding the hash map at once. The stored
+    /// key/value pairs keep their buffer indices, and the backend may rehash
+    /// incrementally during the following operations. Returns false if the
+    /// backend does not support it.
+    virtual bool GrowInPlace(int64_t capacity) { return false; }
+
     /// Parallel insert contiguous arrays of keys and values.
     virtual void Insert(const void* input_keys,
                         const std::vector<const void*>& input_values,
@@ -88,6 +94,12 @@ public:
     /// Get the i-th value buffer that store an actual value array.
     Tensor GetValueBuffer(size_t i = 0) { return buffer_->GetValueBuffer(i); }
 
+    /// Get a read-only view of the entries inserted so far, which may be used
+    /// while further entries are inserted, see HashMap::GetSnapshot.
+    virtual std::shared_ptr<DeviceHashBackend> GetSnapshot() const {
+        utility::LogError("Snapshots are not supported by this backend.");
+    }
+
     virtual void Allocate(int64_t capacity) = 0;
     virtual void Free() = 0;
 
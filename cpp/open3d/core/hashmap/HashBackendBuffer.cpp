@@ -70,6 +70,44 @@ void HashBackendBuffer::ResetHeap() {
     }
 }
 
+void HashBackendBuffer::CopyFrom(HashBackendBuffer &other) {
+    const Device device = GetDevice();
+    const int64_t capacity = other.GetCapacity();
+    if (other.GetDevice() != device) {
+        utility::LogError("Buffer device mismatch ({} != {}).",
+                          other.GetDevice().ToString(), device.ToString());
+    }
+    if (capacity > GetCapacity()) {
+        utility::LogError("Buffer capacity too small ({} > {}).", capacity,
+                          GetCapacity());
+    }
+    if (other.GetKeyDsize() != GetKeyDsize() ||
+        other.GetValueDsizes() != GetValueDsizes()) {
+        utility::LogError("Buffer key/value sizes mismatch.");
+    }
+
+    // The heap of the other buffer is a permutation of [0, capacity), so the
+    // entries of this heap from capacity on are still valid after ResetHeap.
+    MemoryManager::Memcpy(heap_.GetDataPtr(), device,
+                          other.heap_.GetDataPtr(), device,
+                          capacity * sizeof(buf_index_t));
+    MemoryManager::Memcpy(key_buffer_.GetDataPtr(), device,
+                          other.key_buffer_.GetDataPtr(), device,
+                          capacity * GetKeyDsize());
+    for (size_t i = 0; i < value_buffers_.size(); ++i) {
+        MemoryManager::Memcpy(
+                value_buffers_[i].GetDataPtr(), device,
+                other.value_buffers_[i].GetDataPtr(), device,
+                capacity * value_buffers_[i].GetDtype().ByteSize());
+    }
+
+    if (device.IsCPU()) {
+        heap_top_.cpu = other.heap_top_.cpu.load();
+    } else if (device.IsCUDA()) {
+        heap_top_.cuda.CopyFrom(other.heap_top_.cuda);
+    }
+}
+
 Device HashBackendBuffer::GetDevice() const { return heap_.GetDevice(); }
 
 int64_t HashBackendBuffer::GetCapacity() const { return heap_.GetLength(); }
@@ -58,6 +58,12 @@ public:
     /// Reset the heap and heap top.
     void ResetHeap();
 
+    /// Copy the key/value pairs, the heap and the heap top of a buffer with a
+    /// smaller or equal capacity on the same device. The buffer indices of the
+    /// key/value pairs are preserved, and the additional buffer indices of
+    /// this buffer remain free.
+    void CopyFrom(HashBackendBuffer &other);
+
     /// Return device of the buffer.
     Device GetDevice() const;
 
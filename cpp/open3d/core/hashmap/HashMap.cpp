@@ -7,11 +7,13 @@
 
 #include "open3d/core/hashmap/HashMap.h"
 
+#include "open3d/core/MemoryManagerStatistic.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/hashmap/DeviceHashBackend.h"
 #include "open3d/t/io/HashMapIO.h"
 #include "open3d/utility/Helper.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Profiler.h"
 
 namespace open3d {
 namespace core {
@@ -45,12 +47,17 @@ HashMap::HashMap(int64_t init_capacity,
 }
 
 void HashMap::Reserve(int64_t capacity) {
+    ScopedMemoryTag memory_tag("core::HashMap");
     int64_t count = Size();
     if (capacity <= count) {
         utility::LogDebug("Target capacity smaller then current size, abort.");
         return;
     }
 
+    if (device_hashmap_->GrowInPlace(capacity)) {
+        return;
+    }
+
     Tensor active_keys;
     std::vector<Tensor> active_values;
 
@@ -119,6 +126,7 @@ void HashMap::InsertImpl(const Tensor& input_keys,
                          Tensor& output_buf_indices,
                          Tensor& output_masks,
                          bool is_activate_op) {
+    OPEN3D_PROFILE_SCOPE("core::HashMap::Insert");
     CheckKeyCompatibility(input_keys);
     if (!is_activate_op) {
         CheckKeyValueLengthCompatibility(input_keys, input_values_soa);
@@ -165,6 +173,7 @@ void HashMap::Insert(const Tensor& input_keys,
 void HashMap::Activate(const Tensor& input_keys,
                        Tensor& output_buf_indices,
                        Tensor& output_masks) {
+    OPEN3D_PROFILE_SCOPE("core::HashMap::Activate");
     int64_t length = input_keys.GetLength();
     int64_t new_size = Size() + length;
     int64_t capacity = GetCapacity();
@@ -181,6 +190,7 @@ void HashMap::Activate(const Tensor& input_keys,
 void HashMap::Find(const Tensor& input_keys,
                    Tensor& output_buf_indices,
                    Tensor& output_masks) {
+    OPEN3D_PROFILE_SCOPE("core::HashMap::Find");
     CheckKeyLength(input_keys);
     CheckKeyCompatibility(input_keys);
 
@@ -195,6 +205,7 @@ void HashMap::Find(const Tensor& input_keys,
 }
 
 void HashMap::Erase(const Tensor& input_keys, Tensor& output_masks) {
+    OPEN3D_PROFILE_SCOPE("core::HashMap::Erase");
     CheckKeyLength(input_keys);
     CheckKeyCompatibility(input_keys);
 
@@ -223,6 +234,12 @@ HashMap HashMap::Load(const std::string& file_name) {
     return t::io::ReadHashMap(file_name);
 }
 
+HashMap HashMap::GetSnapshot() const {
+    HashMap snapshot(*this);
+    snapshot.device_hashmap_ = device_hashmap_->GetSnapshot();
+    return snapshot;
+}
+
 HashMap HashMap::Clone() const { return To(GetDevice(), /*copy=*/true); }
 
 HashMap HashMap::To(const Device& device, bool copy) const {
@@ -318,6 +335,7 @@ float HashMap::LoadFactor() const { return device_hashmap_->LoadFactor(); }
 void HashMap::Init(int64_t init_capacity,
                    const Device& device,
                    const HashBackendType& backend) {
+    ScopedMemoryTag memory_tag("core::HashMap");
     // Key check
     if (key_dtype_.GetDtypeCode() == Dtype::DtypeCode::Undefined) {
         utility::LogError("Undefined key dtype is not allowed.");
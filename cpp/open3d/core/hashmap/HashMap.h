@@ -17,7 +17,12 @@ namespace core {
 
 class DeviceHashBackend;
 
-enum class HashBackendType { Slab, StdGPU, TBB, Default };
+/// Hash map backends. Slab and StdGPU run on CUDA, TBB and OpenAddressing on
+/// CPU. OpenAddressing is a flat linear probing table, which is faster than
+/// the node-based TBB table for lookups, erasure and GetActiveIndices. It also
+/// grows incrementally: the slots are migrated in batches during the following
+/// operations, so that growing does not stall a single insertion.
+enum class HashBackendType { Slab, StdGPU, TBB, OpenAddressing, Default };
 
 class HashMap : public IsDevice {
 public:
@@ -45,6 +50,8 @@ public:
     ~HashMap() = default;
 
     /// Reserve the internal hash map with the given capacity by rehashing.
+    /// Backends that grow incrementally keep the buffer indices of the stored
+    /// key/value pairs and rehash in batches during later operations.
     void Reserve(int64_t capacity);
 
     /// Parallel insert arrays of keys and values in Tensors.
@@ -179,6 +186,21 @@ public:
     /// Return size / bucket_count.
     float LoadFactor() const;
 
+    /// Get a read-only snapshot of the hash map for readers in other threads.
+    ///
+    /// The snapshot contains the entries of the Insert and Activate calls
+    /// that completed before it was taken, and supports Find, Size,
+    /// GetActiveIndices and the buffer tensor getters. It may be used while
+    /// this hash map inserts further entries, and never blocks on them; the
+    /// buffers of the snapshot stay valid when the hash map grows. Erase and
+    /// Clear calls that remove entries invalidate the snapshots taken before
+    /// them, which then raise an error on Find and GetActiveIndices; they
+    /// must not run concurrently with readers of a snapshot. Values modified
+    /// in place after the snapshot was taken may or may not be visible in it.
+    ///
+    /// Only supported by the OpenAddressing backend.
+    HashMap GetSnapshot() const;
+
     /// Return the implementation of the device hash backend.
     std::shared_ptr<DeviceHashBackend> GetDeviceHashBackend() const {
         return device_hashmap_;
@@ -0,0 +1,422 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/hashmap/HashMultiMap.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "open3d/core/Atomic.h"
+#include "open3d/core/ParallelFor.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/ParallelScan.h"
+
+namespace open3d {
+namespace core {
+
+namespace {
+// Layout of the list header stored as the value of each key.
+constexpr int64_t kListSize = 0;
+// Number of reserved elements, equal to the size between Append calls.
+constexpr int64_t kListReserved = 1;
+constexpr int64_t kListHead = 2;
+constexpr int64_t kListTail = 3;
+// First page allocated for the list in the current Append call.
+constexpr int64_t kListNewPage = 4;
+constexpr int64_t kListHeaderSize = 5;
+
+inline int64_t NumPages(int64_t size, int64_t page_size) {
+    return (size + page_size - 1) / page_size;
+}
+}  // namespace
+
+HashMultiMap::HashMultiMap(int64_t init_capacity,
+                           const Dtype& key_dtype,
+                           const SizeVector& key_element_shape,
+                           const std::vector<Dtype>& dtypes_value,
+                           const std::vector<SizeVector>& element_shapes_value,
+                           const Device& device,
+                           int64_t page_size,
+                           const HashBackendType& backend)
+    : page_size_(page_size),
+      dtypes_value_(dtypes_value),
+      element_shapes_value_(element_shapes_value) {
+    Init(init_capacity, key_dtype, key_element_shape, device, backend);
+}
+
+HashMultiMap::HashMultiMap(int64_t init_capacity,
+                           const Dtype& key_dtype,
+                           const SizeVector& key_element_shape,
+                           const Dtype& value_dtype,
+                           const SizeVector& value_element_shape,
+                           const Device& device,
+                           int64_t page_size,
+                           const HashBackendType& backend)
+    : HashMultiMap(init_capacity,
+                   key_dtype,
+                   key_element_shape,
+                   std::vector<Dtype>{value_dtype},
+                   std::vector<SizeVector>{value_element_shape},
+                   device,
+                   page_size,
+                   backend) {}
+
+void HashMultiMap::Init(int64_t init_capacity,
+                        const Dtype& key_dtype,
+                        const SizeVector& key_element_shape,
+                        const Device& device,
+                        const HashBackendType& backend) {
+    if (!device.IsCPU()) {
+        utility::LogError("HashMultiMap is only supported on CPU, but got {}.",
+                          device.ToString());
+    }
+    if (page_size_ <= 0) {
+        utility::LogError("Page size must be positive, but got {}.",
+                          page_size_);
+    }
+    if (dtypes_value_.size() != element_shapes_value_.size()) {
+        utility::LogError(
+                "Size of value_dtype ({}) mismatches with size of "
+                "element_shapes_value ({}).",
+                dtypes_value_.size(), element_shapes_value_.size());
+    }
+    if (dtypes_value_.empty()) {
+        utility::LogError("At least one value array is required.");
+    }
+    for (size_t i = 0; i < dtypes_value_.size(); ++i) {
+        if (dtypes_value_[i].GetDtypeCode() == Dtype::DtypeCode::Undefined) {
+            utility::LogError("Undefined value dtype is not allowed.");
+        }
+        if (element_shapes_value_[i].NumElements() == 0) {
+            utility::LogError(
+                    "Value element shape must contain at least 1 "
+                    "element, but got 0.");
+        }
+    }
+
+    // The list header of each key is stored as its value.
+    internal_ = std::make_shared<HashMap>(
+            init_capacity, key_dtype, key_element_shape, core::Int64,
+            SizeVector{kListHeaderSize}, device, backend);
+
+    page_next_ = Tensor({0}, core::Int64, device);
+    for (size_t i = 0; i < dtypes_value_.size(); ++i) {
+        SizeVector shape = element_shapes_value_[i];
+        shape.insert(shape.begin(), 0);
+        page_values_.emplace_back(shape, dtypes_value_[i], device);
+    }
+}
+
+void HashMultiMap::ReservePages(int64_t num_pages) {
+    int64_t page_capacity = GetPageCapacity();
+    if (num_pages <= page_capacity) {
+        return;
+    }
+    page_capacity = std::max(num_pages, page_capacity * 2);
+
+    Tensor page_next({page_capacity}, core::Int64, GetDevice());
+    page_next.Slice(0, 0, num_pages_) = page_next_.Slice(0, 0, num_pages_);
+    page_next_ = page_next;
+
+    for (size_t i = 0; i < page_values_.size(); ++i) {
+        SizeVector shape = element_shapes_value_[i];
+        shape.insert(shape.begin(), page_capacity * page_size_);
+        Tensor page_values(shape, dtypes_value_[i], GetDevice());
+        const int64_t num_rows = num_pages_ * page_size_;
+        page_values.Slice(0, 0, num_rows) =
+                page_values_[i].Slice(0, 0, num_rows);
+        page_values_[i] = page_values;
+    }
+}
+
+void HashMultiMap::Reserve(int64_t capacity) { internal_->Reserve(capacity); }
+
+Tensor HashMultiMap::Append(const Tensor& input_keys,
+                            const Tensor& input_values) {
+    return Append(input_keys, std::vector<Tensor>{input_values});
+}
+
+Tensor HashMultiMap::Append(const Tensor& input_keys,
+                            const std::vector<Tensor>& input_values_soa) {
+    const int64_t length = input_keys.GetLength();
+    if (length == 0) {
+        utility::LogError("Input number of keys should > 0, but got 0.");
+    }
+    if (input_values_soa.size() != dtypes_value_.size()) {
+        utility::LogError(
+                "Input number of value arrays ({}) mismatches with stored "
+                "({})",
+                input_values_soa.size(), dtypes_value_.size());
+    }
+    std::vector<Tensor> input_values_contiguous;
+    std::vector<int64_t> value_bytesizes;
+    for (size_t i = 0; i < input_values_soa.size(); ++i) {
+        const Tensor& input_value = input_values_soa[i];
+        if (input_value.GetLength() != length) {
+            utility::LogError(
+                    "Input number of values at {} ({}) mismatch with number "
+                    "of keys ({})",
+                    i, input_value.GetLength(), length);
+        }
+        const int64_t stored_bytesize = element_shapes_value_[i].NumElements() *
+                                        dtypes_value_[i].ByteSize();
+        const int64_t input_bytesize = input_value.NumElements() / length *
+                                       input_value.GetDtype().ByteSize();
+        if (input_bytesize != stored_bytesize) {
+            utility::LogError(
+                    "Input value[{}] element bytesize ({}) mismatch with "
+                    "stored ({})",
+                    i, input_bytesize, stored_bytesize);
+        }
+        input_values_contiguous.push_back(
+                input_value.To(GetDevice()).Contiguous());
+        value_bytesizes.push_back(stored_bytesize);
+    }
+
+    // Insert the new keys and initialize their lists.
+    Tensor buf_indices, masks;
+    internal_->Activate(input_keys, buf_indices, masks);
+    int64_t* headers = internal_->GetValueTensor().GetDataPtr<int64_t>();
+    const buf_index_t* buf_indices_ptr =
+            static_cast<const buf_index_t*>(buf_indices.GetDataPtr());
+    const bool* masks_ptr = masks.GetDataPtr<bool>();
+    ParallelFor(GetDevice(), length, [=] OPEN3D_DEVICE(int64_t i) {
+        if (masks_ptr[i]) {
+            int64_t* header = headers + buf_indices_ptr[i] * kListHeaderSize;
+            header[kListSize] = 0;
+            header[kListReserved] = 0;
+            header[kListHead] = -1;
+            header[kListTail] = -1;
+        }
+    });
+    internal_->Find(input_keys, buf_indices, masks);
+
+    // Reserve a position in the list of its key for each value. The value
+    // that gets the first new position of a key is the leader of the key,
+    // which allocates the pages and updates the list header.
+    const int64_t page_size = page_size_;
+    Tensor positions({length}, core::Int64, GetDevice());
+    Tensor leaders({length}, core::Bool, GetDevice());
+    int64_t* positions_ptr = positions.GetDataPtr<int64_t>();
+    bool* leaders_ptr = leaders.GetDataPtr<bool>();
+    ParallelFor(GetDevice(), length, [=] OPEN3D_DEVICE(int64_t i) {
+        int64_t* header = headers + buf_indices_ptr[i] * kListHeaderSize;
+        positions_ptr[i] = static_cast<int64_t>(AtomicFetchAddRelaxed(
+                reinterpret_cast<uint64_t*>(&header[kListReserved]), 1));
+    });
+    uint64_t num_new_pages = 0;
+    uint64_t* num_new_pages_ptr = &num_new_pages;
+    ParallelFor(GetDevice(), length, [=] OPEN3D_DEVICE(int64_t i) {
+        const int64_t* header = headers + buf_indices_ptr[i] * kListHeaderSize;
+        leaders_ptr[i] = positions_ptr[i] == header[kListSize];
+        if (leaders_ptr[i]) {
+            const int64_t count = NumPages(header[kListReserved], page_size) -
+                                  NumPages(header[kListSize], page_size);
+            AtomicFetchAddRelaxed(num_new_pages_ptr,
+                                  static_cast<uint64_t>(count));
+        }
+    });
+
+    // Allocate consecutive pages for each list and link them.
+    ReservePages(num_pages_ + static_cast<int64_t>(num_new_pages));
+    int64_t* page_next_ptr = page_next_.GetDataPtr<int64_t>();
+    const int64_t num_pages = num_pages_;
+    uint64_t page_top = 0;
+    uint64_t* page_top_ptr = &page_top;
+    ParallelFor(GetDevice(), length, [=] OPEN3D_DEVICE(int64_t i) {
+        if (!leaders_ptr[i]) {
+            return;
+        }
+        int64_t* header = headers + buf_indices_ptr[i] * kListHeaderSize;
+        const int64_t count = NumPages(header[kListReserved], page_size) -
+                              NumPages(header[kListSize], page_size);
+        if (count == 0) {
+            return;
+        }
+        const uint64_t offset = AtomicFetchAddRelaxed(
+                page_top_ptr, static_cast<uint64_t>(count));
+        const int64_t first = num_pages + static_cast<int64_t>(offset);
+        header[kListNewPage] = first;
+        if (header[kListTail] >= 0) {
+            page_next_ptr[header[kListTail]] = first;
+        } else {
+            header[kListHead] = first;
+        }
+        for (int64_t page = first; page < first + count - 1; ++page) {
+            page_next_ptr[page] = page + 1;
+        }
+        page_next_ptr[first + count - 1] = -1;
+    });
+    num_pages_ += static_cast<int64_t>(num_new_pages);
+
+    // Copy the values to their positions.
+    std::vector<const uint8_t*> src_ptrs;
+    std::vector<uint8_t*> dst_ptrs;
+    for (size_t k = 0; k < page_values_.size(); ++k) {
+        src_ptrs.push_back(static_cast<const uint8_t*>(
+                input_values_contiguous[k].GetDataPtr()));
+        dst_ptrs.push_back(static_cast<uint8_t*>(page_values_[k].GetDataPtr()));
+    }
+    const int64_t num_values = static_cast<int64_t>(src_ptrs.size());
+    const uint8_t* const* src_ptrs_ptr = src_ptrs.data();
+    uint8_t* const* dst_ptrs_ptr = dst_ptrs.data();
+    const int64_t* value_bytesizes_ptr = value_bytesizes.data();
+    ParallelFor(GetDevice(), length, [=] OPEN3D_DEVICE(int64_t i) {
+        const int64_t* header = headers + buf_indices_ptr[i] * kListHeaderSize;
+        const int64_t position = positions_ptr[i];
+        const int64_t ordinal = position / page_size;
+        const int64_t num_old_pages = NumPages(header[kListSize], page_size);
+        const int64_t page =
+                ordinal < num_old_pages
+                        ? header[kListTail]
+                        : header[kListNewPage] + ordinal - num_old_pages;
+        const int64_t row = page * page_size + position % page_size;
+        for (int64_t k = 0; k < num_values; ++k) {
+            const int64_t bytesize = value_bytesizes_ptr[k];
+            std::memcpy(dst_ptrs_ptr[k] + row * bytesize,
+                        src_ptrs_ptr[k] + i * bytesize, bytesize);
+        }
+    });
+
+    // Commit the new list sizes.
+    ParallelFor(GetDevice(), length, [=] OPEN3D_DEVICE(int64_t i) {
+        if (!leaders_ptr[i]) {
+            return;
+        }
+        int64_t* header = headers + buf_indices_ptr[i] * kListHeaderSize;
+        const int64_t count = NumPages(header[kListReserved], page_size) -
+                              NumPages(header[kListSize], page_size);
+        if (count > 0) {
+            header[kListTail] = header[kListNewPage] + count - 1;
+        }
+        header[kListSize] = header[kListReserved];
+    });
+
+    return buf_indices;
+}
+
+std::pair<Tensor, Tensor> HashMultiMap::Find(const Tensor& input_keys) {
+    return internal_->Find(input_keys);
+}
+
+Tensor HashMultiMap::GetListSizes(const Tensor& input_keys) {
+    Tensor buf_indices, masks;
+    internal_->Find(input_keys, buf_indices, masks);
+
+    const int64_t length = input_keys.GetLength();
+    Tensor sizes({length}, core::Int64, GetDevice());
+    const int64_t* headers = internal_->GetValueTensor().GetDataPtr<int64_t>();
+    const buf_index_t* buf_indices_ptr =
+            static_cast<const buf_index_t*>(buf_indices.GetDataPtr());
+    const bool* masks_ptr = masks.GetDataPtr<bool>();
+    int64_t* sizes_ptr = sizes.GetDataPtr<int64_t>();
+    ParallelFor(GetDevice(), length, [=] OPEN3D_DEVICE(int64_t i) {
+        sizes_ptr[i] = masks_ptr[i] ? headers[buf_indices_ptr[i] *
+                                                      kListHeaderSize +
+                                              kListSize]
+                                    : 0;
+    });
+    return sizes;
+}
+
+std::pair<std::vector<Tensor>, Tensor> HashMultiMap::Gather(
+        const Tensor& input_keys) {
+    Tensor buf_indices, masks;
+    internal_->Find(input_keys, buf_indices, masks);
+
+    const int64_t length = input_keys.GetLength();
+    Tensor row_splits = Tensor::Zeros({length + 1}, core::Int64, GetDevice());
+    const int64_t* headers = internal_->GetValueTensor().GetDataPtr<int64_t>();
+    const buf_index_t* buf_indices_ptr =
+            static_cast<const buf_index_t*>(buf_indices.GetDataPtr());
+    const bool* masks_ptr = masks.GetDataPtr<bool>();
+    int64_t* row_splits_ptr = row_splits.GetDataPtr<int64_t>();
+    ParallelFor(GetDevice(), length, [=] OPEN3D_DEVICE(int64_t i) {
+        if (masks_ptr[i]) {
+            row_splits_ptr[i + 1] =
+                    headers[buf_indices_ptr[i] * kListHeaderSize + kListSize];
+        }
+    });
+    utility::InclusivePrefixSum(row_splits_ptr + 1,
+                                row_splits_ptr + length + 1,
+                                row_splits_ptr + 1);
+    const int64_t total = row_splits_ptr[length];
+
+    std::vector<Tensor> output_values;
+    std::vector<const uint8_t*> src_ptrs;
+    std::vector<uint8_t*> dst_ptrs;
+    std::vector<int64_t> value_bytesizes;
+    for (size_t k = 0; k < page_values_.size(); ++k) {
+        SizeVector shape = element_shapes_value_[k];
+        shape.insert(shape.begin(), total);
+        output_values.emplace_back(shape, dtypes_value_[k], GetDevice());
+        src_ptrs.push_back(
+                static_cast<const uint8_t*>(page_values_[k].GetDataPtr()));
+        dst_ptrs.push_back(
+                static_cast<uint8_t*>(output_values.back().GetDataPtr()));
+        value_bytesizes.push_back(element_shapes_value_[k].NumElements() *
+                                  dtypes_value_[k].ByteSize());
+    }
+
+    // Copy the lists page by page. Lists have varying lengths, so they are
+    // scheduled dynamically.
+    const int64_t page_size = page_size_;
+    const int64_t* page_next_ptr = page_next_.GetDataPtr<int64_t>();
+    const int64_t num_values = static_cast<int64_t>(src_ptrs.size());
+    const uint8_t* const* src_ptrs_ptr = src_ptrs.data();
+    uint8_t* const* dst_ptrs_ptr = dst_ptrs.data();
+    const int64_t* value_bytesizes_ptr = value_bytesizes.data();
+    ParallelForOptions options{utility::ParallelSchedule::Dynamic, 16};
+    ParallelFor(GetDevice(), length, options, [=] OPEN3D_DEVICE(int64_t i) {
+        if (!masks_ptr[i]) {
+            return;
+        }
+        const int64_t* header = headers + buf_indices_ptr[i] * kListHeaderSize;
+        int64_t page = header[kListHead];
+        int64_t offset = row_splits_ptr[i];
+        int64_t remaining = row_splits_ptr[i + 1] - offset;
+        while (remaining > 0) {
+            const int64_t count = std::min(page_size, remaining);
+            for (int64_t k = 0; k < num_values; ++k) {
+                const int64_t bytesize = value_bytesizes_ptr[k];
+                std::memcpy(dst_ptrs_ptr[k] + offset * bytesize,
+                            src_ptrs_ptr[k] + page * page_size * bytesize,
+                            count * bytesize);
+            }
+            offset += count;
+            remaining -= count;
+            page = page_next_ptr[page];
+        }
+    });
+
+    return std::make_pair(output_values, row_splits);
+}
+
+Tensor HashMultiMap::GetActiveIndices() const {
+    return internal_->GetActiveIndices();
+}
+
+void HashMultiMap::Clear() {
+    internal_->Clear();
+    num_pages_ = 0;
+}
+
+int64_t HashMultiMap::Size() const { return internal_->Size(); }
+
+int64_t HashMultiMap::GetCapacity() const { return internal_->GetCapacity(); }
+
+int64_t HashMultiMap::GetPageCapacity() const {
+    return page_next_.GetLength();
+}
+
+Device HashMultiMap::GetDevice() const { return internal_->GetDevice(); }
+
+Tensor HashMultiMap::GetKeyTensor() const { return internal_->GetKeyTensor(); }
+
+}  // namespace core
+}  // namespace open3d
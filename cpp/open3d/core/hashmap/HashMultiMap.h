@@ -0,0 +1,140 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/hashmap/HashMap.h"
+
+namespace open3d {
+namespace core {
+
+/// A hash map from keys to append-only lists of values, e.g. the indices of
+/// the points in each voxel of a grid.
+///
+/// The lists are stored in a pool of pages of page_size elements. Each page
+/// stores the values in a structure of arrays, one array per value dtype and
+/// element shape, and the pages of a key are linked in insertion order. Values
+/// are appended in parallel to the last page of their key, and new pages are
+/// allocated at the end of the pool, which grows like a std::vector.
+///
+/// Keys cannot be erased individually; Clear() empties the map and the pool.
+/// Only supported on CPU.
+class HashMultiMap : public IsDevice {
+public:
+    /// Initialize a hash multimap given a key dtype and element shape, and a
+    /// vector of value dtypes and element shapes for the values stored in the
+    /// lists.
+    HashMultiMap(int64_t init_capacity,
+                 const Dtype& key_dtype,
+                 const SizeVector& key_element_shape,
+                 const std::vector<Dtype>& dtypes_value,
+                 const std::vector<SizeVector>& element_shapes_value,
+                 const Device& device,
+                 int64_t page_size = 64,
+                 const HashBackendType& backend = HashBackendType::Default);
+
+    /// Initialize a hash multimap with a single value array.
+    HashMultiMap(int64_t init_capacity,
+                 const Dtype& key_dtype,
+                 const SizeVector& key_element_shape,
+                 const Dtype& value_dtype,
+                 const SizeVector& value_element_shape,
+                 const Device& device,
+                 int64_t page_size = 64,
+                 const HashBackendType& backend = HashBackendType::Default);
+
+    /// Default destructor.
+    ~HashMultiMap() = default;
+
+    /// Reserve the internal hash map with the given key capacity.
+    void Reserve(int64_t capacity);
+
+    /// Parallel append arrays of values to the lists of their keys. Keys that
+    /// are not yet in the map are inserted with an empty list first. Keys may
+    /// be repeated; the order of the values appended to the same key in one
+    /// call is unspecified.
+    /// Return: output_buf_indices of the keys, see HashMap::Insert().
+    Tensor Append(const Tensor& input_keys, const Tensor& input_values);
+
+    /// Parallel append arrays of keys and a structure of value arrays.
+    Tensor Append(const Tensor& input_keys,
+                  const std::vector<Tensor>& input_values_soa);
+
+    /// Parallel find an array of keys in Tensor.
+    /// Return: output_buf_indices and output_masks, see HashMap::Find().
+    std::pair<Tensor, Tensor> Find(const Tensor& input_keys);
+
+    /// Get the list sizes (Int64) of an array of keys. The size of a key that
+    /// is not in the map is 0.
+    Tensor GetListSizes(const Tensor& input_keys);
+
+    /// Gather the lists of an array of keys into a ragged tensor.
+    /// Return: the values of all lists, concatenated in the order of the keys,
+    /// one tensor per value array, and the Int64 row splits of length
+    /// num_keys + 1, i.e. the values of key i are at [row_splits[i],
+    /// row_splits[i + 1]). The list of a key that is not in the map is empty.
+    std::pair<std::vector<Tensor>, Tensor> Gather(const Tensor& input_keys);
+
+    /// Parallel collect all indices in the buffer corresponding to the active
+    /// entries in the hash map.
+    Tensor GetActiveIndices() const;
+
+    /// Clear the stored keys and lists without reallocating the buffers.
+    void Clear();
+
+    /// Get the number of keys in the hash map.
+    int64_t Size() const;
+
+    /// Get the key capacity of the hash map.
+    int64_t GetCapacity() const;
+
+    /// Get the number of elements per page.
+    int64_t GetPageSize() const { return page_size_; }
+
+    /// Get the number of allocated pages.
+    int64_t GetNumPages() const { return num_pages_; }
+
+    /// Get the page capacity of the pool.
+    int64_t GetPageCapacity() const;
+
+    /// Get the device of the hash map.
+    Device GetDevice() const override;
+
+    /// Get the key tensor buffer to be used along with buf_indices and masks.
+    Tensor GetKeyTensor() const;
+
+    /// Get the internal hash map. Its only value array stores the list
+    /// headers.
+    const HashMap& GetHashMap() const { return *internal_; }
+
+private:
+    void Init(int64_t init_capacity,
+              const Dtype& key_dtype,
+              const SizeVector& key_element_shape,
+              const Device& device,
+              const HashBackendType& backend);
+    void ReservePages(int64_t num_pages);
+
+    std::shared_ptr<HashMap> internal_;
+    int64_t page_size_;
+    int64_t num_pages_ = 0;
+
+    std::vector<Dtype> dtypes_value_;
+    std::vector<SizeVector> element_shapes_value_;
+
+    /// The next page of each page, -1 for the last page of a list.
+    Tensor page_next_;
+    /// The page values, one tensor of shape {page_capacity * page_size,
+    /// element_shape...} per value array.
+    std::vector<Tensor> page_values_;
+};
+
+}  // namespace core
+}  // namespace open3d
@@ -11,7 +11,9 @@
 
 #include "open3d/core/ShapeUtil.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/UnaryEW.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Profiler.h"
 
 namespace open3d {
 namespace core {
@@ -30,6 +32,7 @@ void BinaryEW(const Tensor& lhs,
               const Tensor& rhs,
               Tensor& dst,
               BinaryEWOpCode op_code) {
+    OPEN3D_PROFILE_SCOPE("core::kernel::BinaryEW");
     // lhs, rhs and dst must be on the same device.
     for (auto device :
          std::vector<Device>({rhs.GetDevice(), dst.GetDevice()})) {
@@ -49,6 +52,23 @@ void BinaryEW(const Tensor& lhs,
                 broadcasted_input_shape, dst.GetShape());
     }
 
+    // Half precision dtypes are storage types. The operation is computed in
+    // Float32 and the result is rounded to the destination dtype.
+    const Dtype src_dtype = lhs.GetDtype();
+    if (src_dtype == core::Float16 || src_dtype == core::BFloat16) {
+        const Tensor lhs_float = lhs.To(core::Float32);
+        const Tensor rhs_float = rhs.To(core::Float32);
+        if (dst.GetDtype() == core::Bool) {
+            BinaryEW(lhs_float, rhs_float, dst, op_code);
+        } else {
+            Tensor dst_float = Tensor::Empty(dst.GetShape(), core::Float32,
+                                             dst.GetDevice());
+            BinaryEW(lhs_float, rhs_float, dst_float, op_code);
+            Copy(dst_float, dst);
+        }
+        return;
+    }
+
     if (lhs.IsCPU()) {
         BinaryEWCPU(lhs, rhs, dst, op_code);
     } else if (lhs.IsCUDA()) {
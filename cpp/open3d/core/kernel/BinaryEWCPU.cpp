@@ -5,6 +5,8 @@
 // SPDX-License-Identifier: MIT
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
+
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/Dtype.h"
 #include "open3d/core/Indexer.h"
@@ -23,11 +25,77 @@ namespace open3d {
 namespace core {
 namespace kernel {
 
-template <typename src_t, typename dst_t, typename element_func_t>
-static void LaunchBinaryEWKernel(const Indexer& indexer,
-                                 const element_func_t& element_func) {
+/// Number of elements processed by one task of the contiguous kernels. Chunks
+/// are large enough to amortize the scheduling and small enough to balance.
+static constexpr int64_t kContiguousChunkSize = 32768;
+
+using BinaryElementFunc = void (*)(const void*, const void*, void*);
+
+/// Fast path for contiguous operands of the same dtype, where one of the
+/// inputs may be a broadcasted scalar. The element kernel is a template
+/// argument, such that it is inlined into plain loops over whole chunks which
+/// the compiler vectorizes. Returns false if the operands are not supported.
+template <typename src_t, typename dst_t, BinaryElementFunc element_func>
+static bool LaunchContiguousBinaryEWKernel(const Indexer& indexer) {
+    if (!indexer.IsOutputContiguous()) {
+        return false;
+    }
+    const bool lhs_contiguous = indexer.IsInputContiguous(0);
+    const bool rhs_contiguous = indexer.IsInputContiguous(1);
+    const bool lhs_scalar =
+            !lhs_contiguous && indexer.IsInputScalarBroadcast(0);
+    const bool rhs_scalar =
+            !rhs_contiguous && indexer.IsInputScalarBroadcast(1);
+    if (!(lhs_contiguous || lhs_scalar) || !(rhs_contiguous || rhs_scalar)) {
+        return false;
+    }
+
+    const src_t* lhs = indexer.GetInputPtr<src_t>(0, 0);
+    const src_t* rhs = indexer.GetInputPtr<src_t>(1, 0);
+    dst_t* dst = indexer.GetOutputPtr<dst_t>(0);
+    const int64_t n = indexer.NumWorkloads();
+    auto chunk_func = [&](int64_t chunk_idx) {
+        const int64_t start = chunk_idx * kContiguousChunkSize;
+        const int64_t end = std::min(start + kContiguousChunkSize, n);
+        if (lhs_contiguous && rhs_contiguous) {
+            for (int64_t i = start; i < end; ++i) {
+                element_func(lhs + i, rhs + i, dst + i);
+            }
+        } else if (rhs_scalar && lhs_contiguous) {
+            const src_t rhs_value = *rhs;
+            for (int64_t i = start; i < end; ++i) {
+                element_func(lhs + i, &rhs_value, dst + i);
+            }
+        } else if (lhs_scalar && rhs_contiguous) {
+            const src_t lhs_value = *lhs;
+            for (int64_t i = start; i < end; ++i) {
+                element_func(&lhs_value, rhs + i, dst + i);
+            }
+        } else {
+            for (int64_t i = start; i < end; ++i) {
+                element_func(lhs, rhs, dst + i);
+            }
+        }
+    };
+
+    const int64_t num_chunks =
+            (n + kContiguousChunkSize - 1) / kContiguousChunkSize;
+    if (num_chunks <= 1) {
+        // Avoid the overhead of a parallel region for small tensors.
+        chunk_func(0);
+    } else {
+        ParallelFor(Device("CPU:0"), num_chunks, chunk_func);
+    }
+    return true;
+}
+
+template <typename src_t, typename dst_t, BinaryElementFunc element_func>
+static void LaunchBinaryEWKernel(const Indexer& indexer) {
+    if (LaunchContiguousBinaryEWKernel<src_t, dst_t, element_func>(indexer)) {
+        return;
+    }
     ParallelFor(Device("CPU:0"), indexer.NumWorkloads(),
-                [&indexer, &element_func](int64_t i) {
+                [&indexer](int64_t i) {
                     element_func(indexer.GetInputPtr<src_t>(0, i),
                                  indexer.GetInputPtr<src_t>(1, i),
                                  indexer.GetOutputPtr<dst_t>(i));
@@ -36,14 +104,16 @@ static void LaunchBinaryEWKernel(const Indexer& indexer,
 
 template <typename src_t,
           typename dst_t,
-          typename element_func_t,
+          BinaryElementFunc element_func,
           typename vec_func_t>
 static void LaunchBinaryEWKernel(const Indexer& indexer,
-                                 const element_func_t& element_func,
                                  const vec_func_t& vec_func) {
+    if (LaunchContiguousBinaryEWKernel<src_t, dst_t, element_func>(indexer)) {
+        return;
+    }
     ParallelFor(
             Device("CPU:0"), indexer.NumWorkloads(),
-            [&indexer, &element_func](int64_t i) {
+            [&indexer](int64_t i) {
                 element_func(indexer.GetInputPtr<src_t>(0, i),
                              indexer.GetInputPtr<src_t>(1, i),
                              indexer.GetOutputPtr<dst_t>(i));
@@ -170,70 +240,82 @@ void BinaryEWCPU(const Tensor& lhs,
             DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src_dtype, [&]() {
                 switch (op_code) {
                     case BinaryEWOpCode::LogicalAnd:
-                        LaunchBinaryEWKernel<scalar_t, scalar_t>(
+                        LaunchBinaryEWKernel<
+                                scalar_t, scalar_t,
+                                CPULogicalAndElementKernel<scalar_t, scalar_t>>(
                                 indexer,
-                                CPULogicalAndElementKernel<scalar_t, scalar_t>,
                                 OPEN3D_TEMPLATE_VECTORIZED(
                                         scalar_t, CPULogicalAndElementKernel,
                                         &ispc_indexer));
                         break;
                     case BinaryEWOpCode::LogicalOr:
-                        LaunchBinaryEWKernel<scalar_t, scalar_t>(
+                        LaunchBinaryEWKernel<
+                                scalar_t, scalar_t,
+                                CPULogicalOrElementKernel<scalar_t, scalar_t>>(
                                 indexer,
-                                CPULogicalOrElementKernel<scalar_t, scalar_t>,
                                 OPEN3D_TEMPLATE_VECTORIZED(
                                         scalar_t, CPULogicalOrElementKernel,
                                         &ispc_indexer));
                         break;
                     case BinaryEWOpCode::LogicalXor:
-                        LaunchBinaryEWKernel<scalar_t, scalar_t>(
+                        LaunchBinaryEWKernel<
+                                scalar_t, scalar_t,
+                                CPULogicalXorElementKernel<scalar_t, scalar_t>>(
                                 indexer,
-                                CPULogicalXorElementKernel<scalar_t, scalar_t>,
                                 OPEN3D_TEMPLATE_VECTORIZED(
                                         scalar_t, CPULogicalXorElementKernel,
                                         &ispc_indexer));
                         break;
                     case BinaryEWOpCode::Gt:
-                        LaunchBinaryEWKernel<scalar_t, scalar_t>(
-                                indexer, CPUGtElementKernel<scalar_t, scalar_t>,
+                        LaunchBinaryEWKernel<
+                                scalar_t, scalar_t,
+                                CPUGtElementKernel<scalar_t, scalar_t>>(
+                                indexer,
                                 OPEN3D_TEMPLATE_VECTORIZED(
                                         scalar_t, CPULogicalGtElementKernel,
                                         &ispc_indexer));
                         break;
                     case BinaryEWOpCode::Lt:
-                        LaunchBinaryEWKernel<scalar_t, scalar_t>(
-                                indexer, CPULtElementKernel<scalar_t, scalar_t>,
+                        LaunchBinaryEWKernel<
+                                scalar_t, scalar_t,
+                                CPULtElementKernel<scalar_t, scalar_t>>(
+                                indexer,
                                 OPEN3D_TEMPLATE_VECTORIZED(
                                         scalar_t, CPULogicalLtElementKernel,
                                         &ispc_indexer));
                         break;
                     case BinaryEWOpCode::Ge:
-                        LaunchBinaryEWKernel<scalar_t, scalar_t>(
+                        LaunchBinaryEWKernel<
+                                scalar_t, scalar_t,
+                                CPUGeqElementKernel<scalar_t, scalar_t>>(
                                 indexer,
-                                CPUGeqElementKernel<scalar_t, scalar_t>,
                                 OPEN3D_TEMPLATE_VECTORIZED(
                                         scalar_t, CPULogicalGeqElementKernel,
                                         &ispc_indexer));
                         break;
                     case BinaryEWOpCode::Le:
-                        LaunchBinaryEWKernel<scalar_t, scalar_t>(
+                        LaunchBinaryEWKernel<
+                                scalar_t, scalar_t,
+                                CPULeqElementKernel<scalar_t, scalar_t>>(
                                 indexer,
-                                CPULeqElementKernel<scalar_t, scalar_t>,
                                 OPEN3D_TEMPLATE_VECTORIZED(
                                         scalar_t, CPULogicalLeqElementKernel,
                                         &ispc_indexer));
                         break;
                     case BinaryEWOpCode::Eq:
-                        LaunchBinaryEWKernel<scalar_t, scalar_t>(
-                                indexer, CPUEqElementKernel<scalar_t, scalar_t>,
+                        LaunchBinaryEWKernel<
+                                scalar_t, scalar_t,
+                                CPUEqElementKernel<scalar_t, scalar_t>>(
+                                indexer,
                                 OPEN3D_TEMPLATE_VECTORIZED(
                                         scalar_t, CPULogicalEqElementKernel,
                                         &ispc_indexer));
                         break;
                     case BinaryEWOpCode::Ne:
-                        LaunchBinaryEWKernel<scalar_t, scalar_t>(
+                        LaunchBinaryEWKernel<
+                                scalar_t, scalar_t,
+                                CPUNeqElementKernel<scalar_t, scalar_t>>(
                                 indexer,
-                                CPUNeqElementKernel<scalar_t, scalar_t>,
                                 OPEN3D_TEMPLATE_VECTORIZED(
                                         scalar_t, CPULogicalNeqElementKernel,
                                         &ispc_indexer));
@@ -252,75 +334,90 @@ void BinaryEWCPU(const Tensor& lhs,
             DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src_dtype, [&]() {
                 switch (op_code) {
                     case BinaryEWOpCode::LogicalAnd:
-                        LaunchBinaryEWKernel<scalar_t, bool>(
+                        LaunchBinaryEWKernel<
+                                scalar_t, bool,
+                                CPULogicalAndElementKernel<scalar_t, bool>>(
                                 indexer,
-                                CPULogicalAndElementKernel<scalar_t, bool>,
                                 OPEN3D_TEMPLATE_VECTORIZED(
                                         scalar_t,
                                         CPULogicalAndElementKernel_bool,
                                         &ispc_indexer));
                         break;
                     case BinaryEWOpCode::LogicalOr:
-                        LaunchBinaryEWKernel<scalar_t, bool>(
+                        LaunchBinaryEWKernel<
+                                scalar_t, bool,
+                                CPULogicalOrElementKernel<scalar_t, bool>>(
                                 indexer,
-                                CPULogicalOrElementKernel<scalar_t, bool>,
                                 OPEN3D_TEMPLATE_VECTORIZED(
                                         scalar_t,
                                         CPULogicalOrElementKernel_bool,
                                         &ispc_indexer));
                         break;
                     case BinaryEWOpCode::LogicalXor:
-                        LaunchBinaryEWKernel<scalar_t, bool>(
+                        LaunchBinaryEWKernel<
+                                scalar_t, bool,
+                                CPULogicalXorElementKernel<scalar_t, bool>>(
                                 indexer,
-                                CPULogicalXorElementKernel<scalar_t, bool>,
                                 OPEN3D_TEMPLATE_VECTORIZED(
                                         scalar_t,
                                         CPULogicalXorElementKernel_bool,
                                         &ispc_indexer));
                         break;
                     case BinaryEWOpCode::Gt:
-                        LaunchBinaryEWKernel<scalar_t, bool>(
-                                indexer, CPUGtElementKernel<scalar_t, bool>,
+                        LaunchBinaryEWKernel<
+                                scalar_t, bool,
+                                CPUGtElementKernel<scalar_t, bool>>(
+                                indexer,
                                 OPEN3D_TEMPLATE_VECTORIZED(
                                         scalar_t,
                                         CPULogicalGtElementKernel_bool,
                                         &ispc_indexer));
                         break;
                     case BinaryEWOpCode::Lt:
-                        LaunchBinaryEWKernel<scalar_t, bool>(
-                                indexer, CPULtElementKernel<scalar_t, bool>,
+                        LaunchBinaryEWKernel<
+                                scalar_t, bool,
+                                CPULtElementKernel<scalar_t, bool>>(
+                                indexer,
                                 OPEN3D_TEMPLATE_VECTORIZED(
                                         scalar_t,
                                         CPULogicalLtElementKernel_bool,
                                         &ispc_indexer));
                         break;
                     case BinaryEWOpCode::Ge:
-                        LaunchBinaryEWKernel<scalar_t, bool>(
-                                indexer, CPUGeqElementKernel<scalar_t, bool>,
+                        LaunchBinaryEWKernel<
+                                scalar_t, bool,
+                                CPUGeqElementKernel<scalar_t, bool>>(
+                                indexer,
                                 OPEN3D_TEMPLATE_VECTORIZED(
                                         scalar_t,
                                         CPULogicalGeqElementKernel_bool,
                                         &ispc_indexer));
                         break;
                     case BinaryEWOpCode::Le:
-                        LaunchBinaryEWKernel<scalar_t, bool>(
-                                indexer, CPULeqElementKernel<scalar_t, bool>,
+                        LaunchBinaryEWKernel<
+                                scalar_t, bool,
+                                CPULeqElementKernel<scalar_t, bool>>(
+                                indexer,
                                 OPEN3D_TEMPLATE_VECTORIZED(
                                         scalar_t,
                                         CPULogicalLeqElementKernel_bool,
                                         &ispc_indexer));
                         break;
                     case BinaryEWOpCode::Eq:
-                        LaunchBinaryEWKernel<scalar_t, bool>(
-                                indexer, CPUEqElementKernel<scalar_t, bool>,
+                        LaunchBinaryEWKernel<
+                                scalar_t, bool,
+                                CPUEqElementKernel<scalar_t, bool>>(
+                                indexer,
                                 OPEN3D_TEMPLATE_VECTORIZED(
                                         scalar_t,
                                         CPULogicalEqElementKernel_bool,
                                         &ispc_indexer));
                         break;
                     case BinaryEWOpCode::Ne:
-                        LaunchBinaryEWKernel<scalar_t, bool>(
-                                indexer, CPUNeqElementKernel<scalar_t, bool>,
+                        LaunchBinaryEWKernel<
+                                scalar_t, bool,
+                                CPUNeqElementKernel<scalar_t, bool>>(
+                                indexer,
                                 OPEN3D_TEMPLATE_VECTORIZED(
                                         scalar_t,
                                         CPULogicalNeqElementKernel_bool,
@@ -341,12 +438,14 @@ void BinaryEWCPU(const Tensor& lhs,
         DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src_dtype, [&]() {
             switch (op_code) {
                 case BinaryEWOpCode::Maximum:
-                    LaunchBinaryEWKernel<scalar_t, scalar_t>(
-                            indexer, CPUMaxElementKernel<scalar_t>);
+                    LaunchBinaryEWKernel<scalar_t, scalar_t,
+                                         CPUMaxElementKernel<scalar_t>>(
+                            indexer);
                     break;
                 case BinaryEWOpCode::Minimum:
-                    LaunchBinaryEWKernel<scalar_t, scalar_t>(
-                            indexer, CPUMinElementKernel<scalar_t>);
+                    LaunchBinaryEWKernel<scalar_t, scalar_t,
+                                         CPUMinElementKernel<scalar_t>>(
+                            indexer);
                     break;
                 default:
                     break;
@@ -360,31 +459,35 @@ void BinaryEWCPU(const Tensor& lhs,
         DISPATCH_DTYPE_TO_TEMPLATE(src_dtype, [&]() {
             switch (op_code) {
                 case BinaryEWOpCode::Add:
-                    LaunchBinaryEWKernel<scalar_t, scalar_t>(
-                            indexer, CPUAddElementKernel<scalar_t>,
-                            OPEN3D_TEMPLATE_VECTORIZED(scalar_t,
-                                                       CPUAddElementKernel,
-                                                       &ispc_indexer));
+                    LaunchBinaryEWKernel<
+                            scalar_t, scalar_t, CPUAddElementKernel<scalar_t>>(
+                            indexer,
+                            OPEN3D_TEMPLATE_VECTORIZED(
+                                    scalar_t, CPUAddElementKernel,
+                                    &ispc_indexer));
                     break;
                 case BinaryEWOpCode::Sub:
-                    LaunchBinaryEWKernel<scalar_t, scalar_t>(
-                            indexer, CPUSubElementKernel<scalar_t>,
-                            OPEN3D_TEMPLATE_VECTORIZED(scalar_t,
-                                                       CPUSubElementKernel,
-                                                       &ispc_indexer));
+                    LaunchBinaryEWKernel<
+                            scalar_t, scalar_t, CPUSubElementKernel<scalar_t>>(
+                            indexer,
+                            OPEN3D_TEMPLATE_VECTORIZED(
+                                    scalar_t, CPUSubElementKernel,
+                                    &ispc_indexer));
                     break;
                 case BinaryEWOpCode::Mul:
-                    LaunchBinaryEWKernel<scalar_t, scalar_t>(
-                            indexer, CPUMulElementKernel<scalar_t>,
-                            OPEN3D_TEMPLATE_VECTORIZED(scalar_t,
-                                                       CPUMulElementKernel,
-                                                       &ispc_indexer));
+                    LaunchBinaryEWKernel<
+                            scalar_t, scalar_t, CPUMulElementKernel<scalar_t>>(
+                            indexer,
+                            OPEN3D_TEMPLATE_VECTORIZED(
+                                    scalar_t, CPUMulElementKernel,
+                                    &ispc_indexer));
                     break;
                 case BinaryEWOpCode::Div:
                     // The vectorized Div kernel causes a crash in the Python
                     // tests, so use scalar version instead.
-                    LaunchBinaryEWKernel<scalar_t, scalar_t>(
-                            indexer, CPUDivElementKernel<scalar_t>);
+                    LaunchBinaryEWKernel<scalar_t, scalar_t,
+                                         CPUDivElementKernel<scalar_t>>(
+                            indexer);
                     break;
                 default:
                     break;
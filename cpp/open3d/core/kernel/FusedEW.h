@@ -0,0 +1,63 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <vector>
+
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Scalar.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/BinaryEW.h"
+#include "open3d/core/kernel/UnaryEW.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+enum class FusedEWInstructionType {
+    Input,     // Loads an input tensor.
+    Constant,  // Broadcasts a scalar constant.
+    Unary,     // Applies a UnaryEWOpCode to one operand.
+    Binary,    // Applies a BinaryEWOpCode to two operands.
+};
+
+/// One step of a fused element-wise program. Operands refer to the results of
+/// previous instructions by their index in the program.
+struct FusedEWInstruction {
+    FusedEWInstructionType type_ = FusedEWInstructionType::Input;
+
+    /// Dtype of the result. Either the compute dtype of the program or Bool.
+    Dtype dtype_ = core::Undefined;
+
+    /// Index of the input tensor for Input instructions.
+    int64_t input_idx_ = -1;
+
+    /// Value for Constant instructions.
+    Scalar constant_ = Scalar(0);
+
+    UnaryEWOpCode unary_op_code_ = UnaryEWOpCode::Neg;
+    BinaryEWOpCode binary_op_code_ = BinaryEWOpCode::Add;
+
+    /// Operand instruction indices for Unary (lhs_) and Binary instructions.
+    int64_t lhs_ = -1;
+    int64_t rhs_ = -1;
+};
+
+/// Evaluates \p program element-wise in a single pass over \p dst. The inputs
+/// are broadcasted to the shape of \p dst and must have the compute dtype or
+/// Bool. All intermediate values are computed in the compute dtype, boolean
+/// values are represented by 0 and 1. The result of the last instruction is
+/// written to \p dst, which must have the dtype of the last instruction.
+void FusedEWCPU(const std::vector<Tensor>& inputs,
+                const std::vector<FusedEWInstruction>& program,
+                Dtype compute_dtype,
+                Tensor& dst);
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,375 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/Indexer.h"
+#include "open3d/core/ParallelFor.h"
+#include "open3d/core/kernel/FusedEW.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+/// Number of elements evaluated per instruction at once. The intermediate
+/// values of all instructions for one block stay in the cache.
+static constexpr int64_t kBlockSize = 1024;
+
+/// Number of elements processed by one task.
+static constexpr int64_t kTaskSize = 32 * kBlockSize;
+
+template <typename scalar_t>
+static void LoadInput(const Indexer& indexer,
+                      int64_t input_idx,
+                      bool is_bool,
+                      int64_t start,
+                      int64_t size,
+                      scalar_t* dst) {
+    if (indexer.IsInputScalarBroadcast(input_idx)) {
+        const scalar_t value =
+                is_bool ? static_cast<scalar_t>(
+                                  *indexer.GetInputPtr<bool>(input_idx, 0))
+                        : *indexer.GetInputPtr<scalar_t>(input_idx, 0);
+        std::fill(dst, dst + size, value);
+    } else if (indexer.IsInputContiguous(input_idx)) {
+        if (is_bool) {
+            const bool* src = indexer.GetInputPtr<bool>(input_idx, start);
+            for (int64_t i = 0; i < size; ++i) {
+                dst[i] = static_cast<scalar_t>(src[i]);
+            }
+        } else {
+            const scalar_t* src =
+                    indexer.GetInputPtr<scalar_t>(input_idx, start);
+            std::copy(src, src + size, dst);
+        }
+    } else {
+        for (int64_t i = 0; i < size; ++i) {
+            dst[i] = is_bool ? static_cast<scalar_t>(*indexer.GetInputPtr<bool>(
+                                       input_idx, start + i))
+                             : *indexer.GetInputPtr<scalar_t>(input_idx,
+                                                              start + i);
+        }
+    }
+}
+
+// The element functions match the ones of UnaryEWCPU.
+template <typename scalar_t>
+static void ApplyUnary(UnaryEWOpCode op_code,
+                       const scalar_t* src,
+                       int64_t size,
+                       scalar_t* dst) {
+    switch (op_code) {
+        case UnaryEWOpCode::Sqrt:
+            for (int64_t i = 0; i < size; ++i) {
+                dst[i] = static_cast<scalar_t>(std::sqrt(src[i]));
+            }
+            break;
+        case UnaryEWOpCode::Sin:
+            for (int64_t i = 0; i < size; ++i) {
+                dst[i] = static_cast<scalar_t>(std::sin(src[i]));
+            }
+            break;
+        case UnaryEWOpCode::Cos:
+            for (int64_t i = 0; i < size; ++i) {
+                dst[i] = static_cast<scalar_t>(std::cos(src[i]));
+            }
+            break;
+        case UnaryEWOpCode::Neg:
+            for (int64_t i = 0; i < size; ++i) {
+                dst[i] = static_cast<scalar_t>(-src[i]);
+            }
+            break;
+        case UnaryEWOpCode::Exp:
+            for (int64_t i = 0; i < size; ++i) {
+                dst[i] = static_cast<scalar_t>(std::exp(src[i]));
+            }
+            break;
+        case UnaryEWOpCode::Abs:
+            for (int64_t i = 0; i < size; ++i) {
+                dst[i] = static_cast<scalar_t>(
+                        std::abs(static_cast<double>(src[i])));
+            }
+            break;
+        case UnaryEWOpCode::IsNan:
+            for (int64_t i = 0; i < size; ++i) {
+                dst[i] = std::isnan(static_cast<float>(src[i]));
+            }
+            break;
+        case UnaryEWOpCode::IsInf:
+            for (int64_t i = 0; i < size; ++i) {
+                dst[i] = std::isinf(static_cast<float>(src[i]));
+            }
+            break;
+        case UnaryEWOpCode::IsFinite:
+            for (int64_t i = 0; i < size; ++i) {
+                dst[i] = std::isfinite(static_cast<float>(src[i]));
+            }
+            break;
+        case UnaryEWOpCode::Floor:
+            for (int64_t i = 0; i < size; ++i) {
+                dst[i] = static_cast<scalar_t>(
+                        std::floor(static_cast<double>(src[i])));
+            }
+            break;
+        case UnaryEWOpCode::Ceil:
+            for (int64_t i = 0; i < size; ++i) {
+                dst[i] = static_cast<scalar_t>(
+                        std::ceil(static_cast<double>(src[i])));
+            }
+            break;
+        case UnaryEWOpCode::Round:
+            for (int64_t i = 0; i < size; ++i) {
+                dst[i] = static_cast<scalar_t>(
+                        std::round(static_cast<double>(src[i])));
+            }
+            break;
+        case UnaryEWOpCode::Trunc:
+            for (int64_t i = 0; i < size; ++i) {
+                dst[i] = static_cast<scalar_t>(
+                        std::trunc(static_cast<double>(src[i])));
+            }
+            break;
+        case UnaryEWOpCode::LogicalNot:
+            for (int64_t i = 0; i < size; ++i) {
+                dst[i] = static_cast<scalar_t>(!static_cast<bool>(src[i]));
+            }
+            break;
+        default:
+            utility::LogError("Unsupported unary op in fused expression.");
+    }
+}
+
+template <typename scalar_t>
+static void ApplyArithmetic(BinaryEWOpCode op_code,
+                            const scalar_t* lhs,
+                            const scalar_t* rhs,
+                            int64_t size,
+                            scalar_t* dst) {
+    switch (op_code) {
+        case BinaryEWOpCode::Add:
+            for (int64_t i = 0; i < size; ++i) {
+                dst[i] = lhs[i] + rhs[i];
+            }
+            break;
+        case BinaryEWOpCode::Sub:
+            for (int64_t i = 0; i < size; ++i) {
+                dst[i] = lhs[i] - rhs[i];
+            }
+            break;
+        case BinaryEWOpCode::Mul:
+            for (int64_t i = 0; i < size; ++i) {
+                dst[i] = lhs[i] * rhs[i];
+            }
+            break;
+        case BinaryEWOpCode::Div:
+            for (int64_t i = 0; i < size; ++i) {
+                dst[i] = lhs[i] / rhs[i];
+            }
+            break;
+        default:
+            utility::LogError("Unsupported arithmetic op in fused expression.");
+    }
+}
+
+// Arithmetic on Bool is rejected when the expression is built, so the Bool
+// instantiation only evaluates logical and comparison ops.
+template <>
+void ApplyArithmetic<bool>(BinaryEWOpCode op_code,
+                           const bool* lhs,
+                           const bool* rhs,
+                           int64_t size,
+                           bool* dst) {
+    utility::LogError("Arithmetic ops are not supported for Bool.");
+}
+
+template <typename scalar_t>
+static void ApplyBinary(BinaryEWOpCode op_code,
+                        const scalar_t* lhs,
+                        const scalar_t* rhs,
+                        int64_t size,
+                        scalar_t* dst) {
+    switch (op_code) {
+        case BinaryEWOpCode::Add:
+        case BinaryEWOpCode::Sub:
+        case BinaryEWOpCode::Mul:
+        case BinaryEWOpCode::Div:
+            ApplyArithmetic<scalar_t>(op_code, lhs, rhs, size, dst);
+            break;
+        case BinaryEWOpCode::Maximum:
+            for (int64_t i = 0; i < size; ++i) {
+                dst[i] = std::max(lhs[i], rhs[i]);
+            }
+            break;
+        case BinaryEWOpCode::Minimum:
+            for (int64_t i = 0; i < size; ++i) {
+                dst[i] = std::min(lhs[i], rhs[i]);
+            }
+            break;
+        case BinaryEWOpCode::LogicalAnd:
+            for (int64_t i = 0; i < size; ++i) {
+                dst[i] = static_cast<scalar_t>(static_cast<bool>(lhs[i]) &&
+                                               static_cast<bool>(rhs[i]));
+            }
+            break;
+        case BinaryEWOpCode::LogicalOr:
+            for (int64_t i = 0; i < size; ++i) {
+                dst[i] = static_cast<scalar_t>(static_cast<bool>(lhs[i]) ||
+                                               static_cast<bool>(rhs[i]));
+            }
+            break;
+        case BinaryEWOpCode::LogicalXor:
+            for (int64_t i = 0; i < size; ++i) {
+                dst[i] = static_cast<scalar_t>(static_cast<bool>(lhs[i]) !=
+                                               static_cast<bool>(rhs[i]));
+            }
+            break;
+        case BinaryEWOpCode::Gt:
+            for (int64_t i = 0; i < size; ++i) {
+                dst[i] = static_cast<scalar_t>(lhs[i] > rhs[i]);
+            }
+            break;
+        case BinaryEWOpCode::Lt:
+            for (int64_t i = 0; i < size; ++i) {
+                dst[i] = static_cast<scalar_t>(lhs[i] < rhs[i]);
+            }
+            break;
+        case BinaryEWOpCode::Ge:
+            for (int64_t i = 0; i < size; ++i) {
+                dst[i] = static_cast<scalar_t>(lhs[i] >= rhs[i]);
+            }
+            break;
+        case BinaryEWOpCode::Le:
+            for (int64_t i = 0; i < size; ++i) {
+                dst[i] = static_cast<scalar_t>(lhs[i] <= rhs[i]);
+            }
+            break;
+        case BinaryEWOpCode::Eq:
+            for (int64_t i = 0; i < size; ++i) {
+                dst[i] = static_cast<scalar_t>(lhs[i] == rhs[i]);
+            }
+            break;
+        case BinaryEWOpCode::Ne:
+            for (int64_t i = 0; i < size; ++i) {
+                dst[i] = static_cast<scalar_t>(lhs[i] != rhs[i]);
+            }
+            break;
+        default:
+            utility::LogError("Unsupported binary op in fused expression.");
+    }
+}
+
+template <typename scalar_t, typename dst_t>
+static void StoreOutput(const Indexer& indexer,
+                        const scalar_t* src,
+                        int64_t start,
+                        int64_t size) {
+    if (indexer.IsOutputContiguous()) {
+        dst_t* dst = indexer.GetOutputPtr<dst_t>(start);
+        for (int64_t i = 0; i < size; ++i) {
+            dst[i] = static_cast<dst_t>(src[i]);
+        }
+    } else {
+        for (int64_t i = 0; i < size; ++i) {
+            *indexer.GetOutputPtr<dst_t>(start + i) =
+                    static_cast<dst_t>(src[i]);
+        }
+    }
+}
+
+void FusedEWCPU(const std::vector<Tensor>& inputs,
+                const std::vector<FusedEWInstruction>& program,
+                Dtype compute_dtype,
+                Tensor& dst) {
+    if (program.empty()) {
+        utility::LogError("Empty fused element-wise program.");
+    }
+    if (dst.GetDtype() != program.back().dtype_) {
+        utility::LogError("Output dtype {} does not match program dtype {}.",
+                          dst.GetDtype().ToString(),
+                          program.back().dtype_.ToString());
+    }
+
+    Indexer indexer(inputs, dst, DtypePolicy::NONE);
+    const int64_t n = indexer.NumWorkloads();
+    const int64_t num_instructions = static_cast<int64_t>(program.size());
+    const bool dst_is_bool = dst.GetDtype() == core::Bool;
+
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(compute_dtype, [&]() {
+        auto task_func = [&](int64_t task_idx) {
+            // One block of intermediate values per instruction.
+            std::unique_ptr<scalar_t[]> blocks(
+                    new scalar_t[num_instructions * kBlockSize]);
+            auto block = [&](int64_t instruction_idx) {
+                return blocks.get() + instruction_idx * kBlockSize;
+            };
+
+            const int64_t task_end = std::min((task_idx + 1) * kTaskSize, n);
+            for (int64_t start = task_idx * kTaskSize; start < task_end;
+                 start += kBlockSize) {
+                const int64_t size = std::min(kBlockSize, task_end - start);
+                for (int64_t idx = 0; idx < num_instructions; ++idx) {
+                    const FusedEWInstruction& instruction = program[idx];
+                    switch (instruction.type_) {
+                        case FusedEWInstructionType::Input:
+                            LoadInput<scalar_t>(
+                                    indexer, instruction.input_idx_,
+                                    inputs[instruction.input_idx_]
+                                                    .GetDtype() == core::Bool,
+                                    start, size, block(idx));
+                            break;
+                        case FusedEWInstructionType::Constant: {
+                            const scalar_t value =
+                                    instruction.dtype_ == core::Bool
+                                            ? static_cast<scalar_t>(
+                                                      instruction.constant_
+                                                              .To<bool>())
+                                            : instruction.constant_
+                                                      .To<scalar_t>();
+                            std::fill(block(idx), block(idx) + size, value);
+                            break;
+                        }
+                        case FusedEWInstructionType::Unary:
+                            ApplyUnary<scalar_t>(instruction.unary_op_code_,
+                                                 block(instruction.lhs_), size,
+                                                 block(idx));
+                            break;
+                        case FusedEWInstructionType::Binary:
+                            ApplyBinary<scalar_t>(instruction.binary_op_code_,
+                                                  block(instruction.lhs_),
+                                                  block(instruction.rhs_), size,
+                                                  block(idx));
+                            break;
+                    }
+                }
+                if (dst_is_bool) {
+                    StoreOutput<scalar_t, bool>(
+                            indexer, block(num_instructions - 1), start, size);
+                } else {
+                    StoreOutput<scalar_t, scalar_t>(
+                            indexer, block(num_instructions - 1), start, size);
+                }
+            }
+        };
+
+        const int64_t num_tasks = (n + kTaskSize - 1) / kTaskSize;
+        if (num_tasks <= 1) {
+            // Avoid the overhead of a parallel region for small tensors.
+            task_func(0);
+        } else {
+            ParallelFor(Device("CPU:0"), num_tasks, task_func);
+        }
+    });
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -13,6 +13,7 @@
 #include "open3d/core/Tensor.h"
 #include "open3d/core/kernel/UnaryEW.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Profiler.h"
 
 namespace open3d {
 namespace core {
@@ -23,6 +24,7 @@ void IndexGet(const Tensor& src,
               const std::vector<Tensor>& index_tensors,
               const SizeVector& indexed_shape,
               const SizeVector& indexed_strides) {
+    OPEN3D_PROFILE_SCOPE("core::kernel::IndexGet");
     // index_tensors has been preprocessed to be on the same device as src,
     // however, dst may be in a different device.
     if (dst.GetDevice() != src.GetDevice()) {
@@ -49,6 +51,7 @@ void IndexSet(const Tensor& src,
               const std::vector<Tensor>& index_tensors,
               const SizeVector& indexed_shape,
               const SizeVector& indexed_strides) {
+    OPEN3D_PROFILE_SCOPE("core::kernel::IndexSet");
     // index_tensors has been preprocessed to be on the same device as dst,
     // however, src may be on a different device.
     Tensor src_same_device = src.To(dst.GetDevice());
@@ -52,7 +52,7 @@ void IndexGetCPU(const Tensor& src,
             CPUCopyObjectElementKernel(src, dst, object_byte_size);
         });
     } else {
-        DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype, [&]() {
             LaunchAdvancedIndexerKernel(ai, CPUCopyElementKernel<scalar_t>);
         });
     }
@@ -72,7 +72,7 @@ void IndexSetCPU(const Tensor& src,
             CPUCopyObjectElementKernel(src, dst, object_byte_size);
         });
     } else {
-        DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype, [&]() {
             LaunchAdvancedIndexerKernel(ai, CPUCopyElementKernel<scalar_t>);
         });
     }
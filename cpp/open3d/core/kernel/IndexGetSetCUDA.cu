@@ -62,7 +62,7 @@ void IndexGetCUDA(const Tensor& src,
                     CUDACopyObjectElementKernel(src, dst, object_byte_size);
                 });
     } else {
-        DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype, [&]() {
             LaunchAdvancedIndexerKernel(
                     src.GetDevice(), ai,
                     // Need to wrap as extended CUDA lambda function
@@ -91,7 +91,7 @@ void IndexSetCUDA(const Tensor& src,
                     CUDACopyObjectElementKernel(src, dst, object_byte_size);
                 });
     } else {
-        DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype, [&]() {
             LaunchAdvancedIndexerKernel(
                     src.GetDevice(), ai,
                     // Need to wrap as extended CUDA lambda function
@@ -8,6 +8,7 @@
 #include "open3d/core/kernel/IndexReduction.h"
 
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Profiler.h"
 
 namespace open3d {
 namespace core {
@@ -17,6 +18,7 @@ void IndexAdd_(int64_t dim,
                const Tensor& index,
                const Tensor& src,
                Tensor& dst) {
+    OPEN3D_PROFILE_SCOPE("core::kernel::IndexAdd_");
     // Permute the reduction dimension to the first.
     SizeVector permute = {};
     for (int64_t d = 0; d <= dim; ++d) {
@@ -10,12 +10,14 @@
 #include "open3d/core/Device.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Profiler.h"
 
 namespace open3d {
 namespace core {
 namespace kernel {
 
 Tensor NonZero(const Tensor& src) {
+    OPEN3D_PROFILE_SCOPE("core::kernel::NonZero");
     if (src.IsCPU()) {
         return NonZeroCPU(src);
     } else if (src.IsCUDA()) {
@@ -8,6 +8,8 @@
 #include "open3d/core/kernel/Reduction.h"
 
 #include "open3d/core/SizeVector.h"
+#include "open3d/core/kernel/UnaryEW.h"
+#include "open3d/utility/Profiler.h"
 
 namespace open3d {
 namespace core {
@@ -18,6 +20,7 @@ void Reduction(const Tensor& src,
                const SizeVector& dims,
                bool keepdim,
                ReductionOpCode op_code) {
+    OPEN3D_PROFILE_SCOPE("core::kernel::Reduction");
     // For ArgMin and ArgMax, keepdim == false, and dims can only contain one or
     // all dimensions.
     if (s_arg_reduce_ops.find(op_code) != s_arg_reduce_ops.end()) {
@@ -58,6 +61,22 @@ void Reduction(const Tensor& src,
         return;
     }
 
+    // Half precision dtypes are storage types. The reduction is computed in
+    // Float32 and the result is rounded to the destination dtype.
+    const Dtype src_dtype = src.GetDtype();
+    if (src_dtype == core::Float16 || src_dtype == core::BFloat16) {
+        const Tensor src_float = src.To(core::Float32);
+        if (s_arg_reduce_ops.find(op_code) != s_arg_reduce_ops.end()) {
+            Reduction(src_float, dst, dims, keepdim, op_code);
+        } else {
+            Tensor dst_float = Tensor::Empty(dst.GetShape(), core::Float32,
+                                             dst.GetDevice());
+            Reduction(src_float, dst_float, dims, keepdim, op_code);
+            Copy(dst_float, dst);
+        }
+        return;
+    }
+
     // Always reshape to keepdim case. This reshaping is copy-free.
     if (!keepdim) {
         dst = dst.Reshape(keepdim_shape);
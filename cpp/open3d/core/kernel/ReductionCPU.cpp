@@ -5,7 +5,11 @@
 // SPDX-License-Identifier: MIT
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
+#include <functional>
 #include <limits>
+#include <tuple>
+#include <vector>
 
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/Indexer.h"
@@ -117,19 +121,24 @@ private:
                 (num_workloads + num_threads - 1) / num_threads;
         std::vector<scalar_t> thread_results(num_threads, identity);
 
-#pragma omp parallel for schedule(static) \
-        num_threads(utility::EstimateMaxThreads())
-        for (int64_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
-            int64_t start = thread_idx * workload_per_thread;
-            int64_t end = std::min(start + workload_per_thread, num_workloads);
-            for (int64_t workload_idx = start; workload_idx < end;
-                 ++workload_idx) {
-                scalar_t* src = reinterpret_cast<scalar_t*>(
-                        indexer.GetInputPtr(0, workload_idx));
-                thread_results[thread_idx] =
-                        element_kernel(*src, thread_results[thread_idx]);
-            }
-        }
+        utility::ParallelForRange(
+                0, num_threads, 1,
+                [&](int64_t thread_begin, int64_t thread_end) {
+                    for (int64_t thread_idx = thread_begin;
+                         thread_idx < thread_end; ++thread_idx) {
+                        int64_t start = thread_idx * workload_per_thread;
+                        int64_t end = std::min(start + workload_per_thread,
+                                               num_workloads);
+                        for (int64_t workload_idx = start; workload_idx < end;
+                             ++workload_idx) {
+                            scalar_t* src = reinterpret_cast<scalar_t*>(
+                                    indexer.GetInputPtr(0, workload_idx));
+                            thread_results[thread_idx] = element_kernel(
+                                    *src, thread_results[thread_idx]);
+                        }
+                    }
+                },
+                utility::ParallelSchedule::Static);
         scalar_t* dst = reinterpret_cast<scalar_t*>(indexer.GetOutputPtr(0));
         for (int64_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
             *dst = element_kernel(thread_results[thread_idx], *dst);
@@ -164,13 +173,17 @@ private:
                     "LaunchReductionKernelTwoPass instead.");
         }
 
-#pragma omp parallel for schedule(static) \
-        num_threads(utility::EstimateMaxThreads())
-        for (int64_t i = 0; i < indexer_shape[best_dim]; ++i) {
-            Indexer sub_indexer(indexer);
-            sub_indexer.ShrinkDim(best_dim, i, 1);
-            LaunchReductionKernelSerial<scalar_t>(sub_indexer, element_kernel);
-        }
+        utility::ParallelForRange(
+                0, indexer_shape[best_dim], 1,
+                [&](int64_t begin, int64_t end) {
+                    for (int64_t i = begin; i < end; ++i) {
+                        Indexer sub_indexer(indexer);
+                        sub_indexer.ShrinkDim(best_dim, i, 1);
+                        LaunchReductionKernelSerial<scalar_t>(sub_indexer,
+                                                              element_kernel);
+                    }
+                },
+                utility::ParallelSchedule::Static);
     }
 
 private:
@@ -191,29 +204,338 @@ public:
         // sub-iteration.
         int64_t num_output_elements = indexer_.NumOutputElements();
 
-#pragma omp parallel for schedule(static) \
-        num_threads(utility::EstimateMaxThreads())
-        for (int64_t output_idx = 0; output_idx < num_output_elements;
-             output_idx++) {
-            // sub_indexer.NumWorkloads() == ipo.
-            // sub_indexer's workload_idx is indexer_'s ipo_idx.
-            Indexer sub_indexer = indexer_.GetPerOutputIndexer(output_idx);
-            scalar_t dst_val = identity;
-            for (int64_t workload_idx = 0;
-                 workload_idx < sub_indexer.NumWorkloads(); workload_idx++) {
-                int64_t src_idx = workload_idx;
-                scalar_t* src_val = reinterpret_cast<scalar_t*>(
-                        sub_indexer.GetInputPtr(0, workload_idx));
-                int64_t* dst_idx = reinterpret_cast<int64_t*>(
-                        sub_indexer.GetOutputPtr(0, workload_idx));
-                std::tie(*dst_idx, dst_val) =
-                        reduce_func(src_idx, *src_val, *dst_idx, dst_val);
+        utility::ParallelForRange(
+                0, num_output_elements, 1,
+                [&](int64_t begin, int64_t end) {
+                    for (int64_t output_idx = begin; output_idx < end;
+                         output_idx++) {
+                        // sub_indexer.NumWorkloads() == ipo.
+                        // sub_indexer's workload_idx is indexer_'s ipo_idx.
+                        Indexer sub_indexer =
+                                indexer_.GetPerOutputIndexer(output_idx);
+                        scalar_t dst_val = identity;
+                        for (int64_t workload_idx = 0;
+                             workload_idx < sub_indexer.NumWorkloads();
+                             workload_idx++) {
+                            int64_t src_idx = workload_idx;
+                            scalar_t* src_val = reinterpret_cast<scalar_t*>(
+                                    sub_indexer.GetInputPtr(0, workload_idx));
+                            int64_t* dst_idx = reinterpret_cast<int64_t*>(
+                                    sub_indexer.GetOutputPtr(0, workload_idx));
+                            std::tie(*dst_idx, dst_val) = reduce_func(
+                                    src_idx, *src_val, *dst_idx, dst_val);
+                        }
+                    }
+                },
+                utility::ParallelSchedule::Static);
+    }
+
+private:
+    Indexer indexer_;
+};
+
+/// Reduction engine for contiguous tensors whose reduction dims are
+/// consecutive, e.g. Sum({0}) on a Nx3 tensor or Max({1}) on a NxM tensor.
+///
+/// The source is viewed as [outer, reduce, inner] and each outer slice is a
+/// contiguous array of reduce x inner elements. Elements are accumulated with
+/// direct pointer access into a small array of accumulators whose length is a
+/// multiple of inner, so that element i always lands in a lane of output
+/// column i % inner. The accumulation loop is element-wise and vectorizes for
+/// any inner size, including inner == 1 (reduction of the last dims) and small
+/// inner sizes such as 3 (reduction of the points of a Nx3 tensor).
+/// Accumulators are combined pairwise in blocks for floating point accuracy.
+class CPUContiguousReductionEngine {
+public:
+    CPUContiguousReductionEngine(const CPUContiguousReductionEngine&) = delete;
+    CPUContiguousReductionEngine& operator=(
+            const CPUContiguousReductionEngine&) = delete;
+    CPUContiguousReductionEngine(const Tensor& src,
+                                 Tensor& dst,
+                                 const SizeVector& dims)
+        : src_(src), dst_(dst) {
+        if (!IsSupported(src, dst, dims)) {
+            return;
+        }
+        const SizeVector& shape = src.GetShape();
+        const int64_t first_dim = *std::min_element(dims.begin(), dims.end());
+        const int64_t last_dim = *std::max_element(dims.begin(), dims.end());
+        for (int64_t dim = 0; dim < src.NumDims(); ++dim) {
+            if (dim < first_dim) {
+                outer_ *= shape[dim];
+            } else if (dim <= last_dim) {
+                reduce_ *= shape[dim];
+            } else {
+                inner_ *= shape[dim];
+            }
+        }
+    }
+
+    /// Returns true if the engine supports reducing \p src to \p dst over
+    /// \p dims, i.e. both tensors are contiguous and non-empty, and \p dims are
+    /// consecutive.
+    static bool IsSupported(const Tensor& src,
+                            const Tensor& dst,
+                            const SizeVector& dims) {
+        if (!src.IsContiguous() || !dst.IsContiguous() ||
+            src.NumElements() == 0 || dims.size() == 0) {
+            return false;
+        }
+        std::vector<bool> is_reduction_dim(src.NumDims(), false);
+        for (int64_t dim : dims) {
+            if (dim < 0 || dim >= src.NumDims() || is_reduction_dim[dim]) {
+                return false;
+            }
+            is_reduction_dim[dim] = true;
+        }
+        const int64_t first_dim = *std::min_element(dims.begin(), dims.end());
+        return first_dim + static_cast<int64_t>(dims.size()) - 1 ==
+               *std::max_element(dims.begin(), dims.end());
+    }
+
+    template <typename scalar_t, scalar_t (*reduce_func)(scalar_t, scalar_t)>
+    void Run(scalar_t identity) {
+        const scalar_t* src = src_.GetDataPtr<scalar_t>();
+        scalar_t* dst = dst_.GetDataPtr<scalar_t>();
+        const int64_t num_splits = GetNumSplits();
+        const int64_t num_lanes = GetNumLanes();
+
+        if (num_splits == 1) {
+            // Each task reduces a range of outer slices with one set of
+            // accumulators.
+            const int64_t num_tasks =
+                    IsLarge() ? std::min<int64_t>(outer_, GetNumThreads()) : 1;
+            ParallelForTasks(num_tasks, [&](int64_t task) {
+                std::vector<scalar_t> acc(num_lanes);
+                for (int64_t o = task * outer_ / num_tasks;
+                     o < (task + 1) * outer_ / num_tasks; ++o) {
+                    ReduceRows<scalar_t, reduce_func>(
+                            src + o * reduce_ * inner_, reduce_, inner_,
+                            num_lanes, identity, acc.data(), dst + o * inner_);
+                }
+            });
+            return;
+        }
+
+        // Splits the rows of each outer slice across threads and combines the
+        // partial results in order.
+        std::vector<scalar_t> partials(outer_ * num_splits * inner_);
+        ParallelForTasks(outer_ * num_splits, [&](int64_t task) {
+            const int64_t o = task / num_splits;
+            int64_t row_start, row_end;
+            std::tie(row_start, row_end) = GetSplitRows(task % num_splits,
+                                                        num_splits);
+            std::vector<scalar_t> acc(num_lanes);
+            ReduceRows<scalar_t, reduce_func>(
+                    src + (o * reduce_ + row_start) * inner_,
+                    row_end - row_start, inner_, num_lanes, identity,
+                    acc.data(), partials.data() + task * inner_);
+        });
+        for (int64_t o = 0; o < outer_; ++o) {
+            for (int64_t i = 0; i < inner_; ++i) {
+                scalar_t result = identity;
+                for (int64_t split = 0; split < num_splits; ++split) {
+                    result = reduce_func(
+                            partials[(o * num_splits + split) * inner_ + i],
+                            result);
+                }
+                dst[o * inner_ + i] = result;
+            }
+        }
+    }
+
+    /// Arg-reduction. compare_t{}(a, b) returns true if a is strictly better
+    /// than b. The first of equally good elements is selected.
+    template <typename scalar_t, typename compare_t>
+    void RunArg(scalar_t identity, Tensor& dst_acc) {
+        const scalar_t* src = src_.GetDataPtr<scalar_t>();
+        int64_t* dst_idx = dst_.GetDataPtr<int64_t>();
+        scalar_t* dst_val = dst_acc.GetDataPtr<scalar_t>();
+        const int64_t num_splits = GetNumSplits();
+
+        std::vector<int64_t> partial_idx(outer_ * num_splits * inner_);
+        std::vector<scalar_t> partial_val(outer_ * num_splits * inner_);
+        ParallelForTasks(outer_ * num_splits, [&](int64_t task) {
+            const int64_t o = task / num_splits;
+            int64_t row_start, row_end;
+            std::tie(row_start, row_end) = GetSplitRows(task % num_splits,
+                                                        num_splits);
+            int64_t* best_idx = partial_idx.data() + task * inner_;
+            scalar_t* best_val = partial_val.data() + task * inner_;
+            std::fill(best_idx, best_idx + inner_, 0);
+            std::fill(best_val, best_val + inner_, identity);
+            const scalar_t* rows = src + o * reduce_ * inner_;
+            for (int64_t r = row_start; r < row_end; ++r) {
+                const scalar_t* row = rows + r * inner_;
+                for (int64_t i = 0; i < inner_; ++i) {
+                    if (compare_t{}(row[i], best_val[i])) {
+                        best_val[i] = row[i];
+                        best_idx[i] = r;
+                    }
+                }
+            }
+        });
+        for (int64_t o = 0; o < outer_; ++o) {
+            for (int64_t i = 0; i < inner_; ++i) {
+                int64_t idx = partial_idx[o * num_splits * inner_ + i];
+                scalar_t val = partial_val[o * num_splits * inner_ + i];
+                for (int64_t split = 1; split < num_splits; ++split) {
+                    const int64_t k = (o * num_splits + split) * inner_ + i;
+                    if (compare_t{}(partial_val[k], val)) {
+                        idx = partial_idx[k];
+                        val = partial_val[k];
+                    }
+                }
+                dst_idx[o * inner_ + i] = idx;
+                dst_val[o * inner_ + i] = val;
             }
         }
     }
 
 private:
-    Indexer indexer_;
+    /// Target number of accumulator lanes.
+    static constexpr int64_t kNumLanes = 64;
+
+    /// Number of accumulator blocks that are reduced linearly before the
+    /// results are combined pairwise.
+    static constexpr int64_t kPairwiseBlockSize = 64;
+
+    /// Minimum number of elements to reduce in parallel.
+    static constexpr int64_t kParallelThreshold = 32768;
+
+    /// Returns a multiple of inner close to kNumLanes. Fewer lanes are used
+    /// for short slices, where folding the lanes would dominate.
+    int64_t GetNumLanes() const {
+        if (inner_ >= kNumLanes) {
+            return inner_;
+        }
+        int64_t num_lanes = kNumLanes;
+        while (num_lanes > 8 && num_lanes * 4 > reduce_ * inner_) {
+            num_lanes /= 2;
+        }
+        return inner_ * num_lanes / GreatestCommonDivisor(inner_, num_lanes);
+    }
+
+    static int64_t GreatestCommonDivisor(int64_t a, int64_t b) {
+        while (b != 0) {
+            int64_t tmp = a % b;
+            a = b;
+            b = tmp;
+        }
+        return a;
+    }
+
+    static int GetNumThreads() {
+        return utility::InParallel() ? 1 : utility::EstimateMaxThreads();
+    }
+
+    bool IsLarge() const {
+        return outer_ * reduce_ * inner_ >= kParallelThreshold;
+    }
+
+    /// Calls func(task) for each task in [0, num_tasks) on the task scheduler.
+    /// Small inputs and single tasks run in the calling thread.
+    template <typename func_t>
+    void ParallelForTasks(int64_t num_tasks, const func_t& func) const {
+        if (num_tasks <= 1 || !IsLarge()) {
+            for (int64_t task = 0; task < num_tasks; ++task) {
+                func(task);
+            }
+            return;
+        }
+        utility::ParallelForRange(
+                0, num_tasks, 1,
+                [&func](int64_t begin, int64_t end) {
+                    for (int64_t task = begin; task < end; ++task) {
+                        func(task);
+                    }
+                },
+                utility::ParallelSchedule::Static);
+    }
+
+    /// Number of row ranges each outer slice is split into, so that all
+    /// threads are busy when there are fewer outer slices than threads.
+    int64_t GetNumSplits() const {
+        const int64_t num_threads = GetNumThreads();
+        if (!IsLarge() || outer_ >= num_threads) {
+            return 1;
+        }
+        return std::min((num_threads + outer_ - 1) / outer_, reduce_);
+    }
+
+    std::pair<int64_t, int64_t> GetSplitRows(int64_t split,
+                                             int64_t num_splits) const {
+        const int64_t rows_per_split = (reduce_ + num_splits - 1) / num_splits;
+        const int64_t start = std::min(split * rows_per_split, reduce_);
+        const int64_t end = std::min(start + rows_per_split, reduce_);
+        return {start, end};
+    }
+
+    /// Reduces num_blocks x num_lanes contiguous elements into acc, which must
+    /// be initialized with the identity.
+    template <typename scalar_t, scalar_t (*reduce_func)(scalar_t, scalar_t)>
+    static void ReduceBlocks(const scalar_t* src,
+                             int64_t num_blocks,
+                             int64_t num_lanes,
+                             scalar_t identity,
+                             scalar_t* acc) {
+        if (num_blocks <= kPairwiseBlockSize) {
+            for (int64_t b = 0; b < num_blocks; ++b) {
+                const scalar_t* block = src + b * num_lanes;
+                for (int64_t l = 0; l < num_lanes; ++l) {
+                    acc[l] = reduce_func(block[l], acc[l]);
+                }
+            }
+            return;
+        }
+        const int64_t half = num_blocks / 2;
+        std::vector<scalar_t> acc_rhs(num_lanes, identity);
+        ReduceBlocks<scalar_t, reduce_func>(src, half, num_lanes, identity,
+                                            acc);
+        ReduceBlocks<scalar_t, reduce_func>(src + half * num_lanes,
+                                            num_blocks - half, num_lanes,
+                                            identity, acc_rhs.data());
+        for (int64_t l = 0; l < num_lanes; ++l) {
+            acc[l] = reduce_func(acc_rhs[l], acc[l]);
+        }
+    }
+
+    /// Reduces num_rows x inner contiguous elements into inner outputs, using
+    /// acc as the buffer for num_lanes accumulators.
+    template <typename scalar_t, scalar_t (*reduce_func)(scalar_t, scalar_t)>
+    static void ReduceRows(const scalar_t* src,
+                           int64_t num_rows,
+                           int64_t inner,
+                           int64_t num_lanes,
+                           scalar_t identity,
+                           scalar_t* acc,
+                           scalar_t* dst) {
+        const int64_t num_elements = num_rows * inner;
+        const int64_t num_blocks = num_elements / num_lanes;
+        std::fill(acc, acc + num_lanes, identity);
+        ReduceBlocks<scalar_t, reduce_func>(src, num_blocks, num_lanes,
+                                            identity, acc);
+
+        // The tail is a multiple of inner, since num_lanes is.
+        const scalar_t* tail = src + num_blocks * num_lanes;
+        for (int64_t l = 0; l < num_elements - num_blocks * num_lanes; ++l) {
+            acc[l] = reduce_func(tail[l], acc[l]);
+        }
+
+        for (int64_t i = 0; i < inner; ++i) {
+            scalar_t result = identity;
+            for (int64_t l = i; l < num_lanes; l += inner) {
+                result = reduce_func(acc[l], result);
+            }
+            dst[i] = result;
+        }
+    }
+
+    const Tensor& src_;
+    Tensor& dst_;
+    int64_t outer_ = 1;
+    int64_t reduce_ = 1;
+    int64_t inner_ = 1;
 };
 
 void ReductionCPU(const Tensor& src,
@@ -224,23 +546,40 @@ void ReductionCPU(const Tensor& src,
     if (s_regular_reduce_ops.find(op_code) != s_regular_reduce_ops.end()) {
         Indexer indexer({src}, dst, DtypePolicy::ALL_SAME, dims);
         CPUReductionEngine re(indexer);
+        CPUContiguousReductionEngine cre(src, dst, dims);
+        const bool is_contiguous =
+                CPUContiguousReductionEngine::IsSupported(src, dst, dims);
         DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
             scalar_t identity;
             switch (op_code) {
                 case ReductionOpCode::Sum:
                     identity = 0;
-                    dst.Fill(identity);
-                    re.Run(CPUSumReductionKernel<scalar_t>, identity);
+                    if (is_contiguous) {
+                        cre.Run<scalar_t, CPUSumReductionKernel<scalar_t>>(
+                                identity);
+                    } else {
+                        dst.Fill(identity);
+                        re.Run(CPUSumReductionKernel<scalar_t>, identity);
+                    }
                     break;
                 case ReductionOpCode::Prod:
                     identity = 1;
-                    dst.Fill(identity);
-                    re.Run(CPUProdReductionKernel<scalar_t>, identity);
+                    if (is_contiguous) {
+                        cre.Run<scalar_t, CPUProdReductionKernel<scalar_t>>(
+                                identity);
+                    } else {
+                        dst.Fill(identity);
+                        re.Run(CPUProdReductionKernel<scalar_t>, identity);
+                    }
                     break;
                 case ReductionOpCode::Min:
                     if (indexer.NumWorkloads() == 0) {
                         utility::LogError(
                                 "Zero-size Tensor does not support Min.");
+                    } else if (is_contiguous) {
+                        identity = std::numeric_limits<scalar_t>::max();
+                        cre.Run<scalar_t, CPUMinReductionKernel<scalar_t>>(
+                                identity);
                     } else {
                         identity = std::numeric_limits<scalar_t>::max();
                         dst.Fill(identity);
@@ -251,6 +590,10 @@ void ReductionCPU(const Tensor& src,
                     if (indexer.NumWorkloads() == 0) {
                         utility::LogError(
                                 "Zero-size Tensor does not support Max.");
+                    } else if (is_contiguous) {
+                        identity = std::numeric_limits<scalar_t>::lowest();
+                        cre.Run<scalar_t, CPUMaxReductionKernel<scalar_t>>(
+                                identity);
                     } else {
                         identity = std::numeric_limits<scalar_t>::lowest();
                         dst.Fill(identity);
@@ -271,6 +614,9 @@ void ReductionCPU(const Tensor& src,
 
         Indexer indexer({src}, {dst, dst_acc}, DtypePolicy::INPUT_SAME, dims);
         CPUArgReductionEngine re(indexer);
+        CPUContiguousReductionEngine cre(src, dst, dims);
+        const bool is_contiguous =
+                CPUContiguousReductionEngine::IsSupported(src, dst, dims);
         DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
             scalar_t identity;
             switch (op_code) {
@@ -278,6 +624,10 @@ void ReductionCPU(const Tensor& src,
                     if (indexer.NumWorkloads() == 0) {
                         utility::LogError(
                                 "Zero-size Tensor does not support ArgMin.");
+                    } else if (is_contiguous) {
+                        identity = std::numeric_limits<scalar_t>::max();
+                        cre.RunArg<scalar_t, std::less<scalar_t>>(identity,
+                                                                  dst_acc);
                     } else {
                         identity = std::numeric_limits<scalar_t>::max();
                         dst_acc.Fill(identity);
@@ -288,6 +638,10 @@ void ReductionCPU(const Tensor& src,
                     if (indexer.NumWorkloads() == 0) {
                         utility::LogError(
                                 "Zero-size Tensor does not support ArgMax.");
+                    } else if (is_contiguous) {
+                        identity = std::numeric_limits<scalar_t>::lowest();
+                        cre.RunArg<scalar_t, std::greater<scalar_t>>(identity,
+                                                                     dst_acc);
                     } else {
                         identity = std::numeric_limits<scalar_t>::lowest();
                         dst_acc.Fill(identity);
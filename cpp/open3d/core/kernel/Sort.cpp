@@ -0,0 +1,90 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/kernel/Sort.h"
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/TensorCheck.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Profiler.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+namespace {
+void CheckSortable(const Tensor& src, const std::string& op_name) {
+    if (src.NumDims() != 1) {
+        utility::LogError("{} only supports 1D tensors, but got {}D.", op_name,
+                          src.NumDims());
+    }
+    if (src.GetDtype() == core::Bool) {
+        utility::LogError("{} does not support Bool tensors.", op_name);
+    }
+    if (!src.IsCPU()) {
+        utility::LogError("{}: Unimplemented device {}.", op_name,
+                          src.GetDevice().ToString());
+    }
+}
+}  // namespace
+
+Tensor Sort(const Tensor& src, Tensor* indices) {
+    OPEN3D_PROFILE_SCOPE("core::kernel::Sort");
+    CheckSortable(src, "Sort");
+    return SortCPU(src.Contiguous(), indices);
+}
+
+std::tuple<Tensor, Tensor, Tensor> Unique(const Tensor& src) {
+    OPEN3D_PROFILE_SCOPE("core::kernel::Unique");
+    CheckSortable(src, "Unique");
+    return UniqueCPU(src.Contiguous());
+}
+
+Tensor SegmentReduce(const Tensor& src,
+                     const Tensor& row_splits,
+                     SegmentReductionOpCode op_code) {
+    OPEN3D_PROFILE_SCOPE("core::kernel::SegmentReduce");
+    if (src.NumDims() == 0) {
+        utility::LogError("SegmentReduce does not support 0D tensors.");
+    }
+    if (src.GetDtype() == core::Bool) {
+        utility::LogError("SegmentReduce does not support Bool tensors.");
+    }
+    if (op_code == SegmentReductionOpCode::Mean) {
+        AssertTensorDtypes(src, {Float32, Float64});
+    }
+    AssertTensorDtype(row_splits, core::Int64);
+    AssertTensorDevice(row_splits, src.GetDevice());
+    AssertTensorShape(row_splits, {utility::nullopt});
+    if (row_splits.GetLength() == 0) {
+        utility::LogError("row_splits must have at least one element.");
+    }
+    if (!src.IsCPU()) {
+        utility::LogError("SegmentReduce: Unimplemented device {}.",
+                          src.GetDevice().ToString());
+    }
+    const Tensor row_splits_contiguous = row_splits.Contiguous();
+    const int64_t* splits = row_splits_contiguous.GetDataPtr<int64_t>();
+    const int64_t num_segments = row_splits.GetLength() - 1;
+    if (splits[0] != 0 || splits[num_segments] != src.GetLength()) {
+        utility::LogError(
+                "row_splits must start with 0 and end with the number of "
+                "rows {}, but got {} and {}.",
+                src.GetLength(), splits[0], splits[num_segments]);
+    }
+    for (int64_t i = 0; i < num_segments; ++i) {
+        if (splits[i] > splits[i + 1]) {
+            utility::LogError("row_splits must be non-decreasing.");
+        }
+    }
+    return SegmentReduceCPU(src.Contiguous(), row_splits_contiguous, op_code);
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,43 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+enum class SegmentReductionOpCode { Sum, Mean, Min, Max };
+
+/// Sorts the 1D tensor src in ascending order. If indices is not nullptr, it
+/// is set to the Int64 indices of the sorted elements in src.
+Tensor Sort(const Tensor& src, Tensor* indices = nullptr);
+
+/// Returns the sorted unique elements of the 1D tensor src, the Int64 indices
+/// of the elements of src in the unique elements and the Int64 number of
+/// occurrences of each unique element.
+std::tuple<Tensor, Tensor, Tensor> Unique(const Tensor& src);
+
+/// Reduces the rows of src in each segment [row_splits[i], row_splits[i + 1])
+/// to one row.
+Tensor SegmentReduce(const Tensor& src,
+                     const Tensor& row_splits,
+                     SegmentReductionOpCode op_code);
+
+Tensor SortCPU(const Tensor& src, Tensor* indices);
+
+std::tuple<Tensor, Tensor, Tensor> UniqueCPU(const Tensor& src);
+
+Tensor SegmentReduceCPU(const Tensor& src,
+                        const Tensor& row_splits,
+                        SegmentReductionOpCode op_code);
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
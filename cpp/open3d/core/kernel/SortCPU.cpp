@@ -0,0 +1,134 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <numeric>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/ParallelFor.h"
+#include "open3d/core/kernel/Sort.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/ParallelScan.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+Tensor SortCPU(const Tensor& src, Tensor* indices) {
+    const int64_t n = src.GetLength();
+    Tensor dst = src.Clone();
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        scalar_t* dst_ptr = dst.GetDataPtr<scalar_t>();
+        if (indices) {
+            *indices = Tensor::Arange(0, n, 1, Int64, src.GetDevice());
+            utility::RadixSortPairs(dst_ptr, indices->GetDataPtr<int64_t>(),
+                                    n);
+        } else {
+            utility::RadixSort(dst_ptr, n);
+        }
+    });
+    return dst;
+}
+
+std::tuple<Tensor, Tensor, Tensor> UniqueCPU(const Tensor& src) {
+    const Device device = src.GetDevice();
+    const int64_t n = src.GetLength();
+    Tensor perm;
+    const Tensor sorted = SortCPU(src, &perm);
+    const int64_t* perm_ptr = perm.GetDataPtr<int64_t>();
+
+    // segment_ids[i] is the index of the unique element of sorted[i].
+    std::vector<int64_t> is_first(n), segment_ids(n);
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        const scalar_t* sorted_ptr = sorted.GetDataPtr<scalar_t>();
+        ParallelFor(device, n, [&](int64_t i) {
+            is_first[i] = i == 0 || sorted_ptr[i] != sorted_ptr[i - 1];
+        });
+    });
+    utility::InclusivePrefixSum(is_first.data(), is_first.data() + n,
+                                segment_ids.data());
+    const int64_t num_unique = n > 0 ? segment_ids[n - 1] : 0;
+
+    Tensor values({num_unique}, src.GetDtype(), device);
+    Tensor inverse({n}, Int64, device);
+    Tensor counts({num_unique}, Int64, device);
+    std::vector<int64_t> row_splits(num_unique + 1, n);
+    int64_t* inverse_ptr = inverse.GetDataPtr<int64_t>();
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        const scalar_t* sorted_ptr = sorted.GetDataPtr<scalar_t>();
+        scalar_t* values_ptr = values.GetDataPtr<scalar_t>();
+        ParallelFor(device, n, [&](int64_t i) {
+            const int64_t segment_id = segment_ids[i] - 1;
+            if (is_first[i]) {
+                values_ptr[segment_id] = sorted_ptr[i];
+                row_splits[segment_id] = i;
+            }
+            inverse_ptr[perm_ptr[i]] = segment_id;
+        });
+    });
+    int64_t* counts_ptr = counts.GetDataPtr<int64_t>();
+    ParallelFor(device, num_unique, [&](int64_t i) {
+        counts_ptr[i] = row_splits[i + 1] - row_splits[i];
+    });
+    return std::make_tuple(values, inverse, counts);
+}
+
+Tensor SegmentReduceCPU(const Tensor& src,
+                        const Tensor& row_splits,
+                        SegmentReductionOpCode op_code) {
+    const int64_t num_segments = row_splits.GetLength() - 1;
+    SizeVector dst_shape = src.GetShape();
+    dst_shape[0] = num_segments;
+    Tensor dst = Tensor::Zeros(dst_shape, src.GetDtype(), src.GetDevice());
+    const int64_t width = dst_shape.NumElements() /
+                          std::max<int64_t>(num_segments, 1);
+    const int64_t* splits = row_splits.GetDataPtr<int64_t>();
+
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        const scalar_t* src_ptr = src.GetDataPtr<scalar_t>();
+        scalar_t* dst_ptr = dst.GetDataPtr<scalar_t>();
+        // Segments of sorted keys are usually short, so the parallelism is
+        // over segments and each row is reduced sequentially.
+        ParallelFor(src.GetDevice(), num_segments, [&](int64_t s) {
+            const int64_t begin = splits[s];
+            const int64_t end = splits[s + 1];
+            if (begin == end) {
+                return;
+            }
+            scalar_t* dst_row = dst_ptr + s * width;
+            std::copy(src_ptr + begin * width, src_ptr + (begin + 1) * width,
+                      dst_row);
+            for (int64_t i = begin + 1; i < end; ++i) {
+                const scalar_t* src_row = src_ptr + i * width;
+                for (int64_t j = 0; j < width; ++j) {
+                    switch (op_code) {
+                        case SegmentReductionOpCode::Sum:
+                        case SegmentReductionOpCode::Mean:
+                            dst_row[j] += src_row[j];
+                            break;
+                        case SegmentReductionOpCode::Min:
+                            dst_row[j] = std::min(dst_row[j], src_row[j]);
+                            break;
+                        case SegmentReductionOpCode::Max:
+                            dst_row[j] = std::max(dst_row[j], src_row[j]);
+                            break;
+                    }
+                }
+            }
+            if (op_code == SegmentReductionOpCode::Mean) {
+                for (int64_t j = 0; j < width; ++j) {
+                    dst_row[j] /= static_cast<scalar_t>(end - begin);
+                }
+            }
+        });
+    });
+    return dst;
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -10,12 +10,14 @@
 #include "open3d/core/ShapeUtil.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Profiler.h"
 
 namespace open3d {
 namespace core {
 namespace kernel {
 
 void UnaryEW(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
+    OPEN3D_PROFILE_SCOPE("core::kernel::UnaryEW");
     // Check shape
     if (!shape_util::CanBeBrocastedToShape(src.GetShape(), dst.GetShape())) {
         utility::LogError("Shape {} can not be broadcasted to {}.",
@@ -30,6 +32,22 @@ void UnaryEW(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
                           src_device.ToString(), dst_device.ToString());
     }
 
+    // Half precision dtypes are storage types. The operation is computed in
+    // Float32 and the result is rounded to the destination dtype.
+    const Dtype src_dtype = src.GetDtype();
+    if (src_dtype == core::Float16 || src_dtype == core::BFloat16) {
+        const Tensor src_float = src.To(core::Float32);
+        if (dst.GetDtype() == core::Bool) {
+            UnaryEW(src_float, dst, op_code);
+        } else {
+            Tensor dst_float =
+                    Tensor::Empty(dst.GetShape(), core::Float32, dst_device);
+            UnaryEW(src_float, dst_float, op_code);
+            Copy(dst_float, dst);
+        }
+        return;
+    }
+
     if (src_device.IsCPU()) {
         UnaryEWCPU(src, dst, op_code);
     } else if (src_device.IsCUDA()) {
@@ -44,6 +62,7 @@ void UnaryEW(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
 }
 
 void Copy(const Tensor& src, Tensor& dst) {
+    OPEN3D_PROFILE_SCOPE("core::kernel::Copy");
     // Check shape
     if (!shape_util::CanBeBrocastedToShape(src.GetShape(), dst.GetShape())) {
         utility::LogError("Shape {} can not be broadcasted to {}.",
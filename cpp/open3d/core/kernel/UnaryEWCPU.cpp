@@ -5,6 +5,7 @@
 // SPDX-License-Identifier: MIT
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <cmath>
 #include <cstring>
 
@@ -36,11 +37,51 @@ static void LaunchUnaryEWKernel(const Indexer& indexer,
                 });
 }
 
-template <typename src_t, typename dst_t, typename element_func_t>
-static void LaunchUnaryEWKernel(const Indexer& indexer,
-                                const element_func_t& element_func) {
+/// Number of elements processed by one task of the contiguous kernel. Chunks
+/// are large enough to amortize the scheduling and small enough to balance.
+static constexpr int64_t kContiguousChunkSize = 32768;
+
+using UnaryElementFunc = void (*)(const void*, void*);
+
+/// Fast path for a contiguous input and output. The element kernel is a
+/// template argument, such that it is inlined into plain loops over whole
+/// chunks which the compiler vectorizes. Returns false if the operands are not
+/// contiguous.
+template <typename src_t, typename dst_t, UnaryElementFunc element_func>
+static bool LaunchContiguousUnaryEWKernel(const Indexer& indexer) {
+    if (!indexer.IsInputContiguous(0) || !indexer.IsOutputContiguous()) {
+        return false;
+    }
+
+    const src_t* src = indexer.GetInputPtr<src_t>(0, 0);
+    dst_t* dst = indexer.GetOutputPtr<dst_t>(0);
+    const int64_t n = indexer.NumWorkloads();
+    auto chunk_func = [&](int64_t chunk_idx) {
+        const int64_t start = chunk_idx * kContiguousChunkSize;
+        const int64_t end = std::min(start + kContiguousChunkSize, n);
+        for (int64_t i = start; i < end; ++i) {
+            element_func(src + i, dst + i);
+        }
+    };
+
+    const int64_t num_chunks =
+            (n + kContiguousChunkSize - 1) / kContiguousChunkSize;
+    if (num_chunks <= 1) {
+        // Avoid the overhead of a parallel region for small tensors.
+        chunk_func(0);
+    } else {
+        ParallelFor(Device("CPU:0"), num_chunks, chunk_func);
+    }
+    return true;
+}
+
+template <typename src_t, typename dst_t, UnaryElementFunc element_func>
+static void LaunchUnaryEWKernel(const Indexer& indexer) {
+    if (LaunchContiguousUnaryEWKernel<src_t, dst_t, element_func>(indexer)) {
+        return;
+    }
     ParallelFor(Device("CPU:0"), indexer.NumWorkloads(),
-                [&indexer, &element_func](int64_t i) {
+                [&indexer](int64_t i) {
                     element_func(indexer.GetInputPtr<src_t>(0, i),
                                  indexer.GetOutputPtr<dst_t>(i));
                 });
@@ -48,14 +89,16 @@ static void LaunchUnaryEWKernel(const Indexer& indexer,
 
 template <typename src_t,
           typename dst_t,
-          typename element_func_t,
+          UnaryElementFunc element_func,
           typename vec_func_t>
 static void LaunchUnaryEWKernel(const Indexer& indexer,
-                                const element_func_t& element_func,
                                 const vec_func_t& vec_func) {
+    if (LaunchContiguousUnaryEWKernel<src_t, dst_t, element_func>(indexer)) {
+        return;
+    }
     ParallelFor(
             Device("CPU:0"), indexer.NumWorkloads(),
-            [&indexer, &element_func](int64_t i) {
+            [&indexer](int64_t i) {
                 element_func(indexer.GetInputPtr<src_t>(0, i),
                              indexer.GetOutputPtr<dst_t>(i));
             },
@@ -174,7 +217,7 @@ void CopyCPU(const Tensor& src, Tensor& dst) {
                src.NumElements() == 1 && !src_dtype.IsObject()) {
         int64_t num_elements = dst.NumElements();
 
-        DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dst_dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dst_dtype, [&]() {
             scalar_t scalar_element = src.To(dst_dtype).Item<scalar_t>();
             scalar_t* dst_ptr = static_cast<scalar_t*>(dst.GetDataPtr());
             ParallelFor(Device("CPU:0"), num_elements,
@@ -191,12 +234,13 @@ void CopyCPU(const Tensor& src, Tensor& dst) {
             });
 
         } else {
-            DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src_dtype, [&]() {
+            DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(src_dtype, [&]() {
                 using src_t = scalar_t;
-                DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dst_dtype, [&]() {
+                DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dst_dtype, [&]() {
                     using dst_t = scalar_t;
-                    LaunchUnaryEWKernel<src_t, dst_t>(
-                            indexer, CPUCopyElementKernel<src_t, dst_t>);
+                    LaunchUnaryEWKernel<src_t, dst_t,
+                                        CPUCopyElementKernel<src_t, dst_t>>(
+                            indexer);
                 });
             });
         }
@@ -223,11 +267,12 @@ void UnaryEWCPU(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
             ispc::Indexer ispc_indexer = indexer.ToISPC();
 #endif
             DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src_dtype, [&]() {
-                LaunchUnaryEWKernel<scalar_t, scalar_t>(
-                        indexer, CPULogicalNotElementKernel<scalar_t, scalar_t>,
-                        OPEN3D_TEMPLATE_VECTORIZED(scalar_t,
-                                                   CPULogicalNotElementKernel,
-                                                   &ispc_indexer));
+                LaunchUnaryEWKernel<
+                        scalar_t, scalar_t,
+                        CPULogicalNotElementKernel<scalar_t, scalar_t>>(
+                        indexer, OPEN3D_TEMPLATE_VECTORIZED(
+                                scalar_t, CPULogicalNotElementKernel,
+                                &ispc_indexer));
             });
         } else if (dst_dtype == core::Bool) {
             Indexer indexer({src}, dst, DtypePolicy::INPUT_SAME_OUTPUT_BOOL);
@@ -235,9 +280,9 @@ void UnaryEWCPU(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
             ispc::Indexer ispc_indexer = indexer.ToISPC();
 #endif
             DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src_dtype, [&]() {
-                LaunchUnaryEWKernel<scalar_t, bool>(
-                        indexer, CPULogicalNotElementKernel<scalar_t, bool>,
-                        OPEN3D_TEMPLATE_VECTORIZED(
+                LaunchUnaryEWKernel<scalar_t, bool,
+                                    CPULogicalNotElementKernel<scalar_t, bool>>(
+                        indexer, OPEN3D_TEMPLATE_VECTORIZED(
                                 scalar_t, CPULogicalNotElementKernel_bool,
                                 &ispc_indexer));
             });
@@ -256,21 +301,23 @@ void UnaryEWCPU(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
 #endif
         DISPATCH_DTYPE_TO_TEMPLATE(src_dtype, [&]() {
             if (op_code == UnaryEWOpCode::IsNan) {
-                LaunchUnaryEWKernel<scalar_t, bool>(
-                        indexer, CPUIsNanElementKernel<scalar_t>,
-                        OPEN3D_TEMPLATE_VECTORIZED(scalar_t,
-                                                   CPUIsNanElementKernel,
-                                                   &ispc_indexer));
+                LaunchUnaryEWKernel<scalar_t, bool,
+                                    CPUIsNanElementKernel<scalar_t>>(
+                        indexer, OPEN3D_TEMPLATE_VECTORIZED(
+                                scalar_t, CPUIsNanElementKernel,
+                                &ispc_indexer));
             } else if (op_code == UnaryEWOpCode::IsInf) {
                 // A vectorized isinf function is not defined, so use scalar
                 // version instead.
-                LaunchUnaryEWKernel<scalar_t, bool>(
-                        indexer, CPUIsInfElementKernel<scalar_t>);
+                LaunchUnaryEWKernel<scalar_t, bool,
+                                    CPUIsInfElementKernel<scalar_t>>(
+                        indexer);
             } else if (op_code == UnaryEWOpCode::IsFinite) {
                 // A vectorized isfinite function is not defined, so use scalar
                 // version instead.
-                LaunchUnaryEWKernel<scalar_t, bool>(
-                        indexer, CPUIsFiniteElementKernel<scalar_t>);
+                LaunchUnaryEWKernel<scalar_t, bool,
+                                    CPUIsFiniteElementKernel<scalar_t>>(
+                        indexer);
             }
         });
     } else {
@@ -282,77 +329,77 @@ void UnaryEWCPU(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
             switch (op_code) {
                 case UnaryEWOpCode::Sqrt:
                     assert_dtype_is_float(src_dtype);
-                    LaunchUnaryEWKernel<scalar_t, scalar_t>(
-                            indexer, CPUSqrtElementKernel<scalar_t>,
-                            OPEN3D_TEMPLATE_VECTORIZED(scalar_t,
-                                                       CPUSqrtElementKernel,
-                                                       &ispc_indexer));
+                    LaunchUnaryEWKernel<scalar_t, scalar_t,
+                                        CPUSqrtElementKernel<scalar_t>>(
+                            indexer, OPEN3D_TEMPLATE_VECTORIZED(
+                                    scalar_t, CPUSqrtElementKernel,
+                                    &ispc_indexer));
                     break;
                 case UnaryEWOpCode::Sin:
                     assert_dtype_is_float(src_dtype);
-                    LaunchUnaryEWKernel<scalar_t, scalar_t>(
-                            indexer, CPUSinElementKernel<scalar_t>,
-                            OPEN3D_TEMPLATE_VECTORIZED(scalar_t,
-                                                       CPUSinElementKernel,
-                                                       &ispc_indexer));
+                    LaunchUnaryEWKernel<scalar_t, scalar_t,
+                                        CPUSinElementKernel<scalar_t>>(
+                            indexer, OPEN3D_TEMPLATE_VECTORIZED(
+                                    scalar_t, CPUSinElementKernel,
+                                    &ispc_indexer));
                     break;
                 case UnaryEWOpCode::Cos:
                     assert_dtype_is_float(src_dtype);
-                    LaunchUnaryEWKernel<scalar_t, scalar_t>(
-                            indexer, CPUCosElementKernel<scalar_t>,
-                            OPEN3D_TEMPLATE_VECTORIZED(scalar_t,
-                                                       CPUCosElementKernel,
-                                                       &ispc_indexer));
+                    LaunchUnaryEWKernel<scalar_t, scalar_t,
+                                        CPUCosElementKernel<scalar_t>>(
+                            indexer, OPEN3D_TEMPLATE_VECTORIZED(
+                                    scalar_t, CPUCosElementKernel,
+                                    &ispc_indexer));
                     break;
                 case UnaryEWOpCode::Neg:
-                    LaunchUnaryEWKernel<scalar_t, scalar_t>(
-                            indexer, CPUNegElementKernel<scalar_t>,
-                            OPEN3D_TEMPLATE_VECTORIZED(scalar_t,
-                                                       CPUNegElementKernel,
-                                                       &ispc_indexer));
+                    LaunchUnaryEWKernel<scalar_t, scalar_t,
+                                        CPUNegElementKernel<scalar_t>>(
+                            indexer, OPEN3D_TEMPLATE_VECTORIZED(
+                                    scalar_t, CPUNegElementKernel,
+                                    &ispc_indexer));
                     break;
                 case UnaryEWOpCode::Exp:
                     assert_dtype_is_float(src_dtype);
-                    LaunchUnaryEWKernel<scalar_t, scalar_t>(
-                            indexer, CPUExpElementKernel<scalar_t>,
-                            OPEN3D_TEMPLATE_VECTORIZED(scalar_t,
-                                                       CPUExpElementKernel,
-                                                       &ispc_indexer));
+                    LaunchUnaryEWKernel<scalar_t, scalar_t,
+                                        CPUExpElementKernel<scalar_t>>(
+                            indexer, OPEN3D_TEMPLATE_VECTORIZED(
+                                    scalar_t, CPUExpElementKernel,
+                                    &ispc_indexer));
                     break;
                 case UnaryEWOpCode::Abs:
-                    LaunchUnaryEWKernel<scalar_t, scalar_t>(
-                            indexer, CPUAbsElementKernel<scalar_t>,
-                            OPEN3D_TEMPLATE_VECTORIZED(scalar_t,
-                                                       CPUAbsElementKernel,
-                                                       &ispc_indexer));
+                    LaunchUnaryEWKernel<scalar_t, scalar_t,
+                                        CPUAbsElementKernel<scalar_t>>(
+                            indexer, OPEN3D_TEMPLATE_VECTORIZED(
+                                    scalar_t, CPUAbsElementKernel,
+                                    &ispc_indexer));
                     break;
                 case UnaryEWOpCode::Floor:
-                    LaunchUnaryEWKernel<scalar_t, scalar_t>(
-                            indexer, CPUFloorElementKernel<scalar_t>,
-                            OPEN3D_TEMPLATE_VECTORIZED(scalar_t,
-                                                       CPUFloorElementKernel,
-                                                       &ispc_indexer));
+                    LaunchUnaryEWKernel<scalar_t, scalar_t,
+                                        CPUFloorElementKernel<scalar_t>>(
+                            indexer, OPEN3D_TEMPLATE_VECTORIZED(
+                                    scalar_t, CPUFloorElementKernel,
+                                    &ispc_indexer));
                     break;
                 case UnaryEWOpCode::Ceil:
-                    LaunchUnaryEWKernel<scalar_t, scalar_t>(
-                            indexer, CPUCeilElementKernel<scalar_t>,
-                            OPEN3D_TEMPLATE_VECTORIZED(scalar_t,
-                                                       CPUCeilElementKernel,
-                                                       &ispc_indexer));
+                    LaunchUnaryEWKernel<scalar_t, scalar_t,
+                                        CPUCeilElementKernel<scalar_t>>(
+                            indexer, OPEN3D_TEMPLATE_VECTORIZED(
+                                    scalar_t, CPUCeilElementKernel,
+                                    &ispc_indexer));
                     break;
                 case UnaryEWOpCode::Round:
-                    LaunchUnaryEWKernel<scalar_t, scalar_t>(
-                            indexer, CPURoundElementKernel<scalar_t>,
-                            OPEN3D_TEMPLATE_VECTORIZED(scalar_t,
-                                                       CPURoundElementKernel,
-                                                       &ispc_indexer));
+                    LaunchUnaryEWKernel<scalar_t, scalar_t,
+                                        CPURoundElementKernel<scalar_t>>(
+                            indexer, OPEN3D_TEMPLATE_VECTORIZED(
+                                    scalar_t, CPURoundElementKernel,
+                                    &ispc_indexer));
                     break;
                 case UnaryEWOpCode::Trunc:
-                    LaunchUnaryEWKernel<scalar_t, scalar_t>(
-                            indexer, CPUTruncElementKernel<scalar_t>,
-                            OPEN3D_TEMPLATE_VECTORIZED(scalar_t,
-                                                       CPUTruncElementKernel,
-                                                       &ispc_indexer));
+                    LaunchUnaryEWKernel<scalar_t, scalar_t,
+                                        CPUTruncElementKernel<scalar_t>>(
+                            indexer, OPEN3D_TEMPLATE_VECTORIZED(
+                                    scalar_t, CPUTruncElementKernel,
+                                    &ispc_indexer));
                     break;
                 default:
                     utility::LogError("Unimplemented op_code for UnaryEWCPU");
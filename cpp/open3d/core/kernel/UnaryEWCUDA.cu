@@ -178,7 +178,7 @@ void CopyCUDA(const Tensor& src, Tensor& dst) {
                    src.NumElements() == 1 && !src_dtype.IsObject()) {
             int64_t num_elements = dst.NumElements();
 
-            DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dst_dtype, [&]() {
+            DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dst_dtype, [&]() {
                 scalar_t scalar_element = src.To(dst_dtype).Item<scalar_t>();
                 scalar_t* dst_ptr = static_cast<scalar_t*>(dst.GetDataPtr());
                 ParallelFor(src_device, num_elements,
@@ -201,19 +201,21 @@ void CopyCUDA(const Tensor& src, Tensor& dst) {
                         });
 
             } else {
-                DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src_dtype, [&]() {
+                DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(src_dtype, [&]() {
                     using src_t = scalar_t;
-                    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dst_dtype, [&]() {
-                        using dst_t = scalar_t;
-                        LaunchUnaryEWKernel<src_t, dst_t>(
-                                src_device, indexer,
-                                // Need to wrap as extended CUDA lambda function
-                                [] OPEN3D_HOST_DEVICE(const void* src,
-                                                      void* dst) {
-                                    CUDACopyElementKernel<src_t, dst_t>(src,
-                                                                        dst);
-                                });
-                    });
+                    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(
+                            dst_dtype, [&]() {
+                                using dst_t = scalar_t;
+                                LaunchUnaryEWKernel<src_t, dst_t>(
+                                        src_device, indexer,
+                                        // Need to wrap as extended CUDA lambda
+                                        // function
+                                        [] OPEN3D_HOST_DEVICE(const void* src,
+                                                              void* dst) {
+                                            CUDACopyElementKernel<src_t, dst_t>(
+                                                    src, dst);
+                                        });
+                            });
                 });
             }
         } else {
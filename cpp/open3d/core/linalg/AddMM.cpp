@@ -10,6 +10,7 @@
 #include <unordered_map>
 
 #include "open3d/core/CUDAUtils.h"
+#include "open3d/utility/Profiler.h"
 
 namespace open3d {
 namespace core {
@@ -19,6 +20,7 @@ void AddMM(const Tensor& A,
            Tensor& output,
            double alpha,
            double beta) {
+    OPEN3D_PROFILE_SCOPE("core::linalg::AddMM");
     AssertTensorDevice(B, A.GetDevice());
     AssertTensorDtype(B, A.GetDtype());
     AssertTensorDevice(output, A.GetDevice());
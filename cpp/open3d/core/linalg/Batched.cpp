@@ -0,0 +1,182 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/linalg/Batched.h"
+
+#include "open3d/core/TensorCheck.h"
+#include "open3d/core/linalg/Det.h"
+#include "open3d/core/linalg/Inverse.h"
+#include "open3d/core/linalg/LeastSquares.h"
+#include "open3d/core/linalg/SVD.h"
+#include "open3d/core/linalg/Solve.h"
+
+namespace open3d {
+namespace core {
+
+namespace {
+
+/// Checks that A is a batch of matrices and returns {batch_size, m, n}.
+SizeVector CheckBatchedMatrices(const Tensor& A) {
+    AssertTensorDtypes(A, {Float32, Float64});
+    const SizeVector A_shape = A.GetShape();
+    if (A_shape.size() != 3) {
+        utility::LogError("Tensor A must be 3D, but got {}D", A_shape.size());
+    }
+    if (A_shape[1] == 0 || A_shape[2] == 0) {
+        utility::LogError(
+                "Tensor shapes should not contain dimensions with zero.");
+    }
+    return A_shape;
+}
+
+void CheckSquare(const SizeVector& A_shape) {
+    if (A_shape[1] != A_shape[2]) {
+        utility::LogError(
+                "Tensor A must contain square matrices, but got {} x {}.",
+                A_shape[1], A_shape[2]);
+    }
+}
+
+/// Checks that B is a batch of vectors or matrices with m rows, and returns B
+/// as a contiguous {batch_size, m, k} tensor.
+Tensor CheckBatchedRightHandSide(const Tensor& A, const Tensor& B) {
+    AssertTensorDtype(B, A.GetDtype());
+    AssertTensorDevice(B, A.GetDevice());
+    const SizeVector B_shape = B.GetShape();
+    if (B_shape.size() != 2 && B_shape.size() != 3) {
+        utility::LogError(
+                "Tensor B must be 2D (batch of vectors) or 3D (batch of "
+                "matrices), but got {}D",
+                B_shape.size());
+    }
+    if (B_shape[0] != A.GetShape(0) || B_shape[1] != A.GetShape(1)) {
+        utility::LogError("Tensor A and B's first two dimensions mismatch.");
+    }
+    if (B_shape.size() == 3 && B_shape[2] == 0) {
+        utility::LogError(
+                "Tensor shapes should not contain dimensions with zero.");
+    }
+    return B.Reshape({B_shape[0], B_shape[1],
+                      B_shape.size() == 3 ? B_shape[2] : 1})
+            .Contiguous();
+}
+
+bool UseBatchedKernels(const Tensor& A, int64_t n) {
+    return A.IsCPU() && n <= kBatchedLinalgMaxSize;
+}
+
+}  // namespace
+
+void BatchedDet(const Tensor& A, Tensor& output) {
+    const SizeVector A_shape = CheckBatchedMatrices(A);
+    CheckSquare(A_shape);
+    const int64_t batch_size = A_shape[0];
+
+    output = Tensor::Empty({batch_size}, A.GetDtype(), A.GetDevice());
+    if (UseBatchedKernels(A, A_shape[1])) {
+        BatchedDetCPU(A.Contiguous(), output);
+    } else {
+        for (int64_t i = 0; i < batch_size; ++i) {
+            output[i] = Det(A[i]);
+        }
+    }
+}
+
+void BatchedInverse(const Tensor& A, Tensor& output) {
+    const SizeVector A_shape = CheckBatchedMatrices(A);
+    CheckSquare(A_shape);
+    const int64_t batch_size = A_shape[0];
+
+    output = Tensor::Empty(A_shape, A.GetDtype(), A.GetDevice());
+    if (UseBatchedKernels(A, A_shape[1])) {
+        BatchedInverseCPU(A.Contiguous(), output);
+    } else {
+        for (int64_t i = 0; i < batch_size; ++i) {
+            Tensor output_i;
+            Inverse(A[i], output_i);
+            output[i] = output_i;
+        }
+    }
+}
+
+void BatchedSolve(const Tensor& A, const Tensor& B, Tensor& X) {
+    const SizeVector A_shape = CheckBatchedMatrices(A);
+    CheckSquare(A_shape);
+    const Tensor B_3d = CheckBatchedRightHandSide(A, B);
+    const int64_t batch_size = A_shape[0];
+
+    if (UseBatchedKernels(A, A_shape[1])) {
+        X = B_3d.Clone();
+        BatchedSolveCPU(A.Contiguous(), X);
+    } else {
+        X = Tensor::Empty(B_3d.GetShape(), A.GetDtype(), A.GetDevice());
+        for (int64_t i = 0; i < batch_size; ++i) {
+            Tensor X_i;
+            Solve(A[i], B_3d[i], X_i);
+            X[i] = X_i;
+        }
+    }
+    X = X.Reshape(B.GetShape());
+}
+
+void BatchedLeastSquares(const Tensor& A, const Tensor& B, Tensor& X) {
+    const SizeVector A_shape = CheckBatchedMatrices(A);
+    const Tensor B_3d = CheckBatchedRightHandSide(A, B);
+    const int64_t batch_size = A_shape[0];
+    const int64_t m = A_shape[1];
+    const int64_t n = A_shape[2];
+    const int64_t k = B_3d.GetShape(2);
+    if (m < n) {
+        utility::LogError("Tensor A shape must satisfy rows({}) > cols({}).", m,
+                          n);
+    }
+
+    X = Tensor::Empty({batch_size, n, k}, A.GetDtype(), A.GetDevice());
+    if (UseBatchedKernels(A, n)) {
+        BatchedLeastSquaresCPU(A.Contiguous(), B_3d, X);
+    } else {
+        for (int64_t i = 0; i < batch_size; ++i) {
+            Tensor X_i;
+            LeastSquares(A[i], B_3d[i], X_i);
+            X[i] = X_i;
+        }
+    }
+    if (B.NumDims() == 2) {
+        X = X.Reshape({batch_size, n});
+    }
+}
+
+void BatchedSVD(const Tensor& A, Tensor& U, Tensor& S, Tensor& VT) {
+    const SizeVector A_shape = CheckBatchedMatrices(A);
+    const int64_t batch_size = A_shape[0];
+    const int64_t m = A_shape[1];
+    const int64_t n = A_shape[2];
+    if (m < n) {
+        utility::LogError("Only support m >= n, but got {} and {} matrix", m,
+                          n);
+    }
+
+    const Dtype dtype = A.GetDtype();
+    const Device device = A.GetDevice();
+    U = Tensor::Empty({batch_size, m, m}, dtype, device);
+    S = Tensor::Empty({batch_size, n}, dtype, device);
+    VT = Tensor::Empty({batch_size, n, n}, dtype, device);
+    if (A.IsCPU() && m == 3 && n == 3) {
+        BatchedSVD3x3CPU(A.Contiguous(), U, S, VT);
+    } else {
+        for (int64_t i = 0; i < batch_size; ++i) {
+            Tensor U_i, S_i, VT_i;
+            SVD(A[i], U_i, S_i, VT_i);
+            U[i] = U_i;
+            S[i] = S_i;
+            VT[i] = VT_i;
+        }
+    }
+}
+
+}  // namespace core
+}  // namespace open3d
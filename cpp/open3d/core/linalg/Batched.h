@@ -0,0 +1,57 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+
+/// Largest matrix size n handled by the fixed-size batched kernels. Larger
+/// matrices, CUDA tensors and SVDs other than 3 x 3 fall back to the LAPACK
+/// path, one matrix at a time.
+constexpr int64_t kBatchedLinalgMaxSize = 6;
+
+/// Computes the determinants of a batch of square matrices. A has shape
+/// {batch_size, n, n} and output has shape {batch_size}.
+void BatchedDet(const Tensor& A, Tensor& output);
+
+/// Computes the inverses of a batch of square matrices. A and output have
+/// shape {batch_size, n, n}.
+void BatchedInverse(const Tensor& A, Tensor& output);
+
+/// Solves A[i] X[i] = B[i] with LU decomposition for a batch of square
+/// matrices. A has shape {batch_size, n, n}, B and X have shape
+/// {batch_size, n} or {batch_size, n, k}.
+void BatchedSolve(const Tensor& A, const Tensor& B, Tensor& X);
+
+/// Solves min |A[i] X[i] - B[i]| for a batch of matrices. A has shape
+/// {batch_size, m, n} with m >= n, B has shape {batch_size, m} or
+/// {batch_size, m, k} and X has shape {batch_size, n} or {batch_size, n, k}.
+/// The fixed-size kernels use a Householder QR decomposition of A.
+void BatchedLeastSquares(const Tensor& A, const Tensor& B, Tensor& X);
+
+/// Computes the SVD decompositions A[i] = U[i] S[i] VT[i] of a batch of
+/// matrices. A has shape {batch_size, m, n} with m >= n, U has shape
+/// {batch_size, m, m}, S has shape {batch_size, n} and VT has shape
+/// {batch_size, n, n}. The singular values are non-negative and in
+/// descending order.
+void BatchedSVD(const Tensor& A, Tensor& U, Tensor& S, Tensor& VT);
+
+void BatchedDetCPU(const Tensor& A, Tensor& output);
+
+void BatchedInverseCPU(const Tensor& A, Tensor& output);
+
+void BatchedSolveCPU(const Tensor& A, Tensor& X);
+
+void BatchedLeastSquaresCPU(const Tensor& A, const Tensor& B, Tensor& X);
+
+void BatchedSVD3x3CPU(const Tensor& A, Tensor& U, Tensor& S, Tensor& VT);
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,244 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include <Eigen/QR>
+#include <Eigen/SVD>
+#include <algorithm>
+#include <atomic>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/ParallelFor.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/linalg/Batched.h"
+#include "open3d/core/linalg/kernel/Matrix.h"
+
+namespace open3d {
+namespace core {
+
+/// Calls the lambda with the compile-time constant matrix_size set to N, for
+/// N in [1, kBatchedLinalgMaxSize].
+#define DISPATCH_MATRIX_SIZE_TO_TEMPLATE(N, ...)                     \
+    [&] {                                                            \
+        switch (N) {                                                 \
+            case 1: {                                                \
+                constexpr int matrix_size = 1;                       \
+                return __VA_ARGS__();                                \
+            }                                                        \
+            case 2: {                                                \
+                constexpr int matrix_size = 2;                       \
+                return __VA_ARGS__();                                \
+            }                                                        \
+            case 3: {                                                \
+                constexpr int matrix_size = 3;                       \
+                return __VA_ARGS__();                                \
+            }                                                        \
+            case 4: {                                                \
+                constexpr int matrix_size = 4;                       \
+                return __VA_ARGS__();                                \
+            }                                                        \
+            case 5: {                                                \
+                constexpr int matrix_size = 5;                       \
+                return __VA_ARGS__();                                \
+            }                                                        \
+            case 6: {                                                \
+                constexpr int matrix_size = 6;                       \
+                return __VA_ARGS__();                                \
+            }                                                        \
+            default:                                                 \
+                utility::LogError("Unsupported matrix size {}.", N); \
+        }                                                            \
+    }()
+
+void BatchedDetCPU(const Tensor& A, Tensor& output) {
+    const int64_t batch_size = A.GetShape(0);
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(A.GetDtype(), [&]() {
+        DISPATCH_MATRIX_SIZE_TO_TEMPLATE(A.GetShape(1), [&]() {
+            constexpr int N = matrix_size;
+            const scalar_t* A_ptr = A.GetDataPtr<scalar_t>();
+            scalar_t* output_ptr = output.GetDataPtr<scalar_t>();
+            ParallelFor(A.GetDevice(), batch_size, [&](int64_t workload_idx) {
+                const scalar_t* A_i = A_ptr + workload_idx * N * N;
+                if (N == 2) {
+                    output_ptr[workload_idx] = linalg::kernel::det2x2(A_i);
+                } else if (N == 3) {
+                    output_ptr[workload_idx] = linalg::kernel::det3x3(A_i);
+                } else {
+                    scalar_t LU[N * N];
+                    int ipiv[N];
+                    std::copy(A_i, A_i + N * N, LU);
+                    output_ptr[workload_idx] =
+                            linalg::kernel::lu_nxn_<scalar_t, N>(LU, ipiv);
+                }
+            });
+        });
+    });
+}
+
+void BatchedInverseCPU(const Tensor& A, Tensor& output) {
+    const int64_t batch_size = A.GetShape(0);
+    std::atomic<bool> singular(false);
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(A.GetDtype(), [&]() {
+        DISPATCH_MATRIX_SIZE_TO_TEMPLATE(A.GetShape(1), [&]() {
+            constexpr int N = matrix_size;
+            const scalar_t* A_ptr = A.GetDataPtr<scalar_t>();
+            scalar_t* output_ptr = output.GetDataPtr<scalar_t>();
+            ParallelFor(A.GetDevice(), batch_size, [&](int64_t workload_idx) {
+                const scalar_t* A_i = A_ptr + workload_idx * N * N;
+                scalar_t* output_i = output_ptr + workload_idx * N * N;
+                scalar_t LU[N * N];
+                int ipiv[N];
+                std::copy(A_i, A_i + N * N, LU);
+                if (linalg::kernel::lu_nxn_<scalar_t, N>(LU, ipiv) == 0) {
+                    singular = true;
+                    return;
+                }
+                for (int i = 0; i < N * N; ++i) {
+                    output_i[i] = i % (N + 1) == 0 ? 1 : 0;
+                }
+                linalg::kernel::lu_solve_nxn_<scalar_t, N>(LU, ipiv, output_i,
+                                                           N);
+            });
+        });
+    });
+    if (singular) {
+        utility::LogError("BatchedInverse: singular condition detected.");
+    }
+}
+
+void BatchedSolveCPU(const Tensor& A, Tensor& X) {
+    const int64_t batch_size = A.GetShape(0);
+    const int64_t k = X.GetShape(2);
+    std::atomic<bool> singular(false);
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(A.GetDtype(), [&]() {
+        DISPATCH_MATRIX_SIZE_TO_TEMPLATE(A.GetShape(1), [&]() {
+            constexpr int N = matrix_size;
+            const scalar_t* A_ptr = A.GetDataPtr<scalar_t>();
+            scalar_t* X_ptr = X.GetDataPtr<scalar_t>();
+            ParallelFor(A.GetDevice(), batch_size, [&](int64_t workload_idx) {
+                const scalar_t* A_i = A_ptr + workload_idx * N * N;
+                scalar_t LU[N * N];
+                int ipiv[N];
+                std::copy(A_i, A_i + N * N, LU);
+                if (linalg::kernel::lu_nxn_<scalar_t, N>(LU, ipiv) == 0) {
+                    singular = true;
+                    return;
+                }
+                linalg::kernel::lu_solve_nxn_<scalar_t, N>(
+                        LU, ipiv, X_ptr + workload_idx * N * k, k);
+            });
+        });
+    });
+    if (singular) {
+        utility::LogError("BatchedSolve: singular condition detected.");
+    }
+}
+
+void BatchedLeastSquaresCPU(const Tensor& A, const Tensor& B, Tensor& X) {
+    const int64_t batch_size = A.GetShape(0);
+    const int64_t m = A.GetShape(1);
+    const int64_t k = B.GetShape(2);
+    std::atomic<bool> singular(false);
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(A.GetDtype(), [&]() {
+        DISPATCH_MATRIX_SIZE_TO_TEMPLATE(A.GetShape(2), [&]() {
+            constexpr int N = matrix_size;
+            const scalar_t* A_ptr = A.GetDataPtr<scalar_t>();
+            const scalar_t* B_ptr = B.GetDataPtr<scalar_t>();
+            scalar_t* X_ptr = X.GetDataPtr<scalar_t>();
+            ParallelFor(A.GetDevice(), batch_size, [&](int64_t workload_idx) {
+                const scalar_t* A_i = A_ptr + workload_idx * m * N;
+                const scalar_t* B_i = B_ptr + workload_idx * m * k;
+                scalar_t* X_i = X_ptr + workload_idx * N * k;
+
+                // Householder QR instead of the normal equations, which
+                // would square the condition number of A. The rows are
+                // reduced in blocks of N: the triangular factor R of the
+                // previous rows is stacked onto the next block and factored
+                // again with a fixed-size QR, which also updates Q^T B in X_i.
+                using MatrixR = Eigen::Matrix<scalar_t, N, N>;
+                using MatrixRA = Eigen::Matrix<scalar_t, 2 * N, N>;
+                using VectorRB = Eigen::Matrix<scalar_t, 2 * N, 1>;
+                using VectorX = Eigen::Matrix<scalar_t, N, 1>;
+                MatrixR R = MatrixR::Zero();
+                std::fill(X_i, X_i + N * k, 0);
+                for (int64_t r0 = 0; r0 < m; r0 += N) {
+                    const int64_t num_rows = std::min<int64_t>(N, m - r0);
+                    MatrixRA RA = MatrixRA::Zero();
+                    RA.template topRows<N>() = R;
+                    for (int64_t r = 0; r < num_rows; ++r) {
+                        for (int j = 0; j < N; ++j) {
+                            RA(N + r, j) = A_i[(r0 + r) * N + j];
+                        }
+                    }
+                    const Eigen::HouseholderQR<MatrixRA> qr(RA);
+                    R = qr.matrixQR()
+                                .template topRows<N>()
+                                .template triangularView<Eigen::Upper>();
+                    for (int64_t j = 0; j < k; ++j) {
+                        VectorRB rb = VectorRB::Zero();
+                        for (int i = 0; i < N; ++i) {
+                            rb(i) = X_i[i * k + j];
+                        }
+                        for (int64_t r = 0; r < num_rows; ++r) {
+                            rb(N + r) = B_i[(r0 + r) * k + j];
+                        }
+                        rb.applyOnTheLeft(qr.householderQ().adjoint());
+                        for (int i = 0; i < N; ++i) {
+                            X_i[i * k + j] = rb(i);
+                        }
+                    }
+                }
+
+                if ((R.diagonal().array() == 0).any()) {
+                    singular = true;
+                    return;
+                }
+                for (int64_t j = 0; j < k; ++j) {
+                    VectorX x;
+                    for (int i = 0; i < N; ++i) {
+                        x(i) = X_i[i * k + j];
+                    }
+                    R.template triangularView<Eigen::Upper>().solveInPlace(x);
+                    for (int i = 0; i < N; ++i) {
+                        X_i[i * k + j] = x(i);
+                    }
+                }
+            });
+        });
+    });
+    if (singular) {
+        utility::LogError(
+                "BatchedLeastSquares: singular condition detected.");
+    }
+}
+
+void BatchedSVD3x3CPU(const Tensor& A, Tensor& U, Tensor& S, Tensor& VT) {
+    const int64_t batch_size = A.GetShape(0);
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(A.GetDtype(), [&]() {
+        using Matrix3 = Eigen::Matrix<scalar_t, 3, 3, Eigen::RowMajor>;
+        using Vector3 = Eigen::Matrix<scalar_t, 3, 1>;
+        const scalar_t* A_ptr = A.GetDataPtr<scalar_t>();
+        scalar_t* U_ptr = U.GetDataPtr<scalar_t>();
+        scalar_t* S_ptr = S.GetDataPtr<scalar_t>();
+        scalar_t* VT_ptr = VT.GetDataPtr<scalar_t>();
+        // kernel::svd3x3 runs a fixed number of Jacobi sweeps, which leaves
+        // relative errors of up to 1e-3, so the fixed-size Jacobi SVD of Eigen
+        // is used instead.
+        ParallelFor(A.GetDevice(), batch_size, [&](int64_t workload_idx) {
+            const Eigen::JacobiSVD<Matrix3> svd(
+                    Eigen::Map<const Matrix3>(A_ptr + workload_idx * 9),
+                    Eigen::ComputeFullU | Eigen::ComputeFullV);
+            Eigen::Map<Matrix3>(U_ptr + workload_idx * 9) = svd.matrixU();
+            Eigen::Map<Vector3>(S_ptr + workload_idx * 3) =
+                    svd.singularValues();
+            Eigen::Map<Matrix3>(VT_ptr + workload_idx * 9) =
+                    svd.matrixV().transpose();
+        });
+    });
+}
+
+}  // namespace core
+}  // namespace open3d
@@ -10,11 +10,16 @@
 #include <unordered_map>
 
 #include "open3d/core/CUDAUtils.h"
+#include "open3d/utility/Profiler.h"
 
 namespace open3d {
 namespace core {
 
-void Matmul(const Tensor& A, const Tensor& B, Tensor& output) {
+static void MatmulImpl(const Tensor& A,
+                       const Tensor& B,
+                       Tensor& output,
+                       bool reuse_output) {
+    OPEN3D_PROFILE_SCOPE("core::linalg::Matmul");
     AssertTensorDevice(B, A.GetDevice());
     AssertTensorDtype(B, A.GetDtype());
 
@@ -62,7 +67,12 @@ void Matmul(const Tensor& A, const Tensor& B, Tensor& output) {
     void* A_data = A_contiguous.GetDataPtr();
     void* B_data = B_contiguous.GetDataPtr();
 
-    output = Tensor::Empty({m, n}, dtype, device);
+    // Other dtypes are converted back at the end.
+    if (reuse_output && dtype == dtype_original) {
+        Tensor::PrepareOutput(output, {m, n}, dtype, device, {A, B});
+    } else {
+        output = Tensor::Empty({m, n}, dtype, device);
+    }
     void* C_data = output.GetDataPtr();
 
     if (device.IsCUDA()) {
@@ -76,8 +86,18 @@ void Matmul(const Tensor& A, const Tensor& B, Tensor& output) {
         MatmulCPU(B_data, A_data, C_data, n, k, m, dtype);
     }
 
-    output = output.To(dtype_original);
-};
+    if (dtype != dtype_original) {
+        output = output.To(dtype_original);
+    }
+}
+
+void Matmul(const Tensor& A, const Tensor& B, Tensor& output) {
+    MatmulImpl(A, B, output, /*reuse_output=*/false);
+}
+
+void MatmulInto(const Tensor& A, const Tensor& B, Tensor& output) {
+    MatmulImpl(A, B, output, /*reuse_output=*/true);
+}
 
 }  // namespace core
 }  // namespace open3d
@@ -15,6 +15,11 @@ namespace core {
 /// Computes matrix multiplication C = AB.
 void Matmul(const Tensor& A, const Tensor& B, Tensor& C);
 
+/// Computes matrix multiplication C = AB into the memory of C if it is
+/// contiguous with shape {m, n} and the dtype of A, and does not share memory
+/// with A or B. Otherwise, a new tensor is assigned to C like in Matmul.
+void MatmulInto(const Tensor& A, const Tensor& B, Tensor& C);
+
 #ifdef BUILD_CUDA_MODULE
 void MatmulCUDA(void* A_data,
                 void* B_data,
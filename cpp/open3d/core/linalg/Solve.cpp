@@ -15,11 +15,13 @@
 
 #include "open3d/core/CUDAUtils.h"
 #include "open3d/core/linalg/LinalgHeadersCPU.h"
+#include "open3d/utility/Profiler.h"
 
 namespace open3d {
 namespace core {
 
 void Solve(const Tensor &A, const Tensor &B, Tensor &X) {
+    OPEN3D_PROFILE_SCOPE("core::linalg::Solve");
     AssertTensorDtypes(A, {Float32, Float64});
     const Device device = A.GetDevice();
     const Dtype dtype = A.GetDtype();
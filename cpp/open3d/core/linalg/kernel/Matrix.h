@@ -222,6 +222,86 @@ OPEN3D_DEVICE OPEN3D_FORCE_INLINE void transpose4x4(const scalar_t* A_4x4,
     output_4x4[15] = A_4x4[15];
 }
 
+// ---- LU decomposition of small N x N matrices ----
+// The loops have compile-time trip counts, so that they are unrolled.
+
+/// In-place LU decomposition with partial pivoting of a row-major N x N
+/// matrix. Row i has been swapped with row ipiv_N[i]. Returns the determinant,
+/// which is 0 if a pivot is 0.
+template <typename scalar_t, int N>
+OPEN3D_HOST_DEVICE OPEN3D_FORCE_INLINE scalar_t lu_nxn_(scalar_t* A_NxN,
+                                                        int* ipiv_N) {
+    scalar_t det = 1;
+    for (int c = 0; c < N; ++c) {
+        int pivot = c;
+        scalar_t pivot_abs = A_NxN[c * N + c] < 0 ? -A_NxN[c * N + c]
+                                                  : A_NxN[c * N + c];
+        for (int r = c + 1; r < N; ++r) {
+            const scalar_t v = A_NxN[r * N + c] < 0 ? -A_NxN[r * N + c]
+                                                    : A_NxN[r * N + c];
+            if (v > pivot_abs) {
+                pivot = r;
+                pivot_abs = v;
+            }
+        }
+        ipiv_N[c] = pivot;
+        if (pivot != c) {
+            for (int j = 0; j < N; ++j) {
+                const scalar_t temp = A_NxN[c * N + j];
+                A_NxN[c * N + j] = A_NxN[pivot * N + j];
+                A_NxN[pivot * N + j] = temp;
+            }
+            det = -det;
+        }
+        const scalar_t diag = A_NxN[c * N + c];
+        det *= diag;
+        if (diag == 0) {
+            return 0;
+        }
+        const scalar_t inv_diag = 1 / diag;
+        for (int r = c + 1; r < N; ++r) {
+            const scalar_t factor = A_NxN[r * N + c] * inv_diag;
+            A_NxN[r * N + c] = factor;
+            for (int j = c + 1; j < N; ++j) {
+                A_NxN[r * N + j] -= factor * A_NxN[c * N + j];
+            }
+        }
+    }
+    return det;
+}
+
+/// Solves A X = B in place of the row-major N x k matrix B, with the LU
+/// decomposition of A computed by lu_nxn_.
+template <typename scalar_t, int N>
+OPEN3D_HOST_DEVICE OPEN3D_FORCE_INLINE void lu_solve_nxn_(
+        const scalar_t* LU_NxN, const int* ipiv_N, scalar_t* B_Nxk, int64_t k) {
+    for (int64_t j = 0; j < k; ++j) {
+        scalar_t x[N];
+        for (int i = 0; i < N; ++i) {
+            x[i] = B_Nxk[i * k + j];
+        }
+        for (int i = 0; i < N; ++i) {
+            const scalar_t temp = x[i];
+            x[i] = x[ipiv_N[i]];
+            x[ipiv_N[i]] = temp;
+        }
+        for (int i = 1; i < N; ++i) {
+            for (int c = 0; c < i; ++c) {
+                x[i] -= LU_NxN[i * N + c] * x[c];
+            }
+        }
+        for (int i = N - 1; i >= 0; --i) {
+            for (int c = i + 1; c < N; ++c) {
+                x[i] -= LU_NxN[i * N + c] * x[c];
+            }
+            x[i] /= LU_NxN[i * N + i];
+        }
+        for (int i = 0; i < N; ++i) {
+            B_Nxk[i * k + j] = x[i];
+        }
+    }
+}
+
 }  // namespace kernel
 }  // namespace linalg
 }  // namespace core
@@ -0,0 +1,416 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <tbb/parallel_for.h>
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+#include "open3d/core/nns/NanoFlannImpl.h"
+#include "open3d/core/nns/NeighborSearchCommon.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/ParallelScan.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+namespace impl {
+
+namespace {
+
+/// Result set for nanoflann::KDTreeSingleIndexAdaptor::findNeighbors() that
+/// keeps the knn closest points with a distance below max_distance, skipping
+/// removed points. The same result set is passed to the trees of all buckets,
+/// so that the trees searched later are pruned with the distances found in
+/// the earlier ones.
+template <class T, class TIndex>
+class DynamicKnnResultSet {
+public:
+    DynamicKnnResultSet(int knn,
+                        T max_distance,
+                        const int32_t *bucket_of,
+                        TIndex *indices,
+                        T *distances)
+        : knn_(knn),
+          bucket_of_(bucket_of),
+          indices_(indices),
+          distances_(distances) {
+        std::fill(distances_, distances_ + knn_, max_distance);
+    }
+
+    /// Sets the indices of the points in the tree that is searched next.
+    void SetBucketIndices(const int64_t *indices) { bucket_indices_ = indices; }
+
+    T worstDist() const { return distances_[knn_ - 1]; }
+
+    bool full() const { return count_ == knn_; }
+
+    bool addPoint(T distance, int64_t local_index) {
+        const int64_t index = bucket_indices_[local_index];
+        if (bucket_of_[index] < 0 || !(distance < distances_[knn_ - 1])) {
+            return true;
+        }
+        int k = std::min(count_, knn_ - 1);
+        for (; k > 0 && distances_[k - 1] > distance; --k) {
+            distances_[k] = distances_[k - 1];
+            indices_[k] = indices_[k - 1];
+        }
+        distances_[k] = distance;
+        indices_[k] = TIndex(index);
+        count_ = std::min(count_ + 1, knn_);
+        return true;
+    }
+
+    int size() const { return count_; }
+
+private:
+    int knn_;
+    int count_ = 0;
+    const int32_t *bucket_of_;
+    const int64_t *bucket_indices_ = nullptr;
+    TIndex *indices_;
+    T *distances_;
+};
+
+/// Result set that collects all points with a distance below radius,
+/// skipping removed points.
+template <class T>
+class DynamicRadiusResultSet {
+public:
+    DynamicRadiusResultSet(T radius,
+                           const int32_t *bucket_of,
+                           std::vector<std::pair<T, int64_t>> &result)
+        : radius_(radius), bucket_of_(bucket_of), result_(result) {
+        result_.clear();
+    }
+
+    /// Sets the indices of the points in the tree that is searched next.
+    void SetBucketIndices(const int64_t *indices) { bucket_indices_ = indices; }
+
+    T worstDist() const { return radius_; }
+
+    bool full() const { return true; }
+
+    bool addPoint(T distance, int64_t local_index) {
+        const int64_t index = bucket_indices_[local_index];
+        if (distance < radius_ && bucket_of_[index] >= 0) {
+            result_.emplace_back(distance, index);
+        }
+        return true;
+    }
+
+private:
+    T radius_;
+    const int32_t *bucket_of_;
+    const int64_t *bucket_indices_ = nullptr;
+    std::vector<std::pair<T, int64_t>> &result_;
+};
+
+}  // namespace
+
+/// KD-tree that supports adding and removing points, as a forest of static
+/// NanoFlann KD-trees (Bentley and Saxe's logarithmic method).
+///
+/// Added points form a new bucket with its own tree. Buckets are kept in
+/// decreasing order of size, each more than twice as large as the next one.
+/// A new bucket is merged with the smaller buckets before it until this
+/// holds again, so there are O(log n) buckets and every point is rebuilt
+/// O(log n) times. Removed points are only marked, and a bucket is rebuilt
+/// without them once more than half of its points are removed. A search
+/// visits all buckets with one result set.
+///
+/// The points are identified by the order in which they were added. The
+/// distances are squared L2 distances.
+template <class T>
+struct DynamicKDTreeHolder : public DynamicKDTreeHolderBase {
+    typedef NanoFlannIndexHolder<L2, T, int64_t> Tree;
+
+    struct Bucket {
+        /// Points of shape {indices.size(), dimension}.
+        std::vector<T> points;
+        /// The index of each point of the bucket.
+        std::vector<int64_t> indices;
+        std::unique_ptr<Tree> tree;
+        int64_t num_removed = 0;
+
+        int64_t NumActive() const {
+            return int64_t(indices.size()) - num_removed;
+        }
+    };
+
+    explicit DynamicKDTreeHolder(int dimension) : dimension_(dimension) {}
+
+    /// Adds num_points points with consecutive indices, starting at the
+    /// number of points added before.
+    void AddPoints(const T *const points, int64_t num_points) {
+        if (num_points == 0) {
+            return;
+        }
+        const int64_t first_index = int64_t(bucket_of_.size());
+        std::unique_ptr<Bucket> bucket(new Bucket());
+        bucket->points.assign(points, points + num_points * dimension_);
+        bucket->indices.resize(num_points);
+        std::iota(bucket->indices.begin(), bucket->indices.end(), first_index);
+        bucket_of_.resize(first_index + num_points, 0);
+        num_active_ += num_points;
+
+        // Merge the smaller buckets into the new one before building its
+        // tree, such that the tree is only built once.
+        while (!buckets_.empty() &&
+               buckets_.back()->NumActive() <= 2 * bucket->NumActive()) {
+            AppendActivePoints(*buckets_.back(), *bucket);
+            buckets_.pop_back();
+        }
+        BuildTree(*bucket);
+        buckets_.push_back(std::move(bucket));
+        UpdateBucketOf(buckets_.size() - 1);
+    }
+
+    /// Removes the points with the given indices. Indices of points that are
+    /// already removed are ignored.
+    void RemovePoints(const int64_t *const indices, int64_t num_indices) {
+        const int64_t num_points = int64_t(bucket_of_.size());
+        for (int64_t i = 0; i < num_indices; ++i) {
+            const int64_t index = indices[i];
+            if (index < 0 || index >= num_points) {
+                utility::LogError("Index {} is out of range [0, {}).", index,
+                                  num_points);
+            }
+            if (bucket_of_[index] >= 0) {
+                ++buckets_[bucket_of_[index]]->num_removed;
+                bucket_of_[index] = -1;
+                --num_active_;
+            }
+        }
+
+        // Rebuild the buckets with more removed than active points and merge
+        // the buckets that are no longer in decreasing order of size.
+        size_t first_changed = buckets_.size();
+        for (size_t b = 0; b < buckets_.size(); ++b) {
+            if (buckets_[b]->NumActive() < buckets_[b]->num_removed) {
+                std::unique_ptr<Bucket> bucket(new Bucket());
+                AppendActivePoints(*buckets_[b], *bucket);
+                buckets_[b] = std::move(bucket);
+                first_changed = std::min(first_changed, b);
+            }
+        }
+        buckets_.erase(std::remove_if(buckets_.begin(), buckets_.end(),
+                                      [](const std::unique_ptr<Bucket> &b) {
+                                          return b->NumActive() == 0;
+                                      }),
+                       buckets_.end());
+        for (size_t b = 1; b < buckets_.size();) {
+            if (buckets_[b - 1]->NumActive() <= 2 * buckets_[b]->NumActive()) {
+                if (buckets_[b - 1]->num_removed > 0) {
+                    std::unique_ptr<Bucket> bucket(new Bucket());
+                    AppendActivePoints(*buckets_[b - 1], *bucket);
+                    buckets_[b - 1] = std::move(bucket);
+                }
+                AppendActivePoints(*buckets_[b], *buckets_[b - 1]);
+                buckets_.erase(buckets_.begin() + b);
+                first_changed = std::min(first_changed, b - 1);
+                b = std::max(b - 1, size_t(1));
+            } else {
+                ++b;
+            }
+        }
+        for (size_t b = first_changed; b < buckets_.size(); ++b) {
+            if (!buckets_[b]->tree) {
+                BuildTree(*buckets_[b]);
+            }
+        }
+        UpdateBucketOf(std::min(first_changed, buckets_.size()));
+    }
+
+    /// Searches the knn nearest points with a squared distance below
+    /// max_distance. Returns the number of points found.
+    template <class TIndex>
+    int SearchKnn(const T *const query,
+                  int knn,
+                  T max_distance,
+                  TIndex *indices,
+                  T *distances) const {
+        DynamicKnnResultSet<T, TIndex> result(knn, max_distance,
+                                              bucket_of_.data(), indices,
+                                              distances);
+        for (const auto &bucket : buckets_) {
+            result.SetBucketIndices(bucket->indices.data());
+            bucket->tree->index_->findNeighbors(result, query,
+                                                nanoflann::SearchParameters());
+        }
+        return result.size();
+    }
+
+    /// Searches all points with a squared distance below radius.
+    void SearchRadius(const T *const query,
+                      T radius,
+                      std::vector<std::pair<T, int64_t>> &result) const {
+        DynamicRadiusResultSet<T> result_set(radius, bucket_of_.data(),
+                                             result);
+        for (const auto &bucket : buckets_) {
+            result_set.SetBucketIndices(bucket->indices.data());
+            bucket->tree->index_->findNeighbors(result_set, query,
+                                                nanoflann::SearchParameters());
+        }
+    }
+
+    /// Moves the active points of src to the end of dst and clears the tree
+    /// of dst.
+    void AppendActivePoints(const Bucket &src, Bucket &dst) const {
+        dst.tree.reset();
+        for (size_t i = 0; i < src.indices.size(); ++i) {
+            if (bucket_of_[src.indices[i]] >= 0) {
+                dst.indices.push_back(src.indices[i]);
+                dst.points.insert(dst.points.end(),
+                                  src.points.begin() + i * dimension_,
+                                  src.points.begin() + (i + 1) * dimension_);
+            }
+        }
+    }
+
+    void BuildTree(Bucket &bucket) const {
+        bucket.num_removed = 0;
+        bucket.tree.reset(new Tree(bucket.indices.size(), dimension_,
+                                   bucket.points.data(), /*leaf_max_size=*/10,
+                                   /*build_threads=*/0));
+    }
+
+    /// Points the active points of the buckets from first_bucket on to their
+    /// bucket.
+    void UpdateBucketOf(size_t first_bucket) {
+        for (size_t b = first_bucket; b < buckets_.size(); ++b) {
+            for (int64_t index : buckets_[b]->indices) {
+                if (bucket_of_[index] >= 0) {
+                    bucket_of_[index] = int32_t(b);
+                }
+            }
+        }
+    }
+
+    int dimension_;
+    /// The bucket of each point added so far, or -1 if it is removed.
+    std::vector<int32_t> bucket_of_;
+    std::vector<std::unique_ptr<Bucket>> buckets_;
+    int64_t num_active_ = 0;
+};
+
+/// Knn search in a DynamicKDTreeHolder. Neighbors that are not found, e.g.
+/// because they are farther than max_distance, are returned with index -1
+/// and distance 0.
+///
+/// \param holder    The holder of the trees.
+///
+/// \param num_queries    The number of query points.
+///
+/// \param queries    Array with the 2D query points of shape {num_queries,
+///        dimension}.
+///
+/// \param knn    The number of neighbors to search.
+///
+/// \param max_distance    Only neighbors with a squared distance below are
+///        returned.
+///
+/// \param indices    Output array of shape {num_queries, knn}.
+///
+/// \param distances    Output array of shape {num_queries, knn}.
+///
+/// \param counts    Optional output array of shape {num_queries} with the
+///        number of neighbors found.
+template <class T, class TIndex>
+void DynamicKDTreeSearchKnn(const DynamicKDTreeHolderBase *holder,
+                            size_t num_queries,
+                            const T *const queries,
+                            int knn,
+                            T max_distance,
+                            TIndex *indices,
+                            T *distances,
+                            TIndex *counts = nullptr) {
+    auto forest = static_cast<const DynamicKDTreeHolder<T> *>(holder);
+    const int dimension = forest->dimension_;
+    tbb::parallel_for(
+            tbb::blocked_range<size_t>(0, num_queries),
+            [&](const tbb::blocked_range<size_t> &r) {
+                for (size_t i = r.begin(); i < r.end(); ++i) {
+                    const int num_found = forest->SearchKnn(
+                            queries + i * dimension, knn, max_distance,
+                            indices + i * knn, distances + i * knn);
+                    std::fill(indices + i * knn + num_found,
+                              indices + (i + 1) * knn, TIndex(-1));
+                    std::fill(distances + i * knn + num_found,
+                              distances + (i + 1) * knn, T(0));
+                    if (counts) {
+                        counts[i] = TIndex(num_found);
+                    }
+                }
+            });
+}
+
+/// Radius search in a DynamicKDTreeHolder. The neighbors of all queries are
+/// stored linearly, with an exclusive prefix sum in query_neighbors_row_splits
+/// defining the start and end of each list, like in RadiusSearchCPU().
+///
+/// \param radii    The radius of each query point.
+///
+/// \param sort    If true, the neighbors of each query are sorted by
+///        distance.
+template <class T, class TIndex, class OUTPUT_ALLOCATOR>
+void DynamicKDTreeSearchRadius(const DynamicKDTreeHolderBase *holder,
+                               int64_t *query_neighbors_row_splits,
+                               size_t num_queries,
+                               const T *const queries,
+                               const T *const radii,
+                               bool sort,
+                               OUTPUT_ALLOCATOR &output_allocator) {
+    auto forest = static_cast<const DynamicKDTreeHolder<T> *>(holder);
+    const int dimension = forest->dimension_;
+    std::vector<std::vector<std::pair<T, int64_t>>> neighbors(num_queries);
+    std::vector<int64_t> neighbors_count(num_queries, 0);
+    tbb::parallel_for(
+            tbb::blocked_range<size_t>(0, num_queries),
+            [&](const tbb::blocked_range<size_t> &r) {
+                for (size_t i = r.begin(); i < r.end(); ++i) {
+                    forest->SearchRadius(queries + i * dimension,
+                                         radii[i] * radii[i], neighbors[i]);
+                    if (sort) {
+                        std::sort(neighbors[i].begin(), neighbors[i].end());
+                    }
+                    neighbors_count[i] = int64_t(neighbors[i].size());
+                }
+            });
+
+    query_neighbors_row_splits[0] = 0;
+    utility::InclusivePrefixSum(neighbors_count.data(),
+                                neighbors_count.data() + num_queries,
+                                query_neighbors_row_splits + 1);
+    const int64_t num_indices = query_neighbors_row_splits[num_queries];
+
+    TIndex *indices_ptr;
+    T *distances_ptr;
+    output_allocator.AllocIndices(&indices_ptr, num_indices);
+    output_allocator.AllocDistances(&distances_ptr, num_indices);
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, num_queries),
+                      [&](const tbb::blocked_range<size_t> &r) {
+                          for (size_t i = r.begin(); i < r.end(); ++i) {
+                              int64_t offset = query_neighbors_row_splits[i];
+                              for (const auto &neighbor : neighbors[i]) {
+                                  indices_ptr[offset] = TIndex(neighbor.second);
+                                  distances_ptr[offset] = neighbor.first;
+                                  ++offset;
+                              }
+                          }
+                      });
+}
+
+}  // namespace impl
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,265 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/nns/DynamicKDTreeIndex.h"
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/TensorCheck.h"
+#include "open3d/core/nns/DynamicKDTreeImpl.h"
+#include "open3d/core/nns/NeighborSearchAllocator.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+
+DynamicKDTreeIndex::DynamicKDTreeIndex() {}
+
+DynamicKDTreeIndex::DynamicKDTreeIndex(const Tensor &dataset_points,
+                                       const Dtype &index_dtype) {
+    SetTensorData(dataset_points, index_dtype);
+}
+
+DynamicKDTreeIndex::~DynamicKDTreeIndex() {}
+
+bool DynamicKDTreeIndex::SetTensorData(const Tensor &dataset_points,
+                                       const Dtype &index_dtype) {
+    AssertTensorDtypes(dataset_points, {Float32, Float64});
+    AssertTensorDevice(dataset_points, Device("CPU:0"));
+    assert(index_dtype == Int32 || index_dtype == Int64);
+
+    if (dataset_points.NumDims() != 2) {
+        utility::LogError(
+                "dataset_points must be 2D matrix, with shape "
+                "{n_dataset_points, d}.");
+    }
+    if (dataset_points.GetShape(1) <= 0) {
+        utility::LogError("Failed due to zero dimension.");
+    }
+
+    points_buffer_ = dataset_points.Contiguous().Clone();
+    dataset_points_ = points_buffer_;
+    index_dtype_ = index_dtype;
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(GetDtype(), [&]() {
+        auto holder = new impl::DynamicKDTreeHolder<scalar_t>(GetDimension());
+        holder_.reset(holder);
+        holder->AddPoints(points_buffer_.GetDataPtr<scalar_t>(),
+                          points_buffer_.GetShape(0));
+    });
+    return true;
+}
+
+Tensor DynamicKDTreeIndex::AddPoints(const Tensor &points) {
+    if (!holder_) {
+        utility::LogError("Index is not set.");
+    }
+    AssertTensorDevice(points, GetDevice());
+    AssertTensorDtype(points, GetDtype());
+    AssertTensorShape(points, {utility::nullopt, GetDimension()});
+
+    // The buffer grows geometrically, so that the points are copied O(1)
+    // times on average.
+    const int64_t num_points = points.GetShape(0);
+    const int64_t first_index = static_cast<int64_t>(GetDatasetSize());
+    const int64_t capacity = points_buffer_.GetShape(0);
+    if (first_index + num_points > capacity) {
+        Tensor buffer({std::max(first_index + num_points, 2 * capacity),
+                       GetDimension()},
+                      GetDtype(), GetDevice());
+        if (first_index > 0) {
+            buffer.Slice(0, 0, first_index).CopyFrom(dataset_points_);
+        }
+        points_buffer_ = buffer;
+    }
+    Tensor new_points =
+            points_buffer_.Slice(0, first_index, first_index + num_points);
+    new_points.CopyFrom(points);
+    dataset_points_ = points_buffer_.Slice(0, 0, first_index + num_points);
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(GetDtype(), [&]() {
+        static_cast<impl::DynamicKDTreeHolder<scalar_t> *>(holder_.get())
+                ->AddPoints(new_points.GetDataPtr<scalar_t>(), num_points);
+    });
+    return Tensor::Arange(first_index, first_index + num_points, 1,
+                          index_dtype_);
+}
+
+void DynamicKDTreeIndex::RemovePoints(const Tensor &indices) {
+    if (!holder_) {
+        utility::LogError("Index is not set.");
+    }
+    AssertTensorDevice(indices, GetDevice());
+    AssertTensorDtypes(indices, {Int32, Int64});
+    AssertTensorShape(indices, {utility::nullopt});
+
+    const Tensor indices_int64 = indices.To(Int64).Contiguous();
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(GetDtype(), [&]() {
+        static_cast<impl::DynamicKDTreeHolder<scalar_t> *>(holder_.get())
+                ->RemovePoints(indices_int64.GetDataPtr<int64_t>(),
+                               indices_int64.GetShape(0));
+    });
+}
+
+int64_t DynamicKDTreeIndex::GetNumActivePoints() const {
+    if (!holder_) {
+        return 0;
+    }
+    int64_t num_active = 0;
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(GetDtype(), [&]() {
+        num_active = static_cast<const impl::DynamicKDTreeHolder<scalar_t> *>(
+                             holder_.get())
+                             ->num_active_;
+    });
+    return num_active;
+}
+
+std::pair<Tensor, Tensor> DynamicKDTreeIndex::SearchKnn(
+        const Tensor &query_points, int knn) const {
+    const Dtype dtype = GetDtype();
+    const Device device = GetDevice();
+    const Dtype index_dtype = GetIndexDtype();
+
+    AssertTensorDevice(query_points, device);
+    AssertTensorDtype(query_points, dtype);
+    AssertTensorShape(query_points, {utility::nullopt, GetDimension()});
+
+    if (!holder_) {
+        utility::LogError("Index is not set.");
+    }
+    if (knn <= 0) {
+        utility::LogError("knn should be larger than 0.");
+    }
+
+    const int64_t num_neighbors =
+            std::min(GetNumActivePoints(), static_cast<int64_t>(knn));
+    const int64_t num_query_points = query_points.GetShape(0);
+
+    Tensor indices, distances;
+    DISPATCH_FLOAT_INT_DTYPE_TO_TEMPLATE(dtype, index_dtype, [&]() {
+        const Tensor query_contiguous = query_points.Contiguous();
+        NeighborSearchAllocator<scalar_t, int_t> output_allocator(device);
+        int_t *indices_ptr;
+        scalar_t *distances_ptr;
+        output_allocator.AllocIndices(&indices_ptr,
+                                      num_query_points * num_neighbors);
+        output_allocator.AllocDistances(&distances_ptr,
+                                        num_query_points * num_neighbors);
+
+        if (num_neighbors > 0) {
+            impl::DynamicKDTreeSearchKnn<scalar_t, int_t>(
+                    holder_.get(), num_query_points,
+                    query_contiguous.GetDataPtr<scalar_t>(), num_neighbors,
+                    std::numeric_limits<scalar_t>::max(), indices_ptr,
+                    distances_ptr);
+        }
+        indices = output_allocator.NeighborsIndex().View(
+                {num_query_points, num_neighbors});
+        distances = output_allocator.NeighborsDistance().View(
+                {num_query_points, num_neighbors});
+    });
+    return std::make_pair(indices, distances);
+}
+
+std::tuple<Tensor, Tensor, Tensor> DynamicKDTreeIndex::SearchRadius(
+        const Tensor &query_points, const Tensor &radii, bool sort) const {
+    const Dtype dtype = GetDtype();
+    const Device device = GetDevice();
+    const Dtype index_dtype = GetIndexDtype();
+
+    AssertTensorDevice(query_points, device);
+    AssertTensorDevice(radii, device);
+    AssertTensorDtype(query_points, dtype);
+    AssertTensorDtype(radii, dtype);
+
+    const int64_t num_query_points = query_points.GetShape(0);
+    AssertTensorShape(query_points, {utility::nullopt, GetDimension()});
+    AssertTensorShape(radii, {num_query_points});
+
+    if (!holder_) {
+        utility::LogError("Index is not set.");
+    }
+    if (radii.Le(0).Any().Item<bool>()) {
+        utility::LogError("radius should be larger than 0.");
+    }
+
+    Tensor indices, distances;
+    Tensor neighbors_row_splits = Tensor({num_query_points + 1}, Int64);
+    DISPATCH_FLOAT_INT_DTYPE_TO_TEMPLATE(dtype, index_dtype, [&]() {
+        const Tensor query_contiguous = query_points.Contiguous();
+        const Tensor radii_contiguous = radii.Contiguous();
+        NeighborSearchAllocator<scalar_t, int_t> output_allocator(device);
+
+        impl::DynamicKDTreeSearchRadius<scalar_t, int_t>(
+                holder_.get(), neighbors_row_splits.GetDataPtr<int64_t>(),
+                num_query_points, query_contiguous.GetDataPtr<scalar_t>(),
+                radii_contiguous.GetDataPtr<scalar_t>(), sort,
+                output_allocator);
+        indices = output_allocator.NeighborsIndex();
+        distances = output_allocator.NeighborsDistance();
+    });
+    return std::make_tuple(indices, distances,
+                           neighbors_row_splits.To(index_dtype));
+}
+
+std::tuple<Tensor, Tensor, Tensor> DynamicKDTreeIndex::SearchRadius(
+        const Tensor &query_points, double radius, bool sort) const {
+    const int64_t num_query_points = query_points.GetShape(0);
+    const Tensor radii = Tensor::Full({num_query_points}, radius, GetDtype(),
+                                      GetDevice());
+    return SearchRadius(query_points, radii, sort);
+}
+
+std::tuple<Tensor, Tensor, Tensor> DynamicKDTreeIndex::SearchHybrid(
+        const Tensor &query_points, double radius, int max_knn) const {
+    const Dtype dtype = GetDtype();
+    const Device device = GetDevice();
+    const Dtype index_dtype = GetIndexDtype();
+
+    AssertTensorDevice(query_points, device);
+    AssertTensorDtype(query_points, dtype);
+    AssertTensorShape(query_points, {utility::nullopt, GetDimension()});
+
+    if (!holder_) {
+        utility::LogError("Index is not set.");
+    }
+    if (max_knn <= 0) {
+        utility::LogError("max_knn should be larger than 0.");
+    }
+    if (radius <= 0) {
+        utility::LogError("radius should be larger than 0.");
+    }
+
+    const int64_t num_query_points = query_points.GetShape(0);
+
+    Tensor indices, distances, counts;
+    DISPATCH_FLOAT_INT_DTYPE_TO_TEMPLATE(dtype, index_dtype, [&]() {
+        const Tensor query_contiguous = query_points.Contiguous();
+        NeighborSearchAllocator<scalar_t, int_t> output_allocator(device);
+        int_t *indices_ptr, *counts_ptr;
+        scalar_t *distances_ptr;
+        output_allocator.AllocIndices(&indices_ptr, num_query_points * max_knn);
+        output_allocator.AllocDistances(&distances_ptr,
+                                        num_query_points * max_knn);
+        output_allocator.AllocCounts(&counts_ptr, num_query_points);
+
+        impl::DynamicKDTreeSearchKnn<scalar_t, int_t>(
+                holder_.get(), num_query_points,
+                query_contiguous.GetDataPtr<scalar_t>(), max_knn,
+                static_cast<scalar_t>(radius * radius), indices_ptr,
+                distances_ptr, counts_ptr);
+        indices = output_allocator.NeighborsIndex().View(
+                {num_query_points, max_knn});
+        distances = output_allocator.NeighborsDistance().View(
+                {num_query_points, max_knn});
+        counts = output_allocator.NeighborsCount();
+    });
+    return std::make_tuple(indices, distances, counts);
+}
+
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,146 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/nns/NNSIndex.h"
+#include "open3d/core/nns/NeighborSearchCommon.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+
+/// \class DynamicKDTreeIndex
+///
+/// \brief KDTree that supports adding and removing points, e.g. to keep the
+/// index of a growing map up to date without rebuilding it.
+///
+/// The points are kept in a forest of O(log n) static KDTrees, which are
+/// merged and rebuilt as points are added and removed, at an amortized cost
+/// of O(log^2 n) per point. The indices returned by the searches are the rows
+/// of all points added so far, in the order in which they were added. Removed
+/// points keep their rows but are no longer returned. Searches may run
+/// concurrently, but not while points are added or removed. Only supported
+/// on CPU.
+class DynamicKDTreeIndex : public NNSIndex {
+public:
+    /// \brief Default Constructor.
+    DynamicKDTreeIndex();
+
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param dataset_points Provides the initial set of data points, may have
+    /// zero rows.
+    /// \param index_dtype Dtype of the returned indices.
+    DynamicKDTreeIndex(const Tensor &dataset_points,
+                       const Dtype &index_dtype = core::Int64);
+    ~DynamicKDTreeIndex();
+    DynamicKDTreeIndex(const DynamicKDTreeIndex &) = delete;
+    DynamicKDTreeIndex &operator=(const DynamicKDTreeIndex &) = delete;
+
+public:
+    /// Replaces all points of the index. The points may have zero rows, to
+    /// add points later with AddPoints().
+    bool SetTensorData(const Tensor &dataset_points,
+                       const Dtype &index_dtype = core::Int64) override;
+
+    bool SetTensorData(const Tensor &dataset_points,
+                       double radius,
+                       const Dtype &index_dtype = core::Int64) override {
+        utility::LogError(
+                "DynamicKDTreeIndex::SetTensorData with radius not "
+                "implemented.");
+    }
+
+    /// Add points to the index.
+    ///
+    /// \param points Points of shape {n, d}, with the dtype and dimension of
+    /// the dataset points.
+    /// \return The indices of the added points, of shape {n}, with dtype
+    /// index_dtype.
+    Tensor AddPoints(const Tensor &points);
+
+    /// Remove points from the index. Points that are already removed are
+    /// ignored.
+    ///
+    /// \param indices Indices of the points to remove, of shape {n}, with
+    /// dtype Int32 or Int64.
+    void RemovePoints(const Tensor &indices);
+
+    /// Get the number of points that are not removed.
+    int64_t GetNumActivePoints() const;
+
+    /// Perform K nearest neighbor search.
+    ///
+    /// \param query_points Query points. Must be 2D, with shape {n, d}, same
+    /// dtype with dataset_points.
+    /// \param knn Number of nearest neighbor to search.
+    /// \return Pair of Tensors: (indices, distances):
+    /// - indices: Tensor of shape {n, knn}, with dtype same as index_dtype_.
+    /// knn is at most the number of active points.
+    /// - distances: Tensor of shape {n, knn}, same dtype with dataset_points.
+    std::pair<Tensor, Tensor> SearchKnn(const Tensor &query_points,
+                                        int knn) const override;
+
+    /// Perform radius search with multiple radii.
+    ///
+    /// \param query_points Query points. Must be 2D, with shape {n, d}, same
+    /// dtype with dataset_points.
+    /// \param radii list of radius. Must be 1D, with shape {n, }.
+    /// \return Tuple of Tensors: (indices, distances, splits):
+    /// - indices: Tensor of shape {total_num_neighbors,}, with dtype same as
+    /// index_dtype_.
+    /// - distances: Tensor of shape {total_num_neighbors,}, same dtype with
+    /// dataset_points.
+    /// - splits: Tensor of shape {n + 1,}, with dtype same as index_dtype_.
+    /// The neighbors of query i are in [splits[i], splits[i + 1]).
+    std::tuple<Tensor, Tensor, Tensor> SearchRadius(
+            const Tensor &query_points,
+            const Tensor &radii,
+            bool sort = true) const override;
+
+    /// Perform radius search.
+    ///
+    /// \param query_points Query points. Must be 2D, with shape {n, d}, same
+    /// dtype with dataset_points.
+    /// \param radius Radius.
+    /// \return Tuple of Tensors, (indices, distances, splits), see above.
+    std::tuple<Tensor, Tensor, Tensor> SearchRadius(
+            const Tensor &query_points,
+            double radius,
+            bool sort = true) const override;
+
+    /// Perform hybrid search.
+    ///
+    /// \param query_points Query points. Must be 2D, with shape {n, d}.
+    /// \param radius Radius.
+    /// \param max_knn Maximum number of neighbor to search per query point.
+    /// \return Tuple of Tensors, (indices, distances, counts):
+    /// - indices: Tensor of shape {n, max_knn}, with dtype same as
+    /// index_dtype_, padded with -1.
+    /// - distances: Tensor of shape {n, max_knn}, same dtype with
+    /// dataset_points, padded with 0.
+    /// - counts: Tensor of shape {n}, with dtype same as index_dtype_.
+    std::tuple<Tensor, Tensor, Tensor> SearchHybrid(const Tensor &query_points,
+                                                    double radius,
+                                                    int max_knn) const override;
+
+protected:
+    /// Rows [0, GetDatasetSize()) are the points added so far, the rest is
+    /// reserved for the next points. dataset_points_ is a view of the rows
+    /// in use.
+    Tensor points_buffer_;
+    std::unique_ptr<DynamicKDTreeHolderBase> holder_;
+};
+
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
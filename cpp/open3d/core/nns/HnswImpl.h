@@ -0,0 +1,473 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <random>
+#include <vector>
+
+#include "open3d/core/nns/NeighborSearchCommon.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+namespace impl {
+
+namespace {
+
+/// Marks the visited nodes of a graph search. Resetting only increments the
+/// current tag, so that the list can be reused for many searches.
+class HnswVisitedList {
+public:
+    explicit HnswVisitedList(size_t num_nodes) : tags_(num_nodes, 0) {}
+
+    void Reset() {
+        if (++tag_ == 0) {
+            std::fill(tags_.begin(), tags_.end(), 0);
+            tag_ = 1;
+        }
+    }
+
+    /// Marks the node as visited and returns true if it was not visited
+    /// before.
+    bool Visit(uint32_t node) {
+        if (tags_[node] == tag_) {
+            return false;
+        }
+        tags_[node] = tag_;
+        return true;
+    }
+
+private:
+    std::vector<uint32_t> tags_;
+    uint32_t tag_ = 0;
+};
+
+}  // namespace
+
+/// Hierarchical navigable small world graph for approximate nearest neighbor
+/// search (Malkov and Yashunin, 2018).
+///
+/// Each point is a node on the layers 0 to its level, with the levels drawn
+/// from an exponential distribution. A node has at most max_degree links to
+/// other nodes on each upper layer and 2 * max_degree links on layer 0. A
+/// search descends greedily from the entry point on the sparse upper layers
+/// and runs a best-first search with a candidate list of size ef on layer 0.
+///
+/// The graph is built by inserting the points in parallel, with a lock per
+/// node protecting its links. The distances are squared L2 distances.
+template <class T>
+struct HnswIndexHolder : public HnswIndexHolderBase {
+    typedef std::pair<T, uint32_t> Candidate;
+
+    HnswIndexHolder(size_t num_points,
+                    size_t dimension,
+                    const T *const points,
+                    int max_degree,
+                    int ef_construction)
+        : num_points_(num_points),
+          dimension_(dimension),
+          points_(points),
+          max_degree_(max_degree),
+          max_degree0_(2 * max_degree),
+          ef_construction_(std::max(ef_construction, max_degree)),
+          levels_(num_points),
+          links0_(num_points * (max_degree0_ + 1), 0),
+          upper_links_(num_points),
+          node_locks_(num_points) {
+        std::mt19937 rng(0);
+        std::uniform_real_distribution<double> uniform(0.0, 1.0);
+        const double level_scale = 1.0 / std::log(double(max_degree_));
+        for (size_t i = 0; i < num_points_; ++i) {
+            levels_[i] = int(-std::log(1.0 - uniform(rng)) * level_scale);
+            upper_links_[i].assign(levels_[i] * (max_degree_ + 1), 0);
+        }
+
+        entry_point_ = 0;
+        max_level_ = levels_[0];
+        tbb::enumerable_thread_specific<HnswVisitedList> visited{
+                HnswVisitedList(num_points_)};
+        tbb::parallel_for(tbb::blocked_range<size_t>(1, num_points_, 64),
+                          [&](const tbb::blocked_range<size_t> &r) {
+                              HnswVisitedList &visited_local = visited.local();
+                              for (size_t i = r.begin(); i < r.end(); ++i) {
+                                  Insert(uint32_t(i), visited_local);
+                              }
+                          });
+    }
+
+    const T *Point(uint32_t node) const {
+        return points_ + size_t(node) * dimension_;
+    }
+
+    T Distance(const T *a, const T *b) const {
+        // Independent partial sums, so that the loop is vectorized without
+        // reassociating floating point additions.
+        constexpr size_t kLanes = 8;
+        T sums[kLanes] = {0};
+        size_t d = 0;
+        for (; d + kLanes <= dimension_; d += kLanes) {
+            for (size_t k = 0; k < kLanes; ++k) {
+                const T diff = a[d + k] - b[d + k];
+                sums[k] += diff * diff;
+            }
+        }
+        for (; d < dimension_; ++d) {
+            const T diff = a[d] - b[d];
+            sums[0] += diff * diff;
+        }
+        T distance = 0;
+        for (size_t k = 0; k < kLanes; ++k) {
+            distance += sums[k];
+        }
+        return distance;
+    }
+
+    /// Returns the link list of a node on a layer. The first element is the
+    /// number of links.
+    uint32_t *Links(uint32_t node, int level) {
+        if (level == 0) {
+            return &links0_[size_t(node) * (max_degree0_ + 1)];
+        }
+        return &upper_links_[node][(level - 1) * (max_degree_ + 1)];
+    }
+
+    const uint32_t *Links(uint32_t node, int level) const {
+        return const_cast<HnswIndexHolder *>(this)->Links(node, level);
+    }
+
+    int MaxDegree(int level) const {
+        return level == 0 ? max_degree0_ : max_degree_;
+    }
+
+    /// Returns the links of a node on a layer and their number. While the
+    /// graph is built, the links are copied to the buffer with the node
+    /// locked.
+    const uint32_t *GetLinks(uint32_t node,
+                             int level,
+                             bool lock,
+                             std::vector<uint32_t> &buffer,
+                             uint32_t &num_links) const {
+        const uint32_t *links = Links(node, level);
+        if (!lock) {
+            num_links = links[0];
+            return links + 1;
+        }
+        std::lock_guard<std::mutex> node_lock(node_locks_[node]);
+        buffer.assign(links + 1, links + 1 + links[0]);
+        num_links = uint32_t(buffer.size());
+        return buffer.data();
+    }
+
+    /// Moves greedily to the closest neighbor on an upper layer until no
+    /// neighbor is closer to the query.
+    void SearchGreedy(const T *query,
+                      int level,
+                      bool lock,
+                      uint32_t &node,
+                      T &distance) const {
+        std::vector<uint32_t> buffer;
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            uint32_t num_links;
+            const uint32_t *links =
+                    GetLinks(node, level, lock, buffer, num_links);
+            for (uint32_t k = 0; k < num_links; ++k) {
+                const uint32_t neighbor = links[k];
+                const T neighbor_distance = Distance(query, Point(neighbor));
+                if (neighbor_distance < distance) {
+                    distance = neighbor_distance;
+                    node = neighbor;
+                    changed = true;
+                }
+            }
+        }
+    }
+
+    /// Best-first search on a layer. Returns the ef closest nodes found,
+    /// sorted by distance.
+    std::vector<Candidate> SearchLayer(const T *query,
+                                       uint32_t entry,
+                                       T entry_distance,
+                                       int ef,
+                                       int level,
+                                       bool lock,
+                                       HnswVisitedList &visited) const {
+        std::priority_queue<Candidate, std::vector<Candidate>,
+                            std::greater<Candidate>>
+                candidates;
+        std::priority_queue<Candidate> results;
+        visited.Reset();
+        visited.Visit(entry);
+        candidates.emplace(entry_distance, entry);
+        results.emplace(entry_distance, entry);
+
+        std::vector<uint32_t> buffer;
+        while (!candidates.empty()) {
+            const Candidate current = candidates.top();
+            if (current.first > results.top().first) {
+                break;
+            }
+            candidates.pop();
+            uint32_t num_links;
+            const uint32_t *links =
+                    GetLinks(current.second, level, lock, buffer, num_links);
+            for (uint32_t k = 0; k < num_links; ++k) {
+                const uint32_t neighbor = links[k];
+                if (!visited.Visit(neighbor)) {
+                    continue;
+                }
+                const T distance = Distance(query, Point(neighbor));
+                if (int64_t(results.size()) < ef ||
+                    distance < results.top().first) {
+                    candidates.emplace(distance, neighbor);
+                    results.emplace(distance, neighbor);
+                    if (int64_t(results.size()) > ef) {
+                        results.pop();
+                    }
+                }
+            }
+        }
+
+        std::vector<Candidate> sorted(results.size());
+        for (auto it = sorted.rbegin(); it != sorted.rend(); ++it) {
+            *it = results.top();
+            results.pop();
+        }
+        return sorted;
+    }
+
+    /// Selects up to max_links of the candidates sorted by distance, keeping
+    /// a candidate only if it is closer to the base node than to all selected
+    /// ones. This spreads the links in all directions.
+    std::vector<uint32_t> SelectNeighbors(
+            const std::vector<Candidate> &sorted_candidates,
+            int max_links) const {
+        std::vector<uint32_t> selected;
+        for (const Candidate &candidate : sorted_candidates) {
+            if (int(selected.size()) >= max_links) {
+                break;
+            }
+            const T *point = Point(candidate.second);
+            bool keep = true;
+            for (uint32_t other : selected) {
+                if (Distance(point, Point(other)) < candidate.first) {
+                    keep = false;
+                    break;
+                }
+            }
+            if (keep) {
+                selected.push_back(candidate.second);
+            }
+        }
+        return selected;
+    }
+
+    /// Adds a link from node to new_neighbor, shrinking the links of node with
+    /// SelectNeighbors() if they are full.
+    void AddLink(uint32_t node, uint32_t new_neighbor, int level) {
+        std::lock_guard<std::mutex> node_lock(node_locks_[node]);
+        uint32_t *links = Links(node, level);
+        const int max_links = MaxDegree(level);
+        if (int(links[0]) < max_links) {
+            links[++links[0]] = new_neighbor;
+            return;
+        }
+
+        const T *point = Point(node);
+        std::vector<Candidate> candidates;
+        candidates.reserve(max_links + 1);
+        candidates.emplace_back(Distance(point, Point(new_neighbor)),
+                                new_neighbor);
+        for (uint32_t k = 1; k <= links[0]; ++k) {
+            candidates.emplace_back(Distance(point, Point(links[k])),
+                                    links[k]);
+        }
+        std::sort(candidates.begin(), candidates.end());
+        const std::vector<uint32_t> selected =
+                SelectNeighbors(candidates, max_links);
+        links[0] = uint32_t(selected.size());
+        std::copy(selected.begin(), selected.end(), links + 1);
+    }
+
+    void Insert(uint32_t node, HnswVisitedList &visited) {
+        const int level = levels_[node];
+        const T *point = Point(node);
+
+        // A node above the current top layer becomes the new entry point,
+        // so the insertion keeps the global lock until it is linked.
+        std::unique_lock<std::mutex> entry_lock(entry_lock_);
+        const int max_level = max_level_;
+        uint32_t current = entry_point_;
+        if (level <= max_level) {
+            entry_lock.unlock();
+        }
+
+        T distance = Distance(point, Point(current));
+        for (int l = max_level; l > level; --l) {
+            SearchGreedy(point, l, true, current, distance);
+        }
+        for (int l = std::min(level, max_level); l >= 0; --l) {
+            const std::vector<Candidate> candidates =
+                    SearchLayer(point, current, distance, ef_construction_, l,
+                                true, visited);
+            const std::vector<uint32_t> selected =
+                    SelectNeighbors(candidates, max_degree_);
+            {
+                std::lock_guard<std::mutex> node_lock(node_locks_[node]);
+                uint32_t *links = Links(node, l);
+                links[0] = uint32_t(selected.size());
+                std::copy(selected.begin(), selected.end(), links + 1);
+            }
+            for (uint32_t neighbor : selected) {
+                AddLink(neighbor, node, l);
+            }
+            current = candidates[0].second;
+            distance = candidates[0].first;
+        }
+
+        if (level > max_level) {
+            entry_point_ = node;
+            max_level_ = level;
+        }
+    }
+
+    /// Searches the knn approximate nearest neighbors of a query, sorted by
+    /// distance. Returns the number of neighbors found, which is less than
+    /// knn only if the graph is disconnected.
+    int SearchKnn(const T *query,
+                  int knn,
+                  int ef,
+                  HnswVisitedList &visited,
+                  uint32_t *indices,
+                  T *distances) const {
+        uint32_t current = entry_point_;
+        T distance = Distance(query, Point(current));
+        for (int l = max_level_; l > 0; --l) {
+            SearchGreedy(query, l, false, current, distance);
+        }
+        const std::vector<Candidate> candidates = SearchLayer(
+                query, current, distance, std::max(ef, knn), 0, false, visited);
+        const int num_found = std::min(knn, int(candidates.size()));
+        for (int k = 0; k < num_found; ++k) {
+            indices[k] = candidates[k].second;
+            distances[k] = candidates[k].first;
+        }
+        return num_found;
+    }
+
+    size_t num_points_;
+    size_t dimension_;
+    const T *const points_;
+    int max_degree_;
+    int max_degree0_;
+    int ef_construction_;
+    std::vector<int> levels_;
+    /// Links on layer 0, max_degree0_ + 1 entries per node.
+    std::vector<uint32_t> links0_;
+    /// Links on layers 1 to the level of each node, max_degree_ + 1 entries
+    /// per node and layer.
+    std::vector<std::vector<uint32_t>> upper_links_;
+    uint32_t entry_point_;
+    int max_level_;
+    mutable std::vector<std::mutex> node_locks_;
+    std::mutex entry_lock_;
+};
+
+/// Builds a hierarchical navigable small world graph for the points.
+///
+/// \param num_points    The number of points.
+///
+/// \param points    Array with the 2D points of shape {num_points, dimension}.
+///        The array must outlive the graph.
+///
+/// \param dimension    The dimension of the points.
+///
+/// \param max_degree    The maximum number of links of a node on the upper
+///        layers. Nodes on layer 0 have up to 2 * max_degree links.
+///
+/// \param ef_construction    The size of the candidate list while building.
+template <class T>
+std::unique_ptr<HnswIndexHolderBase> BuildHnsw(size_t num_points,
+                                               const T *const points,
+                                               size_t dimension,
+                                               int max_degree,
+                                               int ef_construction) {
+    if (num_points > size_t(std::numeric_limits<uint32_t>::max())) {
+        utility::LogError("HnswIndex supports at most {} points, but got {}.",
+                          std::numeric_limits<uint32_t>::max(), num_points);
+    }
+    return std::unique_ptr<HnswIndexHolderBase>(new HnswIndexHolder<T>(
+            num_points, dimension, points, max_degree, ef_construction));
+}
+
+/// Approximate knn search with a graph built by BuildHnsw(). Neighbors that
+/// are not found are returned with index -1 and an infinite distance.
+///
+/// \param holder    The graph built by BuildHnsw().
+///
+/// \param num_queries    The number of query points.
+///
+/// \param queries    Array with the 2D query points of shape {num_queries,
+///        dimension}.
+///
+/// \param knn    The number of neighbors to search, at most the number of
+///        points.
+///
+/// \param ef    The size of the candidate list while searching.
+///
+/// \param indices    Output array of shape {num_queries, knn}.
+///
+/// \param distances    Output array of shape {num_queries, knn}.
+template <class T, class TIndex>
+void HnswSearchKnn(const HnswIndexHolderBase *holder,
+                   size_t num_queries,
+                   const T *const queries,
+                   int knn,
+                   int ef,
+                   TIndex *indices,
+                   T *distances) {
+    auto graph = static_cast<const HnswIndexHolder<T> *>(holder);
+    tbb::enumerable_thread_specific<HnswVisitedList> visited{
+            HnswVisitedList(graph->num_points_)};
+    tbb::parallel_for(
+            tbb::blocked_range<size_t>(0, num_queries, 16),
+            [&](const tbb::blocked_range<size_t> &r) {
+                HnswVisitedList &visited_local = visited.local();
+                std::vector<uint32_t> found(knn);
+                for (size_t i = r.begin(); i < r.end(); ++i) {
+                    const int num_found = graph->SearchKnn(
+                            queries + i * graph->dimension_, knn, ef,
+                            visited_local, found.data(), distances + i * knn);
+                    for (int k = 0; k < knn; ++k) {
+                        if (k < num_found) {
+                            indices[i * knn + k] = TIndex(found[k]);
+                        } else {
+                            indices[i * knn + k] = TIndex(-1);
+                            distances[i * knn + k] =
+                                    std::numeric_limits<T>::infinity();
+                        }
+                    }
+                }
+            });
+}
+
+}  // namespace impl
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
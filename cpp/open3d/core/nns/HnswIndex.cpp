@@ -0,0 +1,115 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/nns/HnswIndex.h"
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/TensorCheck.h"
+#include "open3d/core/nns/HnswImpl.h"
+#include "open3d/core/nns/NeighborSearchAllocator.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+
+HnswIndex::HnswIndex(int max_degree, int ef_construction, int ef_search)
+    : max_degree_(max_degree), ef_construction_(ef_construction) {
+    if (max_degree < 2) {
+        utility::LogError("max_degree must be at least 2, but got {}.",
+                          max_degree);
+    }
+    if (ef_construction <= 0) {
+        utility::LogError("ef_construction must be positive, but got {}.",
+                          ef_construction);
+    }
+    SetEfSearch(ef_search);
+}
+
+HnswIndex::~HnswIndex() {}
+
+void HnswIndex::SetEfSearch(int ef_search) {
+    if (ef_search <= 0) {
+        utility::LogError("ef_search must be positive, but got {}.",
+                          ef_search);
+    }
+    ef_search_ = ef_search;
+}
+
+bool HnswIndex::SetTensorData(const Tensor &dataset_points,
+                              const Dtype &index_dtype) {
+    AssertTensorDtypes(dataset_points, {Float32, Float64});
+    AssertTensorDevice(dataset_points, Device("CPU:0"));
+    assert(index_dtype == Int32 || index_dtype == Int64);
+
+    if (dataset_points.NumDims() != 2) {
+        utility::LogError(
+                "dataset_points must be 2D matrix, with shape "
+                "{n_dataset_points, d}.");
+    }
+    if (dataset_points.GetShape(0) <= 0 || dataset_points.GetShape(1) <= 0) {
+        utility::LogError("Failed due to no data.");
+    }
+
+    dataset_points_ = dataset_points.Contiguous();
+    index_dtype_ = index_dtype;
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(GetDtype(), [&]() {
+        holder_ = impl::BuildHnsw<scalar_t>(
+                dataset_points_.GetShape(0),
+                dataset_points_.GetDataPtr<scalar_t>(),
+                dataset_points_.GetShape(1), max_degree_, ef_construction_);
+    });
+    return true;
+}
+
+std::pair<Tensor, Tensor> HnswIndex::SearchKnn(const Tensor &query_points,
+                                               int knn) const {
+    const Dtype dtype = GetDtype();
+    const Device device = GetDevice();
+    const Dtype index_dtype = GetIndexDtype();
+
+    AssertTensorDevice(query_points, device);
+    AssertTensorDtype(query_points, dtype);
+    AssertTensorShape(query_points, {utility::nullopt, GetDimension()});
+
+    if (!holder_) {
+        utility::LogError("Index is not set.");
+    }
+    if (knn <= 0) {
+        utility::LogError("knn should be larger than 0.");
+    }
+
+    const int64_t num_neighbors = std::min(
+            static_cast<int64_t>(GetDatasetSize()), static_cast<int64_t>(knn));
+    const int64_t num_query_points = query_points.GetShape(0);
+
+    Tensor indices, distances;
+    DISPATCH_FLOAT_INT_DTYPE_TO_TEMPLATE(dtype, index_dtype, [&]() {
+        const Tensor query_contiguous = query_points.Contiguous();
+        NeighborSearchAllocator<scalar_t, int_t> output_allocator(device);
+        int_t *indices_ptr;
+        scalar_t *distances_ptr;
+        output_allocator.AllocIndices(&indices_ptr,
+                                      num_query_points * num_neighbors);
+        output_allocator.AllocDistances(&distances_ptr,
+                                        num_query_points * num_neighbors);
+
+        impl::HnswSearchKnn<scalar_t, int_t>(
+                holder_.get(), num_query_points,
+                query_contiguous.GetDataPtr<scalar_t>(), num_neighbors,
+                ef_search_, indices_ptr, distances_ptr);
+        indices = output_allocator.NeighborsIndex().View(
+                {num_query_points, num_neighbors});
+        distances = output_allocator.NeighborsDistance().View(
+                {num_query_points, num_neighbors});
+    });
+    return std::make_pair(indices, distances);
+}
+
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
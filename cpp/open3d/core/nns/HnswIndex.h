@@ -0,0 +1,109 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/nns/NNSIndex.h"
+#include "open3d/core/nns/NeighborSearchCommon.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+
+/// \class HnswIndex
+///
+/// \brief Hierarchical navigable small world graph for approximate nearest
+/// neighbor search.
+///
+/// The search returns most, but not necessarily all, of the exact nearest
+/// neighbors. It is much faster than an exact search for high-dimensional
+/// points such as 33-D FPFH features, where a KDTree degenerates to a linear
+/// scan. ef_search trades recall for speed. Only supported on CPU.
+class HnswIndex : public NNSIndex {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param max_degree The maximum number of links of a point on the upper
+    /// layers of the graph, and half the maximum number on the base layer.
+    /// Larger values improve the recall in high dimensions, at the cost of
+    /// memory and build time. Must be at least 2.
+    /// \param ef_construction The size of the candidate list while building
+    /// the graph. Larger values build a better graph, at the cost of build
+    /// time.
+    /// \param ef_search The size of the candidate list while searching, see
+    /// SetEfSearch().
+    HnswIndex(int max_degree = 16,
+              int ef_construction = 64,
+              int ef_search = 64);
+    ~HnswIndex();
+    HnswIndex(const HnswIndex &) = delete;
+    HnswIndex &operator=(const HnswIndex &) = delete;
+
+public:
+    bool SetTensorData(const Tensor &dataset_points,
+                       const Dtype &index_dtype = core::Int64) override;
+
+    bool SetTensorData(const Tensor &dataset_points,
+                       double radius,
+                       const Dtype &index_dtype = core::Int64) override {
+        utility::LogError(
+                "HnswIndex::SetTensorData with radius not implemented.");
+    }
+
+    /// Perform approximate K nearest neighbor search.
+    ///
+    /// \param query_points Query points. Must be 2D, with shape {n, d}, same
+    /// dtype with dataset_points.
+    /// \param knn Number of nearest neighbor to search.
+    /// \return Pair of Tensors: (indices, distances):
+    /// - indices: Tensor of shape {n, knn}, with dtype same as index_dtype_.
+    /// - distainces: Tensor of shape {n, knn}, same dtype with dataset_points.
+    /// The distances are squared L2 distances.
+    std::pair<Tensor, Tensor> SearchKnn(const Tensor &query_points,
+                                        int knn) const override;
+
+    std::tuple<Tensor, Tensor, Tensor> SearchRadius(const Tensor &query_points,
+                                                    const Tensor &radii,
+                                                    bool sort) const override {
+        utility::LogError("HnswIndex::SearchRadius not implemented.");
+    }
+
+    std::tuple<Tensor, Tensor, Tensor> SearchRadius(const Tensor &query_points,
+                                                    const double radius,
+                                                    bool sort) const override {
+        utility::LogError("HnswIndex::SearchRadius not implemented.");
+    }
+
+    std::tuple<Tensor, Tensor, Tensor> SearchHybrid(
+            const Tensor &query_points,
+            const double radius,
+            const int max_knn) const override {
+        utility::LogError("HnswIndex::SearchHybrid not implemented.");
+    }
+
+    /// Set the size of the candidate list while searching, the recall/speed
+    /// knob of the index. It is raised to knn if smaller. Larger values find
+    /// more of the exact neighbors at a lower speed.
+    void SetEfSearch(int ef_search);
+
+    /// Get the size of the candidate list while searching.
+    int GetEfSearch() const { return ef_search_; }
+
+protected:
+    int max_degree_;
+    int ef_construction_;
+    int ef_search_;
+    std::unique_ptr<HnswIndexHolderBase> holder_;
+};
+
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
@@ -69,11 +69,24 @@ bool KnnIndex::SetTensorData(const Tensor& dataset_points,
                 "Please recompile Open3d With -DBUILD_CUDA_MODULE=ON.");
 #endif
     } else {
-        utility::LogError(
-                "CPU Tensor is not supported in KnnIndex. Please use "
-                "NanoFlannIndex instead.");
+        dataset_points_ = dataset_points.Contiguous();
+        points_row_splits_ = points_row_splits.Contiguous();
+        index_dtype_ = index_dtype;
+
+        const int64_t dim = dataset_points_.GetShape(1);
+        const int64_t* row_splits_ptr =
+                points_row_splits_.GetDataPtr<int64_t>();
+        dataset_points_t_ = Tensor::Empty({dataset_points_.NumElements()},
+                                          dataset_points_.GetDtype());
+        for (int64_t i = 0; i + 1 < points_row_splits_.GetLength(); ++i) {
+            const int64_t begin = row_splits_ptr[i];
+            const int64_t end = row_splits_ptr[i + 1];
+            dataset_points_t_.Slice(0, begin * dim, end * dim)
+                    .View({dim, end - begin})
+                    .AsRvalue() = dataset_points_.Slice(0, begin, end).T();
+        }
+        return true;
     }
-    return false;
 }
 
 std::pair<Tensor, Tensor> KnnIndex::SearchKnn(const Tensor& query_points,
@@ -101,6 +114,13 @@ std::pair<Tensor, Tensor> KnnIndex::SearchKnn(const Tensor& query_points,
                 "query_points and queries_row_splits have incompatible "
                 "shapes.");
     }
+    if (queries_row_splits.GetLength() != points_row_splits_.GetLength()) {
+        utility::LogError(
+                "queries_row_splits and points_row_splits have different "
+                "batch sizes, {} vs {}.",
+                queries_row_splits.GetLength() - 1,
+                points_row_splits_.GetLength() - 1);
+    }
     if (knn <= 0) {
         utility::LogError("knn should be larger than 0.");
     }
@@ -128,9 +148,13 @@ std::pair<Tensor, Tensor> KnnIndex::SearchKnn(const Tensor& query_points,
                 "-DBUILD_CUDA_MODULE=ON.");
 #endif
     } else {
-        utility::LogError(
-                "-DBUILD_CUDA_MODULE=OFF. Please compile Open3d with "
-                "-DBUILD_CUDA_MODULE=ON.");
+        const Dtype index_dtype = GetIndexDtype();
+        DISPATCH_FLOAT_INT_DTYPE_TO_TEMPLATE(dtype, index_dtype, [&]() {
+            KnnSearchCPU<scalar_t, int_t>(
+                    dataset_points_t_, points_row_splits_, query_points_,
+                    queries_row_splits_, knn, neighbors_index,
+                    neighbors_row_splits, neighbors_distance);
+        });
     }
     return std::make_pair(neighbors_index, neighbors_distance);
 }
@@ -17,6 +17,22 @@ namespace open3d {
 namespace core {
 namespace nns {
 
+/// Brute force knn search on CPU. The distances are computed in tiles that
+/// fit into the cache and the neighbors are selected with a heap per query.
+/// This is faster than a KD-tree for high-dimensional points, e.g. 33-D FPFH
+/// features, and for small datasets. The arguments are the same as for
+/// KnnSearchCUDA, except that \p points_t holds the points of each batch item
+/// transposed to shape {dim, n}, see KnnIndex::SetTensorData.
+template <class T, class TIndex>
+void KnnSearchCPU(const Tensor& points_t,
+                  const Tensor& points_row_splits,
+                  const Tensor& queries,
+                  const Tensor& queries_row_splits,
+                  int knn,
+                  Tensor& neighbors_index,
+                  Tensor& neighbors_row_splits,
+                  Tensor& neighbors_distance);
+
 #ifdef BUILD_CUDA_MODULE
 template <class T, class TIndex>
 void KnnSearchCUDA(const Tensor& points,
@@ -84,6 +100,11 @@ public:
 
 protected:
     Tensor points_row_splits_;
+
+    /// Points of each batch item transposed to shape {dim, n} and flattened,
+    /// for the brute force search on CPU. Built once in SetTensorData, so that
+    /// each search does not copy the dataset.
+    Tensor dataset_points_t_;
 };
 
 }  // namespace nns
@@ -0,0 +1,223 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <tbb/parallel_for.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "open3d/utility/Helper.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+namespace impl {
+
+namespace {
+
+/// Number of queries processed together against each tile of points.
+constexpr int64_t kKnnQueryBlock = 16;
+
+/// Number of distances checked at once for candidates by the selection.
+constexpr int64_t kKnnSelectChunk = 64;
+
+/// Returns the number of points per tile, such that a tile of transposed
+/// points fits into the L1 cache.
+template <class T>
+int64_t KnnPointTileSize(int64_t dim) {
+    const int64_t size = 16384 / (dim * int64_t(sizeof(T)));
+    return std::max<int64_t>(64, std::min<int64_t>(1024, size / 16 * 16));
+}
+
+/// Computes the squared L2 distances of a query to a tile of points stored
+/// dimension-major, i.e. the d-th coordinate of the j-th point of the tile is
+/// at points_t[d * stride + j]. The inner loop runs over contiguous points and
+/// is vectorized.
+template <class T>
+void TileDistances(const T* query,
+                   const T* points_t,
+                   int64_t stride,
+                   int64_t dim,
+                   int64_t tile_size,
+                   T* distances) {
+    std::fill(distances, distances + tile_size, T(0));
+    for (int64_t d = 0; d < dim; ++d) {
+        const T q = query[d];
+        const T* p = points_t + d * stride;
+        for (int64_t j = 0; j < tile_size; ++j) {
+            const T diff = q - p[j];
+            distances[j] += diff * diff;
+        }
+    }
+}
+
+/// Returns the number of distances smaller than the threshold. This is a
+/// vectorized pre-pass that lets the selection skip chunks of distances
+/// without candidates.
+template <class T>
+int64_t CountBelow(const T* distances, int64_t tile_size, T threshold) {
+    int64_t count = 0;
+    for (int64_t j = 0; j < tile_size; ++j) {
+        count += distances[j] < threshold;
+    }
+    return count;
+}
+
+/// Up to this knn, the candidates are kept in a sorted array instead of a
+/// max-heap, which is faster for the few neighbors of typical queries.
+constexpr int kKnnInsertionMax = 32;
+
+/// Adds the points of a tile with a distance below the current k-th best
+/// distance to the candidates of a query. For knn <= kKnnInsertionMax the
+/// candidates are sorted by distance, otherwise they form a max-heap. Points
+/// are visited in index order, so a candidate with the same distance as the
+/// worst neighbor has a larger index and is rejected.
+template <class T, class TIndex>
+void SelectCandidates(const T* tile_distances,
+                      int64_t tile_size,
+                      TIndex tile_offset,
+                      int knn,
+                      std::pair<T, TIndex>* candidates,
+                      int64_t& num_candidates) {
+    typedef std::pair<T, TIndex> Candidate;
+    const bool use_heap = knn > kKnnInsertionMax;
+    auto insert = [&](T distance, TIndex index) {
+        if (use_heap) {
+            if (num_candidates == knn) {
+                std::pop_heap(candidates, candidates + knn);
+                --num_candidates;
+            }
+            candidates[num_candidates++] = Candidate(distance, index);
+            std::push_heap(candidates, candidates + num_candidates);
+        } else {
+            int64_t pos = std::min<int64_t>(num_candidates, knn - 1);
+            while (pos > 0 && candidates[pos - 1].first > distance) {
+                candidates[pos] = candidates[pos - 1];
+                --pos;
+            }
+            candidates[pos] = Candidate(distance, index);
+            num_candidates = std::min<int64_t>(num_candidates + 1, knn);
+        }
+    };
+    auto worst = [&]() {
+        return use_heap ? candidates[0].first : candidates[knn - 1].first;
+    };
+
+    int64_t j = 0;
+    for (; j < tile_size && num_candidates < knn; ++j) {
+        insert(tile_distances[j], tile_offset + TIndex(j));
+    }
+    for (; j < tile_size; j += kKnnSelectChunk) {
+        const int64_t chunk_end = std::min(tile_size, j + kKnnSelectChunk);
+        T threshold = worst();
+        if (CountBelow(tile_distances + j, chunk_end - j, threshold) == 0) {
+            continue;
+        }
+        for (int64_t c = j; c < chunk_end; ++c) {
+            if (tile_distances[c] < threshold) {
+                insert(tile_distances[c], tile_offset + TIndex(c));
+                threshold = worst();
+            }
+        }
+    }
+}
+
+}  // namespace
+
+/// Brute force knn search on CPU.
+///
+/// The points are given in a dimension-major layout and processed in tiles
+/// that fit into the L1 cache. Each task computes the distances of a
+/// block of queries to one tile at a time, so that the tile is reused by all
+/// queries of the block, and keeps the knn best candidates per query. Chunks
+/// of distances without a distance below the current k-th best distance of a
+/// query are skipped after a vectorized count.
+///
+/// The neighbors are sorted by distance, ties by index. The distances are
+/// squared L2 distances.
+///
+/// \param num_points    The number of points.
+///
+/// \param points_t    Array with the transposed points of shape {dim,
+///        num_points}.
+///
+/// \param num_queries    The number of query points.
+///
+/// \param queries    Array with the 2D query points of shape {num_queries,
+///        dim}.
+///
+/// \param dim    The dimension of the points.
+///
+/// \param knn    The number of neighbors to search, at most num_points.
+///
+/// \param indices    Output array of shape {num_queries, knn} with the
+///        indices of the neighbors.
+///
+/// \param distances    Output array of shape {num_queries, knn} with the
+///        distances of the neighbors.
+template <class T, class TIndex>
+void KnnSearchBruteForceCPU(int64_t num_points,
+                            const T* const points_t,
+                            int64_t num_queries,
+                            const T* const queries,
+                            int64_t dim,
+                            int knn,
+                            TIndex* indices,
+                            T* distances) {
+    if (num_points == 0 || num_queries == 0 || knn <= 0) {
+        return;
+    }
+
+    const int64_t tile_size = KnnPointTileSize<T>(dim);
+    const int64_t num_blocks = utility::DivUp(num_queries, kKnnQueryBlock);
+    tbb::parallel_for(
+            tbb::blocked_range<int64_t>(0, num_blocks),
+            [&](const tbb::blocked_range<int64_t>& r) {
+                typedef std::pair<T, TIndex> Candidate;
+                std::vector<T> tile_distances(tile_size);
+                std::vector<Candidate> candidates(kKnnQueryBlock * knn);
+                for (int64_t block = r.begin(); block < r.end(); ++block) {
+                    const int64_t q_begin = block * kKnnQueryBlock;
+                    const int64_t q_end = std::min(num_queries,
+                                                   q_begin + kKnnQueryBlock);
+                    std::vector<int64_t> num_candidates(q_end - q_begin, 0);
+
+                    for (int64_t j0 = 0; j0 < num_points; j0 += tile_size) {
+                        const int64_t size =
+                                std::min(tile_size, num_points - j0);
+                        for (int64_t q = q_begin; q < q_end; ++q) {
+                            Candidate* cand = &candidates[(q - q_begin) * knn];
+                            int64_t& count = num_candidates[q - q_begin];
+                            TileDistances(queries + q * dim, points_t + j0,
+                                          num_points, dim, size,
+                                          tile_distances.data());
+                            SelectCandidates(tile_distances.data(), size,
+                                             TIndex(j0), knn, cand, count);
+                        }
+                    }
+
+                    for (int64_t q = q_begin; q < q_end; ++q) {
+                        Candidate* cand = &candidates[(q - q_begin) * knn];
+                        if (knn > kKnnInsertionMax) {
+                            std::sort_heap(cand, cand + knn);
+                        }
+                        for (int k = 0; k < knn; ++k) {
+                            indices[q * knn + k] = cand[k].second;
+                            distances[q * knn + k] = cand[k].first;
+                        }
+                    }
+                }
+            });
+}
+
+}  // namespace impl
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
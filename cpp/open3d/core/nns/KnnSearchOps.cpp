@@ -0,0 +1,94 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/nns/KnnIndex.h"
+#include "open3d/core/nns/KnnSearchImpl.h"
+#include "open3d/core/nns/NeighborSearchAllocator.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+
+template <class T, class TIndex>
+void KnnSearchCPU(const Tensor& points_t,
+                  const Tensor& points_row_splits,
+                  const Tensor& queries,
+                  const Tensor& queries_row_splits,
+                  int knn,
+                  Tensor& neighbors_index,
+                  Tensor& neighbors_row_splits,
+                  Tensor& neighbors_distance) {
+    const int64_t num_queries = queries.GetShape(0);
+    const int64_t dim = queries.GetShape(1);
+    const int64_t batch_size = points_row_splits.GetShape(0) - 1;
+    const int64_t* points_row_splits_ptr =
+            points_row_splits.GetDataPtr<int64_t>();
+    const int64_t* queries_row_splits_ptr =
+            queries_row_splits.GetDataPtr<int64_t>();
+
+    // Neighbors of the queries of each batch item, at most knn per query.
+    int64_t* neighbors_row_splits_ptr =
+            neighbors_row_splits.GetDataPtr<int64_t>();
+    std::vector<int> batch_knn(batch_size);
+    neighbors_row_splits_ptr[0] = 0;
+    for (int64_t i = 0; i < batch_size; ++i) {
+        const int64_t num_points_i =
+                points_row_splits_ptr[i + 1] - points_row_splits_ptr[i];
+        batch_knn[i] = static_cast<int>(std::min<int64_t>(knn, num_points_i));
+        for (int64_t q = queries_row_splits_ptr[i];
+             q < queries_row_splits_ptr[i + 1]; ++q) {
+            neighbors_row_splits_ptr[q + 1] =
+                    neighbors_row_splits_ptr[q] + batch_knn[i];
+        }
+    }
+
+    NeighborSearchAllocator<T, TIndex> output_allocator(points_t.GetDevice());
+    TIndex* indices_ptr;
+    T* distances_ptr;
+    const int64_t num_neighbors = neighbors_row_splits_ptr[num_queries];
+    output_allocator.AllocIndices(&indices_ptr, num_neighbors);
+    output_allocator.AllocDistances(&distances_ptr, num_neighbors);
+
+    // The neighbor indices are relative to the batch item, as in
+    // KnnSearchCUDA.
+    for (int64_t i = 0; i < batch_size; ++i) {
+        const int64_t query_begin = queries_row_splits_ptr[i];
+        const int64_t offset = neighbors_row_splits_ptr[query_begin];
+        impl::KnnSearchBruteForceCPU<T, TIndex>(
+                points_row_splits_ptr[i + 1] - points_row_splits_ptr[i],
+                points_t.GetDataPtr<T>() + points_row_splits_ptr[i] * dim,
+                queries_row_splits_ptr[i + 1] - query_begin,
+                queries.GetDataPtr<T>() + query_begin * dim, dim, batch_knn[i],
+                indices_ptr + offset, distances_ptr + offset);
+    }
+
+    neighbors_index = output_allocator.NeighborsIndex();
+    neighbors_distance = output_allocator.NeighborsDistance();
+    if (batch_size == 1) {
+        neighbors_index = neighbors_index.View({num_queries, batch_knn[0]});
+        neighbors_distance =
+                neighbors_distance.View({num_queries, batch_knn[0]});
+    }
+}
+
+#define INSTANTIATE(T, TIndex)                                                \
+    template void KnnSearchCPU<T, TIndex>(                                    \
+            const Tensor& points_t, const Tensor& points_row_splits,          \
+            const Tensor& queries, const Tensor& queries_row_splits, int knn, \
+            Tensor& neighbors_index, Tensor& neighbors_row_splits,            \
+            Tensor& neighbors_distance);
+
+INSTANTIATE(float, int32_t)
+INSTANTIATE(float, int64_t)
+INSTANTIATE(double, int32_t)
+INSTANTIATE(double, int64_t)
+
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
@@ -7,14 +7,22 @@
 #pragma once
 
 #include <tbb/parallel_for.h>
+#include <tbb/parallel_sort.h>
 
 #include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iostream>
 #include <mutex>
 #include <nanoflann.hpp>
+#include <numeric>
+#include <string>
 
 #include "open3d/core/Atomic.h"
 #include "open3d/core/nns/NeighborSearchCommon.h"
 #include "open3d/utility/Helper.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
 #include "open3d/utility/ParallelScan.h"
 
 namespace open3d {
@@ -71,27 +79,339 @@ struct NanoFlannIndexHolder : NanoFlannIndexHolderBase {
             TIndex>
             KDTree_t;
 
+    /// Builds the KD-tree, or reads it from saved_tree if not null. See
+    /// WriteKdTree().
+    ///
+    /// \param build_threads The number of subtrees built concurrently. 1
+    /// builds the tree serially, values <= 0 use all threads.
     NanoFlannIndexHolder(size_t dataset_size,
                          int dimension,
-                         const TReal *data_ptr) {
+                         const TReal *data_ptr,
+                         size_t leaf_max_size = 10,
+                         int build_threads = 1,
+                         std::istream *saved_tree = nullptr) {
         adaptor_.reset(new DataAdaptor(dataset_size, dimension, data_ptr));
-        index_.reset(new KDTree_t(dimension, *adaptor_.get()));
-        index_->buildIndex();
+        // The constructor would build the tree, which is either built once
+        // below or not at all.
+        index_.reset(new KDTree_t(
+                dimension, *adaptor_.get(),
+                nanoflann::KDTreeSingleIndexAdaptorParams(
+                        leaf_max_size,
+                        nanoflann::KDTreeSingleIndexAdaptorFlags::
+                                SkipInitialBuildIndex)));
+        if (build_threads <= 0) {
+            build_threads = utility::EstimateMaxThreads();
+        }
+        if (saved_tree) {
+            index_->loadIndex(*saved_tree);
+        } else if (build_threads > 1 && dataset_size > kParallelBuildMinSize) {
+            BuildIndexParallel(build_threads);
+        } else {
+            index_->buildIndex();
+        }
     }
 
     std::unique_ptr<KDTree_t> index_;
     std::unique_ptr<DataAdaptor> adaptor_;
+
+private:
+    typedef typename KDTree_t::Node Node;
+    typedef typename KDTree_t::BoundingBox BoundingBox;
+
+    /// Subtrees with fewer points are not split into parallel tasks.
+    static constexpr size_t kParallelBuildMinSize = 1 << 14;
+
+    /// Hands out the nodes of one task from blocks allocated in the pool of
+    /// the tree, which is not thread-safe.
+    struct NodeAllocator {
+        static constexpr size_t kBlockSize = 256;
+
+        NodeAllocator(KDTree_t &index, std::mutex &pool_mutex)
+            : index_(index), pool_mutex_(pool_mutex) {}
+
+        Node *Allocate() {
+            if (num_free_ == 0) {
+                std::lock_guard<std::mutex> lock(pool_mutex_);
+                next_ = index_.pool_.template allocate<Node>(kBlockSize);
+                num_free_ = kBlockSize;
+            }
+            --num_free_;
+            return next_++;
+        }
+
+        KDTree_t &index_;
+        std::mutex &pool_mutex_;
+        Node *next_ = nullptr;
+        size_t num_free_ = 0;
+    };
+
+    /// Builds the same tree as KDTree_t::buildIndex(). The two subtrees of a
+    /// node cover disjoint ranges of the permutation index_->vAcc_ and are
+    /// built in parallel tasks down to a depth of log2(num_threads).
+    void BuildIndexParallel(int num_threads) {
+        KDTree_t &index = *index_;
+        const size_t num_points = adaptor_->dataset_size_;
+        const int dimension = adaptor_->dimension_;
+        index.freeIndex(index);
+        index.size_ = num_points;
+        index.size_at_index_build_ = num_points;
+        index.vAcc_.resize(num_points);
+        std::iota(index.vAcc_.begin(), index.vAcc_.end(), TIndex(0));
+
+        index.root_bbox_.resize(dimension);
+        for (int d = 0; d < dimension; ++d) {
+            index.root_bbox_[d].low = index.root_bbox_[d].high =
+                    adaptor_->kdtree_get_pt(0, d);
+        }
+        for (size_t i = 1; i < num_points; ++i) {
+            for (int d = 0; d < dimension; ++d) {
+                const TReal value = adaptor_->kdtree_get_pt(i, d);
+                index.root_bbox_[d].low =
+                        std::min(index.root_bbox_[d].low, value);
+                index.root_bbox_[d].high =
+                        std::max(index.root_bbox_[d].high, value);
+            }
+        }
+
+        int parallel_depth = 0;
+        while ((1 << parallel_depth) < num_threads) {
+            ++parallel_depth;
+        }
+        std::mutex pool_mutex;
+        NodeAllocator allocator(index, pool_mutex);
+        index.root_node_ = DivideTree(0, num_points, index.root_bbox_,
+                                      parallel_depth, allocator);
+    }
+
+    Node *DivideTree(size_t left,
+                     size_t right,
+                     BoundingBox &bbox,
+                     int parallel_depth,
+                     NodeAllocator &allocator) {
+        KDTree_t &index = *index_;
+        const int dimension = adaptor_->dimension_;
+        Node *node = allocator.Allocate();
+        if (right - left <= index.leaf_max_size_) {
+            node->child1 = node->child2 = nullptr;
+            node->node_type.lr.left = left;
+            node->node_type.lr.right = right;
+            for (int d = 0; d < dimension; ++d) {
+                bbox[d].low = bbox[d].high =
+                        adaptor_->kdtree_get_pt(index.vAcc_[left], d);
+            }
+            for (size_t k = left + 1; k < right; ++k) {
+                for (int d = 0; d < dimension; ++d) {
+                    const TReal value =
+                            adaptor_->kdtree_get_pt(index.vAcc_[k], d);
+                    bbox[d].low = std::min(bbox[d].low, value);
+                    bbox[d].high = std::max(bbox[d].high, value);
+                }
+            }
+            return node;
+        }
+
+        typename KDTree_t::Offset split;
+        typename KDTree_t::Dimension cut_dim;
+        typename KDTree_t::DistanceType cut_value;
+        index.middleSplit_(index, left, right - left, split, cut_dim, cut_value,
+                           bbox);
+        node->node_type.sub.divfeat = cut_dim;
+        BoundingBox left_bbox(bbox);
+        left_bbox[cut_dim].high = cut_value;
+        BoundingBox right_bbox(bbox);
+        right_bbox[cut_dim].low = cut_value;
+        if (parallel_depth > 0 && right - left > kParallelBuildMinSize) {
+            utility::TaskGroup group;
+            group.Run([&]() {
+                NodeAllocator task_allocator(allocator.index_,
+                                             allocator.pool_mutex_);
+                node->child1 = DivideTree(left, left + split, left_bbox,
+                                          parallel_depth - 1, task_allocator);
+            });
+            NodeAllocator task_allocator(allocator.index_,
+                                         allocator.pool_mutex_);
+            node->child2 = DivideTree(left + split, right, right_bbox,
+                                      parallel_depth - 1, task_allocator);
+            group.Wait();
+        } else {
+            node->child1 = DivideTree(left, left + split, left_bbox, 0,
+                                      allocator);
+            node->child2 = DivideTree(left + split, right, right_bbox, 0,
+                                      allocator);
+        }
+        node->node_type.sub.divlow = left_bbox[cut_dim].high;
+        node->node_type.sub.divhigh = right_bbox[cut_dim].low;
+        for (int d = 0; d < dimension; ++d) {
+            bbox[d].low = std::min(left_bbox[d].low, right_bbox[d].low);
+            bbox[d].high = std::max(left_bbox[d].high, right_bbox[d].high);
+        }
+        return node;
+    }
 };
+
+/// Header of a file with a saved KD-tree. The points follow at points_offset,
+/// aligned such that the file can be memory-mapped, and the nanoflann tree at
+/// tree_offset. All values are stored in the native byte order.
+struct KdTreeFileHeader {
+    char magic[8];
+    uint32_t version;
+    /// Byte size of the point coordinates, 4 or 8.
+    uint32_t scalar_size;
+    /// Byte size of the indices of the tree, 4 or 8.
+    uint32_t index_size;
+    uint32_t metric;
+    uint64_t num_points;
+    uint64_t dimension;
+    uint64_t points_offset;
+    uint64_t tree_offset;
+};
+
+static constexpr char kKdTreeFileMagic[8] = {'O', '3', 'D', 'K',
+                                             'D', 'T', 'R', 'E'};
+static constexpr uint32_t kKdTreeFileVersion = 1;
+
+/// Writes a built KD-tree with its points to a stream, see KdTreeFileHeader.
+/// The tree is read back by passing the stream at tree_offset to the
+/// NanoFlannIndexHolder constructor.
+template <int METRIC, class TReal, class TIndex>
+bool WriteKdTree(std::ostream &out,
+                 const NanoFlannIndexHolder<METRIC, TReal, TIndex> &holder) {
+    const auto &adaptor = *holder.adaptor_;
+    const uint64_t points_byte_size = uint64_t(adaptor.dataset_size_) *
+                                      adaptor.dimension_ * sizeof(TReal);
+
+    KdTreeFileHeader header;
+    std::memcpy(header.magic, kKdTreeFileMagic, sizeof(header.magic));
+    header.version = kKdTreeFileVersion;
+    header.scalar_size = sizeof(TReal);
+    header.index_size = sizeof(TIndex);
+    header.metric = METRIC;
+    header.num_points = adaptor.dataset_size_;
+    header.dimension = adaptor.dimension_;
+    header.points_offset = 64;
+    header.tree_offset =
+            (header.points_offset + points_byte_size + 63) / 64 * 64;
+
+    const std::vector<char> padding(64, 0);
+    out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    out.write(padding.data(), header.points_offset - sizeof(header));
+    out.write(reinterpret_cast<const char *>(adaptor.data_ptr_),
+              points_byte_size);
+    out.write(padding.data(),
+              header.tree_offset - header.points_offset - points_byte_size);
+    holder.index_->saveIndex(out);
+    return bool(out);
+}
+
+/// Reads the header of a saved KD-tree. Returns false if the stream does not
+/// contain a KD-tree written by WriteKdTree().
+inline bool ReadKdTreeHeader(std::istream &in, KdTreeFileHeader &header) {
+    in.read(reinterpret_cast<char *>(&header), sizeof(header));
+    return bool(in) &&
+           std::memcmp(header.magic, kKdTreeFileMagic, sizeof(header.magic)) ==
+                   0 &&
+           header.version == kKdTreeFileVersion;
+}
+
+/// Checks that a KD-tree read by the NanoFlannIndexHolder constructor matches
+/// the points of \p header, so that queries cannot read beyond the loaded
+/// points. Raises an error on a mismatch, e.g. for a stale or corrupted file.
+template <int METRIC, class TReal, class TIndex>
+void CheckLoadedKdTree(
+        const NanoFlannIndexHolder<METRIC, TReal, TIndex> &holder,
+        const KdTreeFileHeader &header,
+        const std::string &filename) {
+    const auto &index = *holder.index_;
+    bool valid = index.vAcc_.size() == header.num_points &&
+                 index.size_ == header.num_points &&
+                 static_cast<uint64_t>(index.dim_) == header.dimension &&
+                 index.root_bbox_.size() == header.dimension;
+    for (size_t i = 0; valid && i < index.vAcc_.size(); ++i) {
+        valid = static_cast<uint64_t>(index.vAcc_[i]) < header.num_points;
+    }
+    if (!valid) {
+        utility::LogError(
+                "KD-tree in {} does not match its {} points of dimension {}.",
+                filename, header.num_points, header.dimension);
+    }
+}
+
 namespace impl {
 
+/// Number of consecutive queries of the Morton order that are searched by the
+/// same task.
+constexpr size_t kSortedQueryBatchSize = 64;
+
+/// Spreads the lower 21 bits of x to every third bit.
+inline uint64_t SpreadBitsBy3(uint64_t x) {
+    x &= 0x1fffff;
+    x = (x | x << 32) & 0x1f00000000ffff;
+    x = (x | x << 16) & 0x1f0000ff0000ff;
+    x = (x | x << 8) & 0x100f00f00f00f00f;
+    x = (x | x << 4) & 0x10c30c30c30c30c3;
+    x = (x | x << 2) & 0x1249249249249249;
+    return x;
+}
+
+/// Returns the query indices sorted by the Morton code of the first three
+/// coordinates of the queries, so that consecutive queries are close to each
+/// other and visit the same nodes of the tree.
+template <class T>
+std::vector<int64_t> SortQueriesByMortonCode(size_t num_queries,
+                                             const T *const queries,
+                                             size_t dimension) {
+    const size_t morton_dims = std::min<size_t>(dimension, 3);
+    const uint64_t max_cell = (uint64_t(1) << 21) - 1;
+    T min_bound[3], scale[3];
+    for (size_t d = 0; d < morton_dims; ++d) {
+        T min_value = std::numeric_limits<T>::max();
+        T max_value = std::numeric_limits<T>::lowest();
+        for (size_t i = 0; i < num_queries; ++i) {
+            min_value = std::min(min_value, queries[i * dimension + d]);
+            max_value = std::max(max_value, queries[i * dimension + d]);
+        }
+        const T extent = max_value - min_value;
+        min_bound[d] = min_value;
+        scale[d] = std::isfinite(extent) && extent > 0 ? max_cell / extent : 0;
+    }
+
+    std::vector<std::pair<uint64_t, int64_t>> codes(num_queries);
+    tbb::parallel_for(
+            tbb::blocked_range<size_t>(0, num_queries),
+            [&](const tbb::blocked_range<size_t> &r) {
+                for (size_t i = r.begin(); i != r.end(); ++i) {
+                    uint64_t code = 0;
+                    for (size_t d = 0; d < morton_dims; ++d) {
+                        const T cell = (queries[i * dimension + d] -
+                                        min_bound[d]) *
+                                       scale[d];
+                        // Also maps NaN to 0.
+                        const uint64_t c =
+                                cell > 0 ? std::min(uint64_t(cell), max_cell)
+                                         : 0;
+                        code |= SpreadBitsBy3(c) << d;
+                    }
+                    codes[i] = std::make_pair(code, int64_t(i));
+                }
+            });
+    tbb::parallel_sort(codes.begin(), codes.end());
+
+    std::vector<int64_t> query_order(num_queries);
+    for (size_t i = 0; i < num_queries; ++i) {
+        query_order[i] = codes[i].second;
+    }
+    return query_order;
+}
+
 namespace {
 template <class T, class TIndex, int METRIC>
 void _BuildKdTree(size_t num_points,
                   const T *const points,
                   size_t dimension,
+                  int build_threads,
                   NanoFlannIndexHolderBase **holder) {
-    *holder = new NanoFlannIndexHolder<METRIC, T, TIndex>(num_points, dimension,
-                                                          points);
+    *holder = new NanoFlannIndexHolder<METRIC, T, TIndex>(
+            num_points, dimension, points, /*leaf_max_size=*/10, build_threads);
 }
 
 template <class T, class TIndex, class OUTPUT_ALLOCATOR, int METRIC>
@@ -105,7 +425,8 @@ void _KnnSearchCPU(NanoFlannIndexHolderBase *holder,
                    int knn,
                    bool ignore_query_point,
                    bool return_distances,
-                   OUTPUT_ALLOCATOR &output_allocator) {
+                   OUTPUT_ALLOCATOR &output_allocator,
+                   bool sort_queries) {
     // return empty indices array if there are no points
     if (num_queries == 0 || num_points == 0 || holder == nullptr) {
         std::fill(query_neighbors_row_splits,
@@ -133,12 +454,18 @@ void _KnnSearchCPU(NanoFlannIndexHolderBase *holder,
     auto holder_ =
             static_cast<NanoFlannIndexHolder<METRIC, T, TIndex> *>(holder);
 
+    std::vector<int64_t> query_order;
+    if (sort_queries) {
+        query_order = SortQueriesByMortonCode(num_queries, queries, dimension);
+    }
     tbb::parallel_for(
-            tbb::blocked_range<size_t>(0, num_queries),
+            tbb::blocked_range<size_t>(
+                    0, num_queries, sort_queries ? kSortedQueryBatchSize : 1),
             [&](const tbb::blocked_range<size_t> &r) {
                 std::vector<TIndex> result_indices(knn);
                 std::vector<T> result_distances(knn);
-                for (size_t i = r.begin(); i != r.end(); ++i) {
+                for (size_t o = r.begin(); o != r.end(); ++o) {
+                    const size_t i = sort_queries ? query_order[o] : o;
                     size_t num_valid = holder_->index_->knnSearch(
                             &queries[i * dimension], knn, result_indices.data(),
                             result_distances.data());
@@ -210,7 +537,8 @@ void _RadiusSearchCPU(NanoFlannIndexHolderBase *holder,
                       bool return_distances,
                       bool normalize_distances,
                       bool sort,
-                      OUTPUT_ALLOCATOR &output_allocator) {
+                      OUTPUT_ALLOCATOR &output_allocator,
+                      bool sort_queries) {
     if (num_queries == 0 || num_points == 0 || holder == nullptr) {
         std::fill(query_neighbors_row_splits,
                   query_neighbors_row_splits + num_queries + 1, 0);
@@ -238,11 +566,17 @@ void _RadiusSearchCPU(NanoFlannIndexHolderBase *holder,
 
     auto holder_ =
             static_cast<NanoFlannIndexHolder<METRIC, T, TIndex> *>(holder);
+    std::vector<int64_t> query_order;
+    if (sort_queries) {
+        query_order = SortQueriesByMortonCode(num_queries, queries, dimension);
+    }
     tbb::parallel_for(
-            tbb::blocked_range<size_t>(0, num_queries),
+            tbb::blocked_range<size_t>(
+                    0, num_queries, sort_queries ? kSortedQueryBatchSize : 1),
             [&](const tbb::blocked_range<size_t> &r) {
                 std::vector<nanoflann::ResultItem<TIndex, T>> search_result;
-                for (size_t i = r.begin(); i != r.end(); ++i) {
+                for (size_t o = r.begin(); o != r.end(); ++o) {
+                    const size_t i = sort_queries ? query_order[o] : o;
                     T radius = radii[i];
                     if (METRIC == L2) {
                         radius = radius * radius;
@@ -326,7 +660,8 @@ void _HybridSearchCPU(NanoFlannIndexHolderBase *holder,
                       const int max_knn,
                       bool ignore_query_point,
                       bool return_distances,
-                      OUTPUT_ALLOCATOR &output_allocator) {
+                      OUTPUT_ALLOCATOR &output_allocator,
+                      bool sort_queries) {
     if (num_queries == 0 || num_points == 0 || holder == nullptr) {
         TIndex *indices_ptr, *counts_ptr;
         output_allocator.AllocIndices(&indices_ptr, 0);
@@ -351,11 +686,17 @@ void _HybridSearchCPU(NanoFlannIndexHolderBase *holder,
 
     auto holder_ =
             static_cast<NanoFlannIndexHolder<METRIC, T, TIndex> *>(holder);
+    std::vector<int64_t> query_order;
+    if (sort_queries) {
+        query_order = SortQueriesByMortonCode(num_queries, queries, dimension);
+    }
     tbb::parallel_for(
-            tbb::blocked_range<size_t>(0, num_queries),
+            tbb::blocked_range<size_t>(
+                    0, num_queries, sort_queries ? kSortedQueryBatchSize : 1),
             [&](const tbb::blocked_range<size_t> &r) {
                 std::vector<nanoflann::ResultItem<TIndex, T>> ret_matches;
-                for (size_t i = r.begin(); i != r.end(); ++i) {
+                for (size_t o = r.begin(); o != r.end(); ++o) {
+                    const size_t i = sort_queries ? query_order[o] : o;
                     size_t num_results = holder_->index_->radiusSearch(
                             &queries[i * dimension], radius_squared,
                             ret_matches, params);
@@ -398,13 +739,17 @@ void _HybridSearchCPU(NanoFlannIndexHolderBase *holder,
 /// \param metric   Onf of L1, L2. Defines the distance metric for the
 /// search
 ///
+/// \param build_threads   The number of subtrees built concurrently. 1
+/// builds the tree serially, values <= 0 use all threads.
+///
 template <class T, class TIndex>
 std::unique_ptr<NanoFlannIndexHolderBase> BuildKdTree(size_t num_points,
                                                       const T *const points,
                                                       size_t dimension,
-                                                      const Metric metric) {
+                                                      const Metric metric,
+                                                      int build_threads = 1) {
     NanoFlannIndexHolderBase *holder = nullptr;
-#define FN_PARAMETERS num_points, points, dimension, &holder
+#define FN_PARAMETERS num_points, points, dimension, build_threads, &holder
 
 #define CALL_TEMPLATE(METRIC)                           \
     if (METRIC == metric) {                             \
@@ -476,6 +821,10 @@ std::unique_ptr<NanoFlannIndexHolderBase> BuildKdTree(size_t num_points,
 ///         elements. Both functions must accept the argument size==0.
 ///         In this case ptr does not need to be set.
 ///
+/// \param sort_queries    If true then the queries are searched in the order
+///        of their Morton codes, which improves the cache locality for large
+///        sets of spatially coherent queries. The results are the same.
+///
 template <class T, class TIndex, class OUTPUT_ALLOCATOR>
 void KnnSearchCPU(NanoFlannIndexHolderBase *holder,
                   int64_t *query_neighbors_row_splits,
@@ -488,11 +837,12 @@ void KnnSearchCPU(NanoFlannIndexHolderBase *holder,
                   const Metric metric,
                   bool ignore_query_point,
                   bool return_distances,
-                  OUTPUT_ALLOCATOR &output_allocator) {
+                  OUTPUT_ALLOCATOR &output_allocator,
+                  bool sort_queries = false) {
 #define FN_PARAMETERS                                                      \
     holder, query_neighbors_row_splits, num_points, points, num_queries,   \
             queries, dimension, knn, ignore_query_point, return_distances, \
-            output_allocator
+            output_allocator, sort_queries
 
 #define CALL_TEMPLATE(METRIC)                                              \
     if (METRIC == metric) {                                                \
@@ -570,6 +920,10 @@ void KnnSearchCPU(NanoFlannIndexHolderBase *holder,
 ///         elements. Both functions must accept the argument size==0.
 ///         In this case ptr does not need to be set.
 ///
+/// \param sort_queries    If true then the queries are searched in the order
+///        of their Morton codes, which improves the cache locality for large
+///        sets of spatially coherent queries. The results are the same.
+///
 template <class T, class TIndex, class OUTPUT_ALLOCATOR>
 void RadiusSearchCPU(NanoFlannIndexHolderBase *holder,
                      int64_t *query_neighbors_row_splits,
@@ -584,11 +938,12 @@ void RadiusSearchCPU(NanoFlannIndexHolderBase *holder,
                      bool return_distances,
                      bool normalize_distances,
                      bool sort,
-                     OUTPUT_ALLOCATOR &output_allocator) {
+                     OUTPUT_ALLOCATOR &output_allocator,
+                     bool sort_queries = false) {
 #define FN_PARAMETERS                                                        \
     holder, query_neighbors_row_splits, num_points, points, num_queries,     \
             queries, dimension, radii, ignore_query_point, return_distances, \
-            normalize_distances, sort, output_allocator
+            normalize_distances, sort, output_allocator, sort_queries
 
 #define CALL_TEMPLATE(METRIC)                                                 \
     if (METRIC == metric) {                                                   \
@@ -658,6 +1013,10 @@ void RadiusSearchCPU(NanoFlannIndexHolderBase *holder,
 ///         elements. Both functions must accept the argument size==0.
 ///         In this case ptr does not need to be set.
 ///
+/// \param sort_queries    If true then the queries are searched in the order
+///        of their Morton codes, which improves the cache locality for large
+///        sets of spatially coherent queries. The results are the same.
+///
 template <class T, class TIndex, class OUTPUT_ALLOCATOR>
 void HybridSearchCPU(NanoFlannIndexHolderBase *holder,
                      size_t num_points,
@@ -670,10 +1029,12 @@ void HybridSearchCPU(NanoFlannIndexHolderBase *holder,
                      const Metric metric,
                      bool ignore_query_point,
                      bool return_distances,
-                     OUTPUT_ALLOCATOR &output_allocator) {
+                     OUTPUT_ALLOCATOR &output_allocator,
+                     bool sort_queries = false) {
 #define FN_PARAMETERS                                                    \
     holder, num_points, points, num_queries, queries, dimension, radius, \
-            max_knn, ignore_query_point, return_distances, output_allocator
+            max_knn, ignore_query_point, return_distances, output_allocator, \
+            sort_queries
 
 #define CALL_TEMPLATE(METRIC)                                                 \
     if (METRIC == metric) {                                                   \
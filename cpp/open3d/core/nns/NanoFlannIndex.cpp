@@ -7,12 +7,17 @@
 
 #include "open3d/core/nns/NanoFlannIndex.h"
 
+#include <fstream>
+
+#include "open3d/core/Blob.h"
 #include "open3d/core/Dispatch.h"
+#include "open3d/core/ShapeUtil.h"
 #include "open3d/core/TensorCheck.h"
 #include "open3d/core/nns/NanoFlannImpl.h"
 #include "open3d/core/nns/NeighborSearchAllocator.h"
 #include "open3d/core/nns/NeighborSearchCommon.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/MappedFile.h"
 #include "open3d/utility/ParallelScan.h"
 
 namespace open3d {
@@ -49,7 +54,7 @@ bool NanoFlannIndex::SetTensorData(const Tensor &dataset_points,
         holder_ = impl::BuildKdTree<scalar_t, int_t>(
                 dataset_points_.GetShape(0),
                 dataset_points_.GetDataPtr<scalar_t>(),
-                dataset_points_.GetShape(1), /* metric */ L2);
+                dataset_points_.GetShape(1), /* metric */ L2, build_threads_);
     });
     return true;
 };
@@ -86,7 +91,7 @@ std::pair<Tensor, Tensor> NanoFlannIndex::SearchKnn(const Tensor &query_points,
                 query_contiguous.GetDataPtr<scalar_t>(),
                 query_contiguous.GetShape(1), num_neighbors, /* metric */ L2,
                 /* ignore_query_point */ false,
-                /* return_distances */ true, output_allocator);
+                /* return_distances */ true, output_allocator, sort_queries_);
         indices = output_allocator.NeighborsIndex();
         distances = output_allocator.NeighborsDistance();
         indices = indices.View({num_query_points, num_neighbors});
@@ -132,7 +137,8 @@ std::tuple<Tensor, Tensor, Tensor> NanoFlannIndex::SearchRadius(
                 query_contiguous.GetShape(1), radii.GetDataPtr<scalar_t>(),
                 /* metric */ L2,
                 /* ignore_query_point */ false, /* return_distances */ true,
-                /* normalize_distances */ false, sort, output_allocator);
+                /* normalize_distances */ false, sort, output_allocator,
+                sort_queries_);
         indices = output_allocator.NeighborsIndex();
         distances = output_allocator.NeighborsDistance();
     });
@@ -186,7 +192,7 @@ std::tuple<Tensor, Tensor, Tensor> NanoFlannIndex::SearchHybrid(
                 query_contiguous.GetShape(1), static_cast<scalar_t>(radius),
                 max_knn,
                 /* metric*/ L2, /* ignore_query_point */ false,
-                /* return_distances */ true, output_allocator);
+                /* return_distances */ true, output_allocator, sort_queries_);
 
         indices = output_allocator.NeighborsIndex().View(
                 {num_query_points, max_knn});
@@ -197,6 +203,93 @@ std::tuple<Tensor, Tensor, Tensor> NanoFlannIndex::SearchHybrid(
     return std::make_tuple(indices, distances, counts);
 }
 
+bool NanoFlannIndex::SaveIndex(const std::string &filename) const {
+    if (!holder_) {
+        utility::LogWarning("Write NanoFlannIndex failed: index is empty.");
+        return false;
+    }
+    std::ofstream out(filename, std::ios::binary);
+    bool success = false;
+    DISPATCH_FLOAT_INT_DTYPE_TO_TEMPLATE(GetDtype(), GetIndexDtype(), [&]() {
+        success = WriteKdTree(
+                out,
+                static_cast<const NanoFlannIndexHolder<L2, scalar_t, int_t> &>(
+                        *holder_));
+    });
+    if (!success) {
+        utility::LogWarning("Write NanoFlannIndex failed: unable to write {}.",
+                            filename);
+    }
+    return success;
+}
+
+bool NanoFlannIndex::LoadIndex(const std::string &filename) {
+    std::ifstream in(filename, std::ios::binary);
+    KdTreeFileHeader header;
+    if (!in || !ReadKdTreeHeader(in, header)) {
+        utility::LogWarning("Read NanoFlannIndex failed: unable to read {}.",
+                            filename);
+        return false;
+    }
+    if (header.metric != L2 ||
+        (header.scalar_size != 4 && header.scalar_size != 8) ||
+        (header.index_size != 4 && header.index_size != 8)) {
+        utility::LogWarning(
+                "Read NanoFlannIndex failed: unsupported index in {}.",
+                filename);
+        return false;
+    }
+    const Dtype dtype = header.scalar_size == 4 ? Float32 : Float64;
+    const Dtype index_dtype = header.index_size == 4 ? Int32 : Int64;
+    const SizeVector shape{static_cast<int64_t>(header.num_points),
+                           static_cast<int64_t>(header.dimension)};
+    const int64_t byte_size = shape.NumElements() * dtype.ByteSize();
+
+    // The points are used in place from the mapped file. The tree nodes are
+    // allocated by nanoflann and always read.
+    Tensor dataset_points;
+    std::shared_ptr<utility::MappedFile> mapped_file =
+            utility::MappedFile::Open(filename);
+    if (mapped_file &&
+        header.points_offset + byte_size <= mapped_file->GetByteSize()) {
+        auto blob = std::make_shared<Blob>(
+                Device("CPU:0"), mapped_file->GetData() + header.points_offset,
+                [mapped_file](void *) {});
+        dataset_points = Tensor(shape, shape_util::DefaultStrides(shape),
+                                blob->GetDataPtr(), dtype, blob);
+    } else {
+        dataset_points = Tensor::Empty(shape, dtype);
+        in.seekg(header.points_offset);
+        in.read(static_cast<char *>(dataset_points.GetDataPtr()), byte_size);
+    }
+
+    std::unique_ptr<NanoFlannIndexHolderBase> holder;
+    in.seekg(header.tree_offset);
+    if (in) {
+        DISPATCH_FLOAT_INT_DTYPE_TO_TEMPLATE(dtype, index_dtype, [&]() {
+            holder.reset(new NanoFlannIndexHolder<L2, scalar_t, int_t>(
+                    header.num_points, header.dimension,
+                    dataset_points.GetDataPtr<scalar_t>(),
+                    /*leaf_max_size=*/10, /*build_threads=*/1, &in));
+        });
+    }
+    if (!in) {
+        utility::LogWarning("Read NanoFlannIndex failed: {} is truncated.",
+                            filename);
+        return false;
+    }
+    DISPATCH_FLOAT_INT_DTYPE_TO_TEMPLATE(dtype, index_dtype, [&]() {
+        CheckLoadedKdTree(
+                static_cast<const NanoFlannIndexHolder<L2, scalar_t, int_t> &>(
+                        *holder),
+                header, filename);
+    });
+    dataset_points_ = dataset_points;
+    index_dtype_ = index_dtype;
+    holder_ = std::move(holder);
+    return true;
+}
+
 }  // namespace nns
 }  // namespace core
 }  // namespace open3d
@@ -103,9 +103,44 @@ public:
                                                     double radius,
                                                     int max_knn) const override;
 
+    /// Set the number of subtrees built concurrently by SetTensorData(). 1
+    /// builds the KDTree serially, values <= 0 use all threads. Building in
+    /// parallel gives the same KDTree and pays off for millions of points.
+    void SetBuildThreads(int build_threads) { build_threads_ = build_threads; }
+
+    /// Get the number of subtrees built concurrently.
+    int GetBuildThreads() const { return build_threads_; }
+
+    /// Search the queries in the order of their Morton codes. This keeps the
+    /// nodes visited by each thread in cache and speeds up large sets of
+    /// spatially coherent queries, e.g. the transformed source points of a
+    /// registration. The results are the same in both modes.
+    void SetSortQueries(bool sort_queries) { sort_queries_ = sort_queries; }
+
+    /// Get whether the queries are searched in the order of their Morton
+    /// codes.
+    bool GetSortQueries() const { return sort_queries_; }
+
+    /// Save the points and the built KDTree to a file.
+    ///
+    /// \param filename Path to the file to write.
+    /// \return True if the index has been saved.
+    bool SaveIndex(const std::string &filename) const;
+
+    /// Load an index saved by SaveIndex(), without building the KDTree again.
+    /// The points are memory-mapped from the file when possible. Indices saved
+    /// by geometry::KDTreeFlann can be loaded as well. Raises an error if the
+    /// saved tree does not match the saved points.
+    ///
+    /// \param filename Path to the file to read.
+    /// \return True if the index has been loaded.
+    bool LoadIndex(const std::string &filename);
+
 protected:
     // Tensor dataset_points_;
     std::unique_ptr<NanoFlannIndexHolderBase> holder_;
+    int build_threads_ = 1;
+    bool sort_queries_ = false;
 };
 }  // namespace nns
 }  // namespace core
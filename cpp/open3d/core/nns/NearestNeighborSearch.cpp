@@ -7,20 +7,44 @@
 
 #include "open3d/core/nns/NearestNeighborSearch.h"
 
+#include "open3d/core/MemoryManagerStatistic.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Profiler.h"
 
 namespace open3d {
 namespace core {
 namespace nns {
 
+namespace {
+/// Tag of the memory allocated by the indices and searches.
+constexpr const char* kMemoryTag = "core::nns::NearestNeighborSearch";
+
+/// Brute force is faster than the KD-tree for high-dimensional points, e.g.
+/// 33-D FPFH features, where the KD-tree visits most leaves. Low-dimensional
+/// points keep the KD-tree, whose order of ties and rounding of distances
+/// existing callers may rely on. Large datasets keep the KD-tree as well,
+/// since brute force scans all points for every query.
+bool UseBruteForceKnn(const Tensor& dataset_points) {
+    return dataset_points.GetShape(1) >=
+                   NearestNeighborSearch::kMinBruteForceKnnDim &&
+           dataset_points.GetShape(0) <=
+                   NearestNeighborSearch::kMaxBruteForceKnnPoints;
+}
+}  // namespace
+
 NearestNeighborSearch::~NearestNeighborSearch(){};
 
 bool NearestNeighborSearch::SetIndex() {
+    ScopedMemoryTag memory_tag(kMemoryTag);
+    OPEN3D_PROFILE_SCOPE("core::nns::BuildNanoFlannIndex");
     nanoflann_index_.reset(new NanoFlannIndex());
+    nanoflann_index_->SetSortQueries(sort_queries_);
     return nanoflann_index_->SetTensorData(dataset_points_, index_dtype_);
 };
 
 bool NearestNeighborSearch::KnnIndex() {
+    ScopedMemoryTag memory_tag(kMemoryTag);
+    hnsw_index_.reset();
     if (dataset_points_.IsCUDA()) {
 #ifdef BUILD_CUDA_MODULE
         knn_index_.reset(new nns::KnnIndex());
@@ -30,14 +54,27 @@ bool NearestNeighborSearch::KnnIndex() {
                 "-DBUILD_CUDA_MODULE=OFF. Please recompile Open3D with "
                 "-DBUILD_CUDA_MODULE=ON.");
 #endif
+    } else if (dataset_points_.NumDims() == 2 &&
+               UseBruteForceKnn(dataset_points_)) {
+        knn_index_.reset(new nns::KnnIndex());
+        return knn_index_->SetTensorData(dataset_points_, index_dtype_);
     } else {
         return SetIndex();
     }
 };
 
+bool NearestNeighborSearch::ApproximateKnnIndex(int ef_search) {
+    ScopedMemoryTag memory_tag(kMemoryTag);
+    AssertNotCUDA(dataset_points_);
+    hnsw_index_.reset(new nns::HnswIndex());
+    hnsw_index_->SetEfSearch(ef_search);
+    return hnsw_index_->SetTensorData(dataset_points_, index_dtype_);
+}
+
 bool NearestNeighborSearch::MultiRadiusIndex() { return SetIndex(); };
 
 bool NearestNeighborSearch::FixedRadiusIndex(utility::optional<double> radius) {
+    ScopedMemoryTag memory_tag(kMemoryTag);
     if (dataset_points_.IsCUDA()) {
         if (!radius.has_value())
             utility::LogError("radius is required for GPU FixedRadiusIndex.");
@@ -58,6 +95,7 @@ bool NearestNeighborSearch::FixedRadiusIndex(utility::optional<double> radius) {
 }
 
 bool NearestNeighborSearch::HybridIndex(utility::optional<double> radius) {
+    ScopedMemoryTag memory_tag(kMemoryTag);
     if (dataset_points_.IsCUDA()) {
         if (!radius.has_value())
             utility::LogError("radius is required for GPU HybridIndex.");
@@ -76,8 +114,17 @@ bool NearestNeighborSearch::HybridIndex(utility::optional<double> radius) {
     }
 };
 
+void NearestNeighborSearch::SetSortQueries(bool sort_queries) {
+    sort_queries_ = sort_queries;
+    if (nanoflann_index_) {
+        nanoflann_index_->SetSortQueries(sort_queries);
+    }
+}
+
 std::pair<Tensor, Tensor> NearestNeighborSearch::KnnSearch(
         const Tensor& query_points, int knn) {
+    OPEN3D_PROFILE_SCOPE("core::nns::KnnSearch");
+    ScopedMemoryTag memory_tag(kMemoryTag);
     AssertTensorDevice(query_points, dataset_points_.GetDevice());
 
     if (dataset_points_.IsCUDA()) {
@@ -87,7 +134,18 @@ std::pair<Tensor, Tensor> NearestNeighborSearch::KnnSearch(
             utility::LogError("Index is not set.");
         }
     } else {
-        if (nanoflann_index_) {
+        if (hnsw_index_) {
+            return hnsw_index_->SearchKnn(query_points, knn);
+        } else if (knn_index_ &&
+                   query_points.GetShape(0) <= kMaxBruteForceKnnQueries) {
+            return knn_index_->SearchKnn(query_points, knn);
+        } else if (knn_index_) {
+            // Many queries are faster with the KD-tree, built on first use.
+            if (!nanoflann_index_) {
+                SetIndex();
+            }
+            return nanoflann_index_->SearchKnn(query_points, knn);
+        } else if (nanoflann_index_) {
             return nanoflann_index_->SearchKnn(query_points, knn);
         } else {
             utility::LogError("Index is not set.");
@@ -97,6 +155,8 @@ std::pair<Tensor, Tensor> NearestNeighborSearch::KnnSearch(
 
 std::tuple<Tensor, Tensor, Tensor> NearestNeighborSearch::FixedRadiusSearch(
         const Tensor& query_points, double radius, bool sort) {
+    OPEN3D_PROFILE_SCOPE("core::nns::FixedRadiusSearch");
+    ScopedMemoryTag memory_tag(kMemoryTag);
     AssertTensorDevice(query_points, dataset_points_.GetDevice());
 
     if (dataset_points_.IsCUDA()) {
@@ -117,6 +177,8 @@ std::tuple<Tensor, Tensor, Tensor> NearestNeighborSearch::FixedRadiusSearch(
 
 std::tuple<Tensor, Tensor, Tensor> NearestNeighborSearch::MultiRadiusSearch(
         const Tensor& query_points, const Tensor& radii) {
+    OPEN3D_PROFILE_SCOPE("core::nns::MultiRadiusSearch");
+    ScopedMemoryTag memory_tag(kMemoryTag);
     AssertNotCUDA(query_points);
     AssertTensorDtype(query_points, dataset_points_.GetDtype());
     AssertTensorDtype(radii, dataset_points_.GetDtype());
@@ -131,6 +193,8 @@ std::tuple<Tensor, Tensor, Tensor> NearestNeighborSearch::HybridSearch(
         const Tensor& query_points,
         const double radius,
         const int max_knn) const {
+    OPEN3D_PROFILE_SCOPE("core::nns::HybridSearch");
+    ScopedMemoryTag memory_tag(kMemoryTag);
     AssertTensorDevice(query_points, dataset_points_.GetDevice());
 
     if (dataset_points_.IsCUDA()) {
@@ -11,6 +11,7 @@
 
 #include "open3d/core/Tensor.h"
 #include "open3d/core/nns/FixedRadiusIndex.h"
+#include "open3d/core/nns/HnswIndex.h"
 #include "open3d/core/nns/KnnIndex.h"
 #include "open3d/core/nns/NanoFlannIndex.h"
 #include "open3d/utility/Optional.h"
@@ -37,12 +38,34 @@ public:
     NearestNeighborSearch(const NearestNeighborSearch &) = delete;
     NearestNeighborSearch &operator=(const NearestNeighborSearch &) = delete;
 
+public:
+    /// Smallest point dimension searched by brute force on CPU.
+    static constexpr int64_t kMinBruteForceKnnDim = 16;
+    /// Largest number of dataset points searched by brute force on CPU.
+    static constexpr int64_t kMaxBruteForceKnnPoints = 20000;
+    /// Largest number of queries searched by brute force on CPU.
+    static constexpr int64_t kMaxBruteForceKnnQueries = 20000;
+
 public:
     /// Set index for knn search.
     ///
+    /// On CPU, a brute force KnnIndex is used for at most
+    /// kMaxBruteForceKnnPoints points with at least kMinBruteForceKnnDim
+    /// dimensions and a NanoFlannIndex otherwise. KnnSearch() builds the
+    /// NanoFlannIndex on first use for more than kMaxBruteForceKnnQueries
+    /// queries, since the cost of brute force grows with both counts.
+    ///
     /// \return Returns true if building index success, otherwise false.
     bool KnnIndex();
 
+    /// Set index for approximate knn search with a HnswIndex, replacing the
+    /// index set by KnnIndex(). Only supported on CPU.
+    ///
+    /// \param ef_search The size of the candidate list while searching. Larger
+    /// values find more of the exact neighbors at a lower speed.
+    /// \return Returns true if building index success, otherwise false.
+    bool ApproximateKnnIndex(int ef_search = 64);
+
     /// Set index for multi-radius search.
     ///
     /// \return Returns true if building index success, otherwise false.
@@ -59,6 +82,11 @@ public:
     /// \return Returns true if building index success, otherwise false.
     bool HybridIndex(utility::optional<double> radius = {});
 
+    /// Search the queries of the KDTree index in the order of their Morton
+    /// codes, see NanoFlannIndex::SetSortQueries(). Applies to the current
+    /// index and to the indices set later.
+    void SetSortQueries(bool sort_queries);
+
     /// Perform knn search.
     ///
     /// \param query_points Query points. Must be 2D, with shape {n, d}.
@@ -126,8 +154,10 @@ protected:
     std::unique_ptr<NanoFlannIndex> nanoflann_index_;
     std::unique_ptr<nns::FixedRadiusIndex> fixed_radius_index_;
     std::unique_ptr<nns::KnnIndex> knn_index_;
+    std::unique_ptr<nns::HnswIndex> hnsw_index_;
     const Tensor dataset_points_;
     const Dtype index_dtype_;
+    bool sort_queries_ = false;
 };
 }  // namespace nns
 }  // namespace core
@@ -54,6 +54,16 @@ struct NanoFlannIndexHolderBase {
     virtual ~NanoFlannIndexHolderBase() {}
 };
 
+/// Base struct for Hnsw index holder
+struct HnswIndexHolderBase {
+    virtual ~HnswIndexHolderBase() {}
+};
+
+/// Base struct for dynamic KDTree index holder
+struct DynamicKDTreeHolderBase {
+    virtual ~DynamicKDTreeHolderBase() {}
+};
+
 }  // namespace nns
 }  // namespace core
 }  // namespace open3d
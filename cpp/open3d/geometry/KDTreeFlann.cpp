@@ -12,8 +12,10 @@
 
 #include "open3d/geometry/KDTreeFlann.h"
 
+#include <fstream>
 #include <nanoflann.hpp>
 
+#include "open3d/core/nns/NanoFlannImpl.h"
 #include "open3d/geometry/HalfEdgeTriangleMesh.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
@@ -175,10 +177,55 @@ bool KDTreeFlann::SetRawData(const Eigen::Map<const Eigen::MatrixXd> &data) {
     data_.resize(dataset_size_ * dimension_);
     memcpy(data_.data(), data.data(),
            dataset_size_ * dimension_ * sizeof(double));
-    data_interface_.reset(new Eigen::Map<const Eigen::MatrixXd>(data));
-    nanoflann_index_.reset(
-            new KDTree_t(dimension_, std::cref(*data_interface_), 15));
-    nanoflann_index_->index_->buildIndex();
+    nanoflann_index_.reset(new KDTree_t(dataset_size_, int(dimension_),
+                                        data_.data(), /*leaf_max_size=*/15,
+                                        build_threads_));
+    return true;
+}
+
+bool KDTreeFlann::SaveIndex(const std::string &filename) const {
+    std::ofstream out(filename, std::ios::binary);
+    if (!nanoflann_index_ || !core::nns::WriteKdTree(out, *nanoflann_index_)) {
+        utility::LogWarning(
+                "[KDTreeFlann::SaveIndex] Unable to write file {}.", filename);
+        return false;
+    }
+    return true;
+}
+
+bool KDTreeFlann::LoadIndex(const std::string &filename) {
+    std::ifstream in(filename, std::ios::binary);
+    core::nns::KdTreeFileHeader header;
+    if (!in || !core::nns::ReadKdTreeHeader(in, header) ||
+        header.metric != core::nns::L2 ||
+        header.scalar_size != sizeof(double) ||
+        header.index_size != sizeof(Eigen::Index)) {
+        utility::LogWarning(
+                "[KDTreeFlann::LoadIndex] Unable to read file {}.", filename);
+        return false;
+    }
+    std::vector<double> data(header.num_points * header.dimension);
+    in.seekg(header.points_offset);
+    in.read(reinterpret_cast<char *>(data.data()),
+            data.size() * sizeof(double));
+    in.seekg(header.tree_offset);
+    std::unique_ptr<KDTree_t> index;
+    if (in) {
+        index.reset(new KDTree_t(header.num_points, int(header.dimension),
+                                 data.data(), /*leaf_max_size=*/15,
+                                 /*build_threads=*/1, &in));
+    }
+    if (!in) {
+        utility::LogWarning("[KDTreeFlann::LoadIndex] File {} is truncated.",
+                            filename);
+        return false;
+    }
+    core::nns::CheckLoadedKdTree(*index, header, filename);
+    // The index refers to the vector's buffer, which is kept by the move.
+    data_ = std::move(data);
+    nanoflann_index_ = std::move(index);
+    dimension_ = header.dimension;
+    dataset_size_ = header.num_points;
     return true;
 }
 
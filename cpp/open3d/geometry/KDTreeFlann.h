@@ -9,18 +9,23 @@
 
 #include <Eigen/Core>
 #include <memory>
+#include <string>
 #include <vector>
 
+#include "open3d/core/nns/NeighborSearchCommon.h"
 #include "open3d/geometry/Geometry.h"
 #include "open3d/geometry/KDTreeSearchParam.h"
 #include "open3d/pipelines/registration/Feature.h"
 
 /// @cond
-namespace nanoflann {
-struct metric_L2;
-template <class MatrixType, int DIM, class Distance, bool row_major>
-struct KDTreeEigenMatrixAdaptor;
-}  // namespace nanoflann
+namespace open3d {
+namespace core {
+namespace nns {
+template <int METRIC, class TReal, class TIndex>
+struct NanoFlannIndexHolder;
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
 /// @endcond
 
 namespace open3d {
@@ -64,6 +69,26 @@ public:
     /// \param feature Set of features for KDTree construction.
     bool SetFeature(const pipelines::registration::Feature &feature);
 
+    /// Sets the number of subtrees built concurrently when the data is set.
+    ///
+    /// \param build_threads 1 builds the KDTree serially, values <= 0 use all
+    /// threads. Building in parallel gives the same KDTree and pays off for
+    /// millions of points.
+    void SetBuildThreads(int build_threads) { build_threads_ = build_threads; }
+    /// Returns the number of subtrees built concurrently.
+    int GetBuildThreads() const { return build_threads_; }
+
+    /// Saves the data points and the built KDTree to a file.
+    ///
+    /// \param filename Path to the file to write.
+    bool SaveIndex(const std::string &filename) const;
+    /// Loads the data points and the KDTree saved by SaveIndex(), without
+    /// building the KDTree again. Raises an error if the saved tree does not
+    /// match the saved points.
+    ///
+    /// \param filename Path to the file to read.
+    bool LoadIndex(const std::string &filename);
+
     template <typename T>
     int Search(const T &query,
                const KDTreeSearchParam &param,
@@ -97,17 +122,14 @@ private:
     bool SetRawData(const Eigen::Map<const Eigen::MatrixXd> &data);
 
 protected:
-    using KDTree_t = nanoflann::KDTreeEigenMatrixAdaptor<
-            Eigen::Map<const Eigen::MatrixXd>,
-            -1,
-            nanoflann::metric_L2,
-            false>;
+    using KDTree_t = core::nns::
+            NanoFlannIndexHolder<core::nns::L2, double, Eigen::Index>;
 
     std::vector<double> data_;
-    std::unique_ptr<Eigen::Map<const Eigen::MatrixXd>> data_interface_;
     std::unique_ptr<KDTree_t> nanoflann_index_;
     size_t dimension_ = 0;
     size_t dataset_size_ = 0;
+    int build_threads_ = 1;
 };
 
 }  // namespace geometry
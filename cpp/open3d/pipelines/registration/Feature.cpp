@@ -9,6 +9,8 @@
 
 #include <Eigen/Dense>
 
+#include "open3d/core/Tensor.h"
+#include "open3d/core/nns/HnswIndex.h"
 #include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/utility/Logging.h"
@@ -139,10 +141,48 @@ std::shared_ptr<Feature> ComputeFPFHFeature(
     return feature;
 }
 
+/// Matches each query feature to its approximate nearest dataset feature.
+static CorrespondenceSet ApproximateCorrespondencesFromFeatures(
+        const Feature &query_features,
+        const Feature &dataset_features,
+        int ef_search) {
+    // A (dim, n) column-major feature matrix has the memory layout of a
+    // row-major {n, dim} tensor.
+    const core::Tensor queries(
+            query_features.data_.data(),
+            {query_features.data_.cols(), query_features.data_.rows()},
+            core::Float64);
+    const core::Tensor dataset(
+            dataset_features.data_.data(),
+            {dataset_features.data_.cols(), dataset_features.data_.rows()},
+            core::Float64);
+    core::nns::HnswIndex index;
+    index.SetEfSearch(ef_search);
+    index.SetTensorData(dataset, core::Int32);
+    const core::Tensor indices = index.SearchKnn(queries, 1).first;
+    const int32_t *indices_ptr = indices.GetDataPtr<int32_t>();
+
+    CorrespondenceSet corres(query_features.data_.cols());
+    for (int i = 0; i < int(corres.size()); ++i) {
+        corres[i] = Eigen::Vector2i(i, indices_ptr[i]);
+    }
+    return corres;
+}
+
 CorrespondenceSet CorrespondencesFromFeatures(const Feature &source_features,
                                               const Feature &target_features,
                                               bool mutual_filter,
-                                              float mutual_consistent_ratio) {
+                                              float mutual_consistent_ratio,
+                                              int approximate_ef_search) {
+    // Indices cannot be built on empty features, and errors raised within
+    // the parallel region below would terminate the process.
+    if (source_features.data_.cols() == 0 ||
+        target_features.data_.cols() == 0) {
+        utility::LogWarning(
+                "Empty source or target features, no correspondences found.");
+        return CorrespondenceSet();
+    }
+
     const int num_searches = mutual_filter ? 2 : 1;
 
     // Access by reference, since Eigen Matrix could be copied
@@ -159,6 +199,11 @@ CorrespondenceSet CorrespondencesFromFeatures(const Feature &source_features,
     const int kInnerThreads = std::max(kMaxThreads / num_searches, 1);
 #pragma omp parallel for num_threads(kOuterThreads)
     for (int k = 0; k < num_searches; ++k) {
+        if (approximate_ef_search > 0) {
+            corres[k] = ApproximateCorrespondencesFromFeatures(
+                    features[k], features[1 - k], approximate_ef_search);
+            continue;
+        }
         geometry::KDTreeFlann kdtree(features[1 - k]);
 
         int num_pts_k = num_pts[k];
@@ -290,13 +290,15 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
         const std::vector<std::reference_wrapper<const CorrespondenceChecker>>
                 &checkers /* = {}*/,
         const RANSACConvergenceCriteria
-                &criteria /* = RANSACConvergenceCriteria()*/) {
+                &criteria /* = RANSACConvergenceCriteria()*/,
+        int approximate_ef_search /* = 0*/) {
     if (ransac_n < 3 || max_correspondence_distance <= 0.0) {
         return RegistrationResult();
     }
 
     CorrespondenceSet corres = CorrespondencesFromFeatures(
-            source_features, target_features, mutual_filter);
+            source_features, target_features, mutual_filter,
+            /*mutual_consistency_ratio=*/0.1f, approximate_ef_search);
 
     return RegistrationRANSACBasedOnCorrespondence(
             source, target, corres, max_correspondence_distance, estimation,
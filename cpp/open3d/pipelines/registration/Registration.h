@@ -194,6 +194,8 @@ RegistrationResult RegistrationRANSACBasedOnCorrespondence(
 /// \param ransac_n Fit ransac with `ransac_n` correspondences.
 /// \param checkers Correspondence checker.
 /// \param criteria Convergence criteria.
+/// \param approximate_ef_search If positive, the features are matched with an
+/// approximate nearest neighbor search, see CorrespondencesFromFeatures().
 RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
@@ -207,7 +209,8 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
         const std::vector<std::reference_wrapper<const CorrespondenceChecker>>
                 &checkers = {},
         const RANSACConvergenceCriteria &criteria =
-                RANSACConvergenceCriteria());
+                RANSACConvergenceCriteria(),
+        int approximate_ef_search = 0);
 
 /// \param source The source point cloud.
 /// \param target The target point cloud.
@@ -38,12 +38,19 @@
 #include "open3d/t/geometry/kernel/PointCloud.h"
 #include "open3d/t/geometry/kernel/Transform.h"
 #include "open3d/t/pipelines/registration/Registration.h"
+#include "open3d/utility/Profiler.h"
 #include "open3d/utility/Random.h"
 
 namespace open3d {
 namespace t {
 namespace geometry {
 
+/// Half precision dtypes are storage types. Attributes stored in them are
+/// converted to a float dtype for computing, and the results are rounded back.
+static bool IsHalfPrecision(const core::Dtype &dtype) {
+    return dtype == core::Float16 || dtype == core::BFloat16;
+}
+
 PointCloud::PointCloud(const core::Device &device)
     : Geometry(Geometry::GeometryType::PointCloud, 3),
       device_(device),
@@ -277,6 +284,7 @@ PointCloud PointCloud::SelectByIndex(
 
 PointCloud PointCloud::VoxelDownSample(double voxel_size,
                                        const std::string &reduction) const {
+    OPEN3D_PROFILE_SCOPE("t::geometry::PointCloud::VoxelDownSample");
     if (voxel_size <= 0) {
         utility::LogError("voxel_size must be positive.");
     }
@@ -511,6 +519,14 @@ PointCloud &PointCloud::NormalizeNormals() {
         SetPointNormals(GetPointNormals().Contiguous());
     }
 
+    const core::Dtype normals_dtype = GetPointNormals().GetDtype();
+    if (IsHalfPrecision(normals_dtype)) {
+        SetPointNormals(GetPointNormals().To(core::Float32));
+        NormalizeNormals();
+        SetPointNormals(GetPointNormals().To(normals_dtype));
+        return *this;
+    }
+
     core::Tensor &normals = GetPointNormals();
     if (IsCPU()) {
         kernel::pointcloud::NormalizeNormalsCPU(normals);
@@ -527,7 +543,8 @@ PointCloud &PointCloud::PaintUniformColor(const core::Tensor &color) {
     core::AssertTensorShape(color, {3});
     core::Tensor clipped_color = color.To(GetDevice());
     if (color.GetDtype() == core::Float32 ||
-        color.GetDtype() == core::Float64) {
+        color.GetDtype() == core::Float64 ||
+        IsHalfPrecision(color.GetDtype())) {
         clipped_color = clipped_color.Clip(0.0f, 1.0f);
     }
     core::Tensor pcd_colors =
@@ -587,6 +604,7 @@ std::tuple<PointCloud, core::Tensor> PointCloud::ComputeBoundaryPoints(
 void PointCloud::EstimateNormals(
         const utility::optional<int> max_knn /* = 30*/,
         const utility::optional<double> radius /*= utility::nullopt*/) {
+    OPEN3D_PROFILE_SCOPE("t::geometry::PointCloud::EstimateNormals");
     core::AssertTensorDtypes(this->GetPointPositions(),
                              {core::Float32, core::Float64});
 
@@ -594,10 +612,15 @@ void PointCloud::EstimateNormals(
     const core::Device device = GetDevice();
 
     const bool has_normals = HasPointNormals();
+    const core::Dtype normals_dtype =
+            has_normals ? GetPointNormals().GetDtype() : dtype;
 
     if (!has_normals) {
         this->SetPointNormals(core::Tensor::Empty(
                 {GetPointPositions().GetLength(), 3}, dtype, device));
+    } else if (IsHalfPrecision(normals_dtype)) {
+        // Half precision normals are estimated in the dtype of the positions.
+        this->SetPointNormals(GetPointNormals().To(dtype));
     } else {
         core::AssertTensorDtype(this->GetPointNormals(), dtype);
 
@@ -676,6 +699,10 @@ void PointCloud::EstimateNormals(
     // TODO (@rishabh): Don't remove covariances attribute, when
     // EstimateCovariance functionality is exposed.
     RemovePointAttr("covariances");
+
+    if (normals_dtype != dtype) {
+        this->SetPointNormals(GetPointNormals().To(normals_dtype));
+    }
 }
 
 void PointCloud::OrientNormalsToAlignWithDirection(
@@ -690,6 +717,14 @@ void PointCloud::OrientNormalsToAlignWithDirection(
         SetPointNormals(GetPointNormals().Contiguous());
     }
 
+    const core::Dtype normals_dtype = GetPointNormals().GetDtype();
+    if (IsHalfPrecision(normals_dtype)) {
+        SetPointNormals(GetPointNormals().To(GetPointPositions().GetDtype()));
+        OrientNormalsToAlignWithDirection(orientation_reference);
+        SetPointNormals(GetPointNormals().To(normals_dtype));
+        return;
+    }
+
     core::Tensor reference =
             orientation_reference.To(GetPointPositions().GetDtype());
 
@@ -717,6 +752,14 @@ void PointCloud::OrientNormalsTowardsCameraLocation(
         SetPointNormals(GetPointNormals().Contiguous());
     }
 
+    const core::Dtype normals_dtype = GetPointNormals().GetDtype();
+    if (IsHalfPrecision(normals_dtype)) {
+        SetPointNormals(GetPointNormals().To(GetPointPositions().GetDtype()));
+        OrientNormalsTowardsCameraLocation(camera_location);
+        SetPointNormals(GetPointNormals().To(normals_dtype));
+        return;
+    }
+
     core::Tensor reference = camera_location.To(GetPointPositions().GetDtype());
 
     core::Tensor &normals = GetPointNormals();
@@ -741,8 +784,12 @@ void PointCloud::OrientNormalsConsistentTangentPlane(
     open3d::geometry::PointCloud lpcd = tpcd.ToLegacy();
     lpcd.OrientNormalsConsistentTangentPlane(k, lambda, cos_alpha_tol);
 
+    const core::Dtype normals_dtype = GetPointNormals().GetDtype();
     SetPointNormals(core::eigen_converter::EigenVector3dVectorToTensor(
             lpcd.normals_, GetPointPositions().GetDtype(), GetDevice()));
+    if (IsHalfPrecision(normals_dtype)) {
+        SetPointNormals(GetPointNormals().To(normals_dtype));
+    }
 }
 
 void PointCloud::EstimateColorGradients(
@@ -1069,12 +1116,13 @@ open3d::geometry::PointCloud PointCloud::ToLegacy() const {
                     1.0 /
                     static_cast<double>(std::numeric_limits<uint16_t>::max());
         } else if (point_color_dtype != core::Float32 &&
-                   point_color_dtype != core::Float64) {
+                   point_color_dtype != core::Float64 &&
+                   !IsHalfPrecision(point_color_dtype)) {
             utility::LogWarning(
                     "Dtype {} of color attribute is not supported for "
                     "conversion to LegacyPointCloud and will be skipped. "
-                    "Supported dtypes include UInt8, UIn16, Float32, and "
-                    "Float64",
+                    "Supported dtypes include UInt8, UIn16, Float16, "
+                    "BFloat16, Float32, and Float64",
                     point_color_dtype.ToString());
             dtype_is_supported_for_conversion = false;
         }
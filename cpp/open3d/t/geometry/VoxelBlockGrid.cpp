@@ -14,6 +14,7 @@
 #include "open3d/t/geometry/kernel/VoxelBlockGrid.h"
 #include "open3d/t/io/NumpyIO.h"
 #include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Profiler.h"
 
 namespace open3d {
 namespace t {
@@ -298,6 +299,7 @@ void VoxelBlockGrid::Integrate(const core::Tensor &block_coords,
                                float depth_scale,
                                float depth_max,
                                float trunc_voxel_multiplier) {
+    OPEN3D_PROFILE_SCOPE("t::geometry::VoxelBlockGrid::Integrate");
     AssertInitialized();
     bool integrate_color = color.AsTensor().NumElements() > 0;
 
@@ -337,19 +339,63 @@ TensorMap VoxelBlockGrid::RayCast(const core::Tensor &block_coords,
                                   float weight_threshold,
                                   float trunc_voxel_multiplier,
                                   int range_map_down_factor) {
+    OPEN3D_PROFILE_SCOPE("t::geometry::VoxelBlockGrid::RayCast");
+    return RayCastImpl(block_hashmap_, fragment_buffer_, block_coords,
+                       intrinsic, extrinsic, width, height, attrs, depth_scale,
+                       depth_min, depth_max, weight_threshold,
+                       trunc_voxel_multiplier, range_map_down_factor);
+}
+
+TensorMap VoxelBlockGrid::RayCast(const core::HashMap &snapshot,
+                                  const core::Tensor &block_coords,
+                                  const core::Tensor &intrinsic,
+                                  const core::Tensor &extrinsic,
+                                  int width,
+                                  int height,
+                                  const std::vector<std::string> attrs,
+                                  float depth_scale,
+                                  float depth_min,
+                                  float depth_max,
+                                  float weight_threshold,
+                                  float trunc_voxel_multiplier,
+                                  int range_map_down_factor) const {
+    OPEN3D_PROFILE_SCOPE("t::geometry::VoxelBlockGrid::RayCast");
+    // The shared fragment buffer may be in use by the integrating thread.
+    core::Tensor fragment_buffer;
+    return RayCastImpl(std::make_shared<core::HashMap>(snapshot),
+                       fragment_buffer, block_coords, intrinsic, extrinsic,
+                       width, height, attrs, depth_scale, depth_min, depth_max,
+                       weight_threshold, trunc_voxel_multiplier,
+                       range_map_down_factor);
+}
+
+TensorMap VoxelBlockGrid::RayCastImpl(std::shared_ptr<core::HashMap> hashmap,
+                                      core::Tensor &fragment_buffer,
+                                      const core::Tensor &block_coords,
+                                      const core::Tensor &intrinsic,
+                                      const core::Tensor &extrinsic,
+                                      int width,
+                                      int height,
+                                      const std::vector<std::string> &attrs,
+                                      float depth_scale,
+                                      float depth_min,
+                                      float depth_max,
+                                      float weight_threshold,
+                                      float trunc_voxel_multiplier,
+                                      int range_map_down_factor) const {
     AssertInitialized();
     CheckBlockCoorinates(block_coords);
     CheckIntrinsicTensor(intrinsic);
     CheckExtrinsicTensor(extrinsic);
 
     // Extrinsic: world to camera -> pose: camera to world
-    core::Device device = block_hashmap_->GetDevice();
+    core::Device device = hashmap->GetDevice();
 
     core::Tensor range_minmax_map;
     kernel::voxel_grid::EstimateRange(
             block_coords, range_minmax_map, intrinsic, extrinsic, height, width,
             range_map_down_factor, block_resolution_, voxel_size_, depth_min,
-            depth_max, fragment_buffer_);
+            depth_max, fragment_buffer);
 
     static const std::unordered_map<std::string, int> kAttrChannelMap = {
             // Conventional rendering
@@ -390,10 +436,9 @@ TensorMap VoxelBlockGrid::RayCast(const core::Tensor &block_coords,
                 core::Tensor({height, width, channel}, dtype, device);
     }
 
-    TensorMap block_value_map =
-            ConstructTensorMap(*block_hashmap_, name_attr_map_);
+    TensorMap block_value_map = ConstructTensorMap(*hashmap, name_attr_map_);
     kernel::voxel_grid::RayCast(
-            block_hashmap_, block_value_map, range_minmax_map, renderings_map,
+            hashmap, block_value_map, range_minmax_map, renderings_map,
             intrinsic, extrinsic, height, width, block_resolution_, voxel_size_,
             depth_scale, depth_min, depth_max, weight_threshold,
             trunc_voxel_multiplier, range_map_down_factor);
@@ -403,6 +448,7 @@ TensorMap VoxelBlockGrid::RayCast(const core::Tensor &block_coords,
 
 PointCloud VoxelBlockGrid::ExtractPointCloud(float weight_threshold,
                                              int estimated_point_number) {
+    OPEN3D_PROFILE_SCOPE("t::geometry::VoxelBlockGrid::ExtractPointCloud");
     AssertInitialized();
     core::Tensor active_buf_indices;
     block_hashmap_->GetActiveIndices(active_buf_indices);
@@ -435,6 +481,7 @@ PointCloud VoxelBlockGrid::ExtractPointCloud(float weight_threshold,
 
 TriangleMesh VoxelBlockGrid::ExtractTriangleMesh(float weight_threshold,
                                                  int estimated_vertex_number) {
+    OPEN3D_PROFILE_SCOPE("t::geometry::VoxelBlockGrid::ExtractTriangleMesh");
     AssertInitialized();
     core::Tensor active_buf_indices_i32 = block_hashmap_->GetActiveIndices();
     core::Tensor active_nb_buf_indices, active_nb_masks;
@@ -537,9 +584,10 @@ VoxelBlockGrid VoxelBlockGrid::To(const core::Device &device, bool copy) const {
                           name_attr_map_);
 }
 
-VoxelBlockGrid VoxelBlockGrid::Load(const std::string &file_name) {
+VoxelBlockGrid VoxelBlockGrid::Load(const std::string &file_name,
+                                    bool memory_map) {
     std::unordered_map<std::string, core::Tensor> tensor_map =
-            t::io::ReadNpz(file_name);
+            t::io::ReadNpz(file_name, memory_map);
 
     std::string prefix = "attr_name_";
     std::unordered_map<int, std::string> inv_attr_map;
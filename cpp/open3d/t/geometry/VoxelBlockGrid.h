@@ -127,6 +127,8 @@ public:
     /// tsdf: float, weight: uint16_t, color: uint16_t
     /// and accurate mode for differentiable rendering:
     /// tsdf/weight/color: float
+    /// and a compact mode storing half precision and computing in float:
+    /// tsdf/weight/color: float16_t (weights saturate at 2048)
     /// We assume input data are either raw:
     /// depth: uint16_t, color: uint8_t
     /// or depth/color: float.
@@ -188,6 +190,26 @@ public:
                       float trunc_voxel_multiplier = 8.0f,
                       int range_map_down_factor = 8);
 
+    /// Specific operation for TSDF volumes.
+    /// Ray casting as above, but reading the blocks from \p snapshot, taken
+    /// with GetHashMap().GetSnapshot() (CPU OpenAddressing backend). This may
+    /// run in another thread while Integrate inserts further blocks into the
+    /// grid. Voxels updated in place after the snapshot was taken may or may
+    /// not be seen.
+    TensorMap RayCast(const core::HashMap &snapshot,
+                      const core::Tensor &block_coords,
+                      const core::Tensor &intrinsic,
+                      const core::Tensor &extrinsic,
+                      int width,
+                      int height,
+                      const std::vector<std::string> attrs = {"depth", "color"},
+                      float depth_scale = 1000.0f,
+                      float depth_min = 0.1f,
+                      float depth_max = 3.0f,
+                      float weight_threshold = 3.0f,
+                      float trunc_voxel_multiplier = 8.0f,
+                      int range_map_down_factor = 8) const;
+
     /// Specific operation for TSDF volumes.
     /// Extract point cloud at isosurface points.
     /// Weight threshold is used to filter outliers. By default we use 3.0,
@@ -216,7 +238,13 @@ public:
     void Save(const std::string &file_name) const;
 
     /// Load a voxel block grid from a .npz file.
-    static VoxelBlockGrid Load(const std::string &file_name);
+    ///
+    /// \param file_name The .npz file name to read from.
+    /// \param memory_map If true, the arrays are read from the memory-mapped
+    /// file instead of copies, see t::io::ReadNpz(). The file must not be
+    /// truncated or overwritten while it is being read.
+    static VoxelBlockGrid Load(const std::string &file_name,
+                               bool memory_map = false);
 
     /// Convert the hash map to another device.
     VoxelBlockGrid To(const core::Device &device, bool copy = false) const;
@@ -224,6 +252,21 @@ public:
 private:
     void AssertInitialized() const;
 
+    TensorMap RayCastImpl(std::shared_ptr<core::HashMap> hashmap,
+                          core::Tensor &fragment_buffer,
+                          const core::Tensor &block_coords,
+                          const core::Tensor &intrinsic,
+                          const core::Tensor &extrinsic,
+                          int width,
+                          int height,
+                          const std::vector<std::string> &attrs,
+                          float depth_scale,
+                          float depth_min,
+                          float depth_max,
+                          float weight_threshold,
+                          float trunc_voxel_multiplier,
+                          int range_map_down_factor) const;
+
     VoxelBlockGrid(float voxelSize,
                    int64_t blockResolution,
                    const std::shared_ptr<core::HashMap> &blockHashmap,
@@ -37,6 +37,16 @@ using std::min;
 using std::sqrt;
 #endif
 
+/// ParallelFor options of cheap kernels with the same cost for every point.
+/// Small point clouds are processed serially and large ones in equal chunks.
+static const core::ParallelForOptions kPointwiseOptions{
+        utility::ParallelSchedule::Static, 1024, 4096};
+
+/// ParallelFor options of kernels whose cost grows with the number of
+/// neighbors of each point, which varies in radius and hybrid searches.
+static const core::ParallelForOptions kNeighborhoodOptions{
+        utility::ParallelSchedule::Dynamic, 16, 64};
+
 #if defined(__CUDACC__)
 void UnprojectCUDA
 #else
@@ -89,7 +99,8 @@ void UnprojectCPU
 
     DISPATCH_DTYPE_TO_TEMPLATE(depth.GetDtype(), [&]() {
         core::ParallelFor(
-                depth.GetDevice(), n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                depth.GetDevice(), n, kPointwiseOptions,
+                [=] OPEN3D_DEVICE(int64_t workload_idx) {
                     int64_t y = (workload_idx / cols_strided) * stride;
                     int64_t x = (workload_idx % cols_strided) * stride;
 
@@ -153,7 +164,8 @@ void GetPointMaskWithinAABBCPU
         bool* mask_ptr = mask.GetDataPtr<bool>();
 
         core::ParallelFor(
-                points.GetDevice(), n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                points.GetDevice(), n, kPointwiseOptions,
+                [=] OPEN3D_DEVICE(int64_t workload_idx) {
                     const scalar_t x = points_ptr[3 * workload_idx + 0];
                     const scalar_t y = points_ptr[3 * workload_idx + 1];
                     const scalar_t z = points_ptr[3 * workload_idx + 2];
@@ -193,7 +205,7 @@ void GetPointMaskWithinOBBCPU
         const scalar_t* half_extent_ptr = half_extent.GetDataPtr<scalar_t>();
         bool* mask_ptr = mask.GetDataPtr<bool>();
 
-        core::ParallelFor(points.GetDevice(), n,
+        core::ParallelFor(points.GetDevice(), n, kPointwiseOptions,
                           [=] OPEN3D_DEVICE(int64_t workload_idx) {
                               int64_t idx = 3 * workload_idx;
                               if (abs(core::linalg::kernel::dot_3x1(
@@ -225,7 +237,7 @@ void NormalizeNormalsCPU
     DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
         scalar_t* ptr = normals.GetDataPtr<scalar_t>();
 
-        core::ParallelFor(normals.GetDevice(), n,
+        core::ParallelFor(normals.GetDevice(), n, kPointwiseOptions,
                           [=] OPEN3D_DEVICE(int64_t workload_idx) {
                               int64_t idx = 3 * workload_idx;
                               scalar_t x = ptr[idx];
@@ -257,7 +269,7 @@ void OrientNormalsToAlignWithDirectionCPU
         scalar_t* ptr = normals.GetDataPtr<scalar_t>();
         const scalar_t* direction_ptr = direction.GetDataPtr<scalar_t>();
 
-        core::ParallelFor(normals.GetDevice(), n,
+        core::ParallelFor(normals.GetDevice(), n, kPointwiseOptions,
                           [=] OPEN3D_DEVICE(int64_t workload_idx) {
                               int64_t idx = 3 * workload_idx;
                               scalar_t* normal = ptr + idx;
@@ -295,7 +307,7 @@ void OrientNormalsTowardsCameraLocationCPU
         const scalar_t* points_ptr = points.GetDataPtr<scalar_t>();
 
         core::ParallelFor(
-                normals.GetDevice(), n,
+                normals.GetDevice(), n, kPointwiseOptions,
                 [=] OPEN3D_DEVICE(int64_t workload_idx) {
                     int64_t idx = 3 * workload_idx;
                     scalar_t* normal = normals_ptr + idx;
@@ -439,7 +451,8 @@ void ComputeBoundaryPointsCPU
         scalar_t* angles_ptr = angles.GetDataPtr<scalar_t>();
 
         core::ParallelFor(
-                points.GetDevice(), n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                points.GetDevice(), n, kNeighborhoodOptions,
+                [=] OPEN3D_DEVICE(int64_t workload_idx) {
                     scalar_t u[3], v[3];
                     GetCoordinateSystemOnPlane(normals_ptr + 3 * workload_idx,
                                                u, v);
@@ -583,7 +596,8 @@ void EstimateCovariancesUsingHybridSearchCPU
         scalar_t* covariances_ptr = covariances.GetDataPtr<scalar_t>();
 
         core::ParallelFor(
-                points.GetDevice(), n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                points.GetDevice(), n, kNeighborhoodOptions,
+                [=] OPEN3D_DEVICE(int64_t workload_idx) {
                     // NNS [Hybrid Search].
                     const int32_t neighbour_offset = max_nn * workload_idx;
                     // Count of valid correspondences per point.
@@ -632,7 +646,8 @@ void EstimateCovariancesUsingRadiusSearchCPU
         scalar_t* covariances_ptr = covariances.GetDataPtr<scalar_t>();
 
         core::ParallelFor(
-                points.GetDevice(), n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                points.GetDevice(), n, kNeighborhoodOptions,
+                [=] OPEN3D_DEVICE(int64_t workload_idx) {
                     const int32_t neighbour_offset =
                             neighbour_counts_ptr[workload_idx];
                     const int32_t neighbour_count =
@@ -987,7 +1002,7 @@ void EstimateNormalsFromCovariancesCPU
         scalar_t* normals_ptr = normals.GetDataPtr<scalar_t>();
 
         core::ParallelFor(
-                covariances.GetDevice(), n,
+                covariances.GetDevice(), n, kPointwiseOptions,
                 [=] OPEN3D_DEVICE(int64_t workload_idx) {
                     int32_t covariances_offset = 9 * workload_idx;
                     int32_t normals_offset = 3 * workload_idx;
@@ -1159,7 +1174,8 @@ void EstimateColorGradientsUsingHybridSearchCPU
         auto color_gradients_ptr = color_gradients.GetDataPtr<scalar_t>();
 
         core::ParallelFor(
-                points.GetDevice(), n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                points.GetDevice(), n, kNeighborhoodOptions,
+                [=] OPEN3D_DEVICE(int64_t workload_idx) {
                     // NNS [Hybrid Search].
                     int32_t neighbour_offset = max_nn * workload_idx;
                     // Count of valid correspondences per point.
@@ -1268,7 +1284,8 @@ void EstimateColorGradientsUsingRadiusSearchCPU
         auto color_gradients_ptr = color_gradients.GetDataPtr<scalar_t>();
 
         core::ParallelFor(
-                points.GetDevice(), n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                points.GetDevice(), n, kNeighborhoodOptions,
+                [=] OPEN3D_DEVICE(int64_t workload_idx) {
                     int32_t neighbour_offset =
                             neighbour_counts_ptr[workload_idx];
                     // Count of valid correspondences per point.
@@ -17,10 +17,23 @@ namespace geometry {
 namespace kernel {
 namespace transform {
 
+/// Half precision dtypes are storage types. The kernels transform a Float32
+/// copy, which is rounded back to the storage dtype.
+static bool IsHalfPrecision(const core::Dtype& dtype) {
+    return dtype == core::Float16 || dtype == core::BFloat16;
+}
+
 void TransformPoints(const core::Tensor& transformation, core::Tensor& points) {
     core::AssertTensorShape(points, {utility::nullopt, 3});
     core::AssertTensorShape(transformation, {4, 4});
 
+    if (IsHalfPrecision(points.GetDtype())) {
+        core::Tensor points_float = points.To(core::Float32);
+        TransformPoints(transformation, points_float);
+        points = points_float.To(points.GetDtype());
+        return;
+    }
+
     core::Tensor points_contiguous = points.Contiguous();
     core::Tensor transformation_contiguous =
             transformation.To(points.GetDevice(), points.GetDtype())
@@ -43,6 +56,13 @@ void TransformNormals(const core::Tensor& transformation,
     core::AssertTensorShape(normals, {utility::nullopt, 3});
     core::AssertTensorShape(transformation, {4, 4});
 
+    if (IsHalfPrecision(normals.GetDtype())) {
+        core::Tensor normals_float = normals.To(core::Float32);
+        TransformNormals(transformation, normals_float);
+        normals = normals_float.To(normals.GetDtype());
+        return;
+    }
+
     core::Tensor normals_contiguous = normals.Contiguous();
     core::Tensor transformation_contiguous =
             transformation.To(normals.GetDevice(), normals.GetDtype())
@@ -67,6 +87,13 @@ void RotatePoints(const core::Tensor& R,
     core::AssertTensorShape(R, {3, 3});
     core::AssertTensorShape(center, {3});
 
+    if (IsHalfPrecision(points.GetDtype())) {
+        core::Tensor points_float = points.To(core::Float32);
+        RotatePoints(R, points_float, center);
+        points = points_float.To(points.GetDtype());
+        return;
+    }
+
     core::Tensor points_contiguous = points.Contiguous();
     core::Tensor R_contiguous =
             R.To(points.GetDevice(), points.GetDtype()).Contiguous();
@@ -89,6 +116,13 @@ void RotateNormals(const core::Tensor& R, core::Tensor& normals) {
     core::AssertTensorShape(normals, {utility::nullopt, 3});
     core::AssertTensorShape(R, {3, 3});
 
+    if (IsHalfPrecision(normals.GetDtype())) {
+        core::Tensor normals_float = normals.To(core::Float32);
+        RotateNormals(R, normals_float);
+        normals = normals_float.To(normals.GetDtype());
+        return;
+    }
+
     core::Tensor normals_contiguous = normals.Contiguous();
     core::Tensor R_contiguous =
             R.To(normals.GetDevice(), normals.GetDtype()).Contiguous();
@@ -81,23 +81,33 @@ void GetVoxelCoordinatesAndFlattenedIndices(const core::Tensor& buf_indices,
     }
 }
 
+/// The tsdf values are stored as float, unless weight and color use half
+/// precision storage, in which case all the values are float16_t.
 #define DISPATCH_VALUE_DTYPE_TO_TEMPLATE(WEIGHT_DTYPE, COLOR_DTYPE, ...)    \
     [&] {                                                                   \
         if (WEIGHT_DTYPE == open3d::core::Float32 &&                        \
             COLOR_DTYPE == open3d::core::Float32) {                         \
+            using tsdf_t = float;                                           \
             using weight_t = float;                                         \
             using color_t = float;                                          \
             return __VA_ARGS__();                                           \
         } else if (WEIGHT_DTYPE == open3d::core::UInt16 &&                  \
                    COLOR_DTYPE == open3d::core::UInt16) {                   \
+            using tsdf_t = float;                                           \
             using weight_t = uint16_t;                                      \
             using color_t = uint16_t;                                       \
             return __VA_ARGS__();                                           \
+        } else if (WEIGHT_DTYPE == open3d::core::Float16 &&                 \
+                   COLOR_DTYPE == open3d::core::Float16) {                  \
+            using tsdf_t = open3d::core::float16_t;                         \
+            using weight_t = open3d::core::float16_t;                       \
+            using color_t = open3d::core::float16_t;                        \
+            return __VA_ARGS__();                                           \
         } else {                                                            \
             utility::LogError(                                              \
                     "Unsupported value data type combination. Expected "    \
-                    "(float, float) or (uint16, uint16), but received ({} " \
-                    "{}).",                                                 \
+                    "(float, float), (uint16, uint16) or (float16, "        \
+                    "float16), but received ({} {}).",                      \
                     WEIGHT_DTYPE.ToString(), COLOR_DTYPE.ToString());       \
         }                                                                   \
     }()
@@ -135,7 +145,6 @@ void Integrate(const core::Tensor& depth,
                float sdf_trunc,
                float depth_scale,
                float depth_max) {
-    using tsdf_t = float;
     core::Dtype block_weight_dtype = core::Dtype::Float32;
     core::Dtype block_color_dtype = core::Dtype::Float32;
     if (block_value_map.Contains("weight")) {
@@ -239,7 +248,6 @@ void RayCast(std::shared_ptr<core::HashMap>& hashmap,
              float weight_threshold,
              float trunc_voxel_multiplier,
              int range_map_down_factor) {
-    using tsdf_t = float;
     core::Dtype block_weight_dtype = core::Dtype::Float32;
     core::Dtype block_color_dtype = core::Dtype::Float32;
     if (block_value_map.Contains("weight")) {
@@ -291,7 +299,6 @@ void ExtractPointCloud(const core::Tensor& block_indices,
                        float voxel_size,
                        float weight_threshold,
                        int& valid_size) {
-    using tsdf_t = float;
     core::Dtype block_weight_dtype = core::Dtype::Float32;
     core::Dtype block_color_dtype = core::Dtype::Float32;
     if (block_value_map.Contains("weight")) {
@@ -343,7 +350,6 @@ void ExtractTriangleMesh(const core::Tensor& block_indices,
                          float voxel_size,
                          float weight_threshold,
                          int& vertex_count) {
-    using tsdf_t = float;
     core::Dtype block_weight_dtype = core::Dtype::Float32;
     core::Dtype block_color_dtype = core::Dtype::Float32;
     if (block_value_map.Contains("weight")) {
@@ -13,6 +13,7 @@
 #include "open3d/core/ParallelFor.h"
 #include "open3d/core/SizeVector.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/core/hashmap/CPU/OpenAddressingHashBackend.h"
 #include "open3d/core/hashmap/CPU/TBBHashBackend.h"
 #include "open3d/core/hashmap/Dispatch.h"
 #include "open3d/t/geometry/kernel/GeometryIndexer.h"
@@ -216,6 +217,10 @@ template void IntegrateCPU<uint16_t, uint8_t, float, float, float>(
 template void IntegrateCPU<float, float, float, uint16_t, uint16_t>(
         FN_ARGUMENTS);
 template void IntegrateCPU<float, float, float, float, float>(FN_ARGUMENTS);
+template void IntegrateCPU<uint16_t, uint8_t, core::float16_t, core::float16_t,
+                           core::float16_t>(FN_ARGUMENTS);
+template void IntegrateCPU<float, float, core::float16_t, core::float16_t,
+                           core::float16_t>(FN_ARGUMENTS);
 
 #undef FN_ARGUMENTS
 
@@ -230,6 +235,8 @@ template void IntegrateCPU<float, float, float, float, float>(FN_ARGUMENTS);
 
 template void RayCastCPU<float, uint16_t, uint16_t>(FN_ARGUMENTS);
 template void RayCastCPU<float, float, float>(FN_ARGUMENTS);
+template void RayCastCPU<core::float16_t, core::float16_t, core::float16_t>(
+        FN_ARGUMENTS);
 
 #undef FN_ARGUMENTS
 
@@ -243,6 +250,8 @@ template void RayCastCPU<float, float, float>(FN_ARGUMENTS);
 
 template void ExtractPointCloudCPU<float, uint16_t, uint16_t>(FN_ARGUMENTS);
 template void ExtractPointCloudCPU<float, float, float>(FN_ARGUMENTS);
+template void ExtractPointCloudCPU<core::float16_t, core::float16_t,
+                                   core::float16_t>(FN_ARGUMENTS);
 
 #undef FN_ARGUMENTS
 
@@ -258,6 +267,8 @@ template void ExtractPointCloudCPU<float, float, float>(FN_ARGUMENTS);
 
 template void ExtractTriangleMeshCPU<float, uint16_t, uint16_t>(FN_ARGUMENTS);
 template void ExtractTriangleMeshCPU<float, float, float>(FN_ARGUMENTS);
+template void ExtractTriangleMeshCPU<core::float16_t, core::float16_t,
+                                     core::float16_t>(FN_ARGUMENTS);
 
 #undef FN_ARGUMENTS
 
@@ -242,6 +242,10 @@ template void IntegrateCUDA<uint16_t, uint8_t, float, float, float>(
 template void IntegrateCUDA<float, float, float, uint16_t, uint16_t>(
         FN_ARGUMENTS);
 template void IntegrateCUDA<float, float, float, float, float>(FN_ARGUMENTS);
+template void IntegrateCUDA<uint16_t, uint8_t, core::float16_t, core::float16_t,
+                            core::float16_t>(FN_ARGUMENTS);
+template void IntegrateCUDA<float, float, core::float16_t, core::float16_t,
+                            core::float16_t>(FN_ARGUMENTS);
 
 #undef FN_ARGUMENTS
 
@@ -256,6 +260,8 @@ template void IntegrateCUDA<float, float, float, float, float>(FN_ARGUMENTS);
 
 template void RayCastCUDA<float, uint16_t, uint16_t>(FN_ARGUMENTS);
 template void RayCastCUDA<float, float, float>(FN_ARGUMENTS);
+template void RayCastCUDA<core::float16_t, core::float16_t, core::float16_t>(
+        FN_ARGUMENTS);
 
 #undef FN_ARGUMENTS
 
@@ -269,6 +275,8 @@ template void RayCastCUDA<float, float, float>(FN_ARGUMENTS);
 
 template void ExtractPointCloudCUDA<float, uint16_t, uint16_t>(FN_ARGUMENTS);
 template void ExtractPointCloudCUDA<float, float, float>(FN_ARGUMENTS);
+template void ExtractPointCloudCUDA<core::float16_t, core::float16_t,
+                                    core::float16_t>(FN_ARGUMENTS);
 
 #undef FN_ARGUMENTS
 
@@ -299,6 +307,8 @@ void ExtractTriangleMeshCUDA(const core::Tensor &block_indices,
 
 template void ExtractTriangleMeshCUDA<float, uint16_t, uint16_t>(FN_ARGUMENTS);
 template void ExtractTriangleMeshCUDA<float, float, float>(FN_ARGUMENTS);
+template void ExtractTriangleMeshCUDA<core::float16_t, core::float16_t,
+                                      core::float16_t>(FN_ARGUMENTS);
 
 #undef FN_ARGUMENTS
 
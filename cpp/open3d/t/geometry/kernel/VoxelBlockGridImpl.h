@@ -532,6 +532,41 @@ struct MiniVecCache {
     }
 };
 
+/// Looks up the buffer index of a block for raycasting, or returns -1.
+#if defined(__CUDACC__)
+template <typename Key, typename Hash, typename Eq>
+struct RayCastBlockLookup {
+    core::InternalStdGPUHashBackend<Key, Hash, Eq> impl_;
+
+    inline index_t OPEN3D_DEVICE Find(const Key& key) const {
+        auto iter = impl_.find(key);
+        return iter == impl_.end() ? -1 : iter->second;
+    }
+};
+#else
+template <typename Key, typename Hash, typename Eq>
+struct RayCastBlockLookup {
+    std::shared_ptr<
+            tbb::concurrent_unordered_map<Key, core::buf_index_t, Hash, Eq>>
+            tbb_impl_;
+    std::shared_ptr<core::OpenAddressingHashBackend<Key, Hash, Eq>>
+            open_addressing_;
+    std::shared_ptr<core::OpenAddressingHashSnapshot<Key, Hash, Eq>>
+            snapshot_;
+
+    inline index_t Find(const Key& key) const {
+        if (open_addressing_) {
+            return static_cast<index_t>(open_addressing_->FindBufIndex(key));
+        }
+        if (snapshot_) {
+            return static_cast<index_t>(snapshot_->FindBufIndex(key));
+        }
+        auto iter = tbb_impl_->find(key);
+        return iter == tbb_impl_->end() ? -1 : iter->second;
+    }
+};
+#endif
+
 template <typename tsdf_t, typename weight_t, typename color_t>
 #if defined(__CUDACC__)
 void RayCastCUDA
@@ -567,16 +602,28 @@ void RayCastCPU
         utility::LogError(
                 "Unsupported backend: CUDA raycasting only supports STDGPU.");
     }
-    auto hashmap_impl = cuda_hashmap->GetImpl();
+    RayCastBlockLookup<Key, Hash, Eq> block_lookup{cuda_hashmap->GetImpl()};
 #else
-    auto cpu_hashmap =
-            std::dynamic_pointer_cast<core::TBBHashBackend<Key, Hash, Eq>>(
-                    device_hashmap);
-    if (cpu_hashmap == nullptr) {
+    RayCastBlockLookup<Key, Hash, Eq> block_lookup;
+    if (auto tbb_hashmap = std::dynamic_pointer_cast<
+                core::TBBHashBackend<Key, Hash, Eq>>(device_hashmap)) {
+        block_lookup.tbb_impl_ = tbb_hashmap->GetImpl();
+    } else if (auto snapshot = std::dynamic_pointer_cast<
+                       core::OpenAddressingHashSnapshot<Key, Hash, Eq>>(
+                       device_hashmap)) {
+        snapshot->CheckValid();
+        block_lookup.snapshot_ = snapshot;
+    } else {
+        block_lookup.open_addressing_ = std::dynamic_pointer_cast<
+                core::OpenAddressingHashBackend<Key, Hash, Eq>>(
+                device_hashmap);
+    }
+    if (!block_lookup.tbb_impl_ && !block_lookup.open_addressing_ &&
+        !block_lookup.snapshot_) {
         utility::LogError(
-                "Unsupported backend: CPU raycasting only supports TBB.");
+                "Unsupported backend: CPU raycasting only supports TBB and "
+                "OpenAddressing.");
     }
-    auto hashmap_impl = *cpu_hashmap->GetImpl();
 #endif
 
     core::Device device = hashmap->GetDevice();
@@ -702,9 +749,8 @@ void RayCastCPU
 
                 index_t block_buf_idx = cache.Check(key[0], key[1], key[2]);
                 if (block_buf_idx < 0) {
-                    auto iter = hashmap_impl.find(key);
-                    if (iter == hashmap_impl.end()) return -1;
-                    block_buf_idx = iter->second;
+                    block_buf_idx = block_lookup.Find(key);
+                    if (block_buf_idx < 0) return -1;
                     cache.Update(key[0], key[1], key[2], block_buf_idx);
                 }
 
@@ -729,9 +775,8 @@ void RayCastCPU
             Key key(x_b, y_b, z_b);
             index_t block_buf_idx = cache.Check(x_b, y_b, z_b);
             if (block_buf_idx < 0) {
-                auto iter = hashmap_impl.find(key);
-                if (iter == hashmap_impl.end()) return -1;
-                block_buf_idx = iter->second;
+                block_buf_idx = block_lookup.Find(key);
+                if (block_buf_idx < 0) return -1;
                 cache.Update(x_b, y_b, z_b, block_buf_idx);
             }
 
@@ -928,9 +973,8 @@ void RayCastCPU
 
             index_t block_buf_idx = cache.Check(x_b, y_b, z_b);
             if (block_buf_idx < 0) {
-                auto iter = hashmap_impl.find(key);
-                if (iter == hashmap_impl.end()) return;
-                block_buf_idx = iter->second;
+                block_buf_idx = block_lookup.Find(key);
+                if (block_buf_idx < 0) return;
                 cache.Update(x_b, y_b, z_b, block_buf_idx);
             }
 
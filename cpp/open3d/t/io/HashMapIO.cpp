@@ -44,9 +44,9 @@ void WriteHashMap(const std::string& file_name, const core::HashMap& hashmap) {
     WriteNpz(file_name + postfix, output);
 }
 
-core::HashMap ReadHashMap(const std::string& file_name) {
+core::HashMap ReadHashMap(const std::string& file_name, bool memory_map) {
     std::unordered_map<std::string, core::Tensor> tensor_map =
-            t::io::ReadNpz(file_name);
+            t::io::ReadNpz(file_name, memory_map);
 
     // Key
     core::Tensor keys = tensor_map.at("key");
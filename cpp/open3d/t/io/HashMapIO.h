@@ -20,7 +20,10 @@ namespace io {
 /// Return a hash map on CPU.
 ///
 /// \param filename The npz file name to read from.
-core::HashMap ReadHashMap(const std::string& filename);
+/// \param memory_map If true, the arrays are read from the memory-mapped file
+/// instead of copies, see ReadNpz(). The file must not be truncated or
+/// overwritten while it is being read.
+core::HashMap ReadHashMap(const std::string& filename, bool memory_map = false);
 
 /// Save a hash map's keys and values to a npz file at 'key' and 'value'.
 ///
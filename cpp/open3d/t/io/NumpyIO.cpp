@@ -33,6 +33,7 @@
 
 #include <zlib.h>
 
+#include <cstdio>
 #include <memory>
 #include <numeric>
 #include <regex>
@@ -46,11 +47,29 @@
 #include "open3d/core/SizeVector.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/MappedFile.h"
 
 namespace open3d {
 namespace t {
 namespace io {
 
+// 64-bit file offsets, long is 32-bit on Windows.
+static int64_t FileTell(FILE* fp) {
+#ifdef _WIN32
+    return _ftelli64(fp);
+#else
+    return static_cast<int64_t>(ftello(fp));
+#endif
+}
+
+static int FileSeek(FILE* fp, int64_t offset, int origin) {
+#ifdef _WIN32
+    return _fseeki64(fp, offset, origin);
+#else
+    return fseeko(fp, static_cast<off_t>(offset), origin);
+#endif
+}
+
 class CharVector {
 public:
     CharVector() {}
@@ -131,7 +150,7 @@ static char BigEndianChar() {
 
 static char DtypeToChar(const core::Dtype& dtype) {
     // Not all dtypes are supported.
-    // 'f': float, double, long double
+    // 'f': half, float, double, long double
     // 'i': int, char, short, long, long long
     // 'u': unsigned char, unsigned short, unsigned long, unsigned long long,
     //      unsigned int
@@ -141,6 +160,7 @@ static char DtypeToChar(const core::Dtype& dtype) {
     // '?': object
     if (dtype == core::Float32) return 'f';
     if (dtype == core::Float64) return 'f';
+    if (dtype == core::Float16) return 'f';
     if (dtype == core::Int8) return 'i';
     if (dtype == core::Int16) return 'i';
     if (dtype == core::Int32) return 'i';
@@ -357,6 +377,9 @@ static std::tuple<size_t, size_t, size_t> ParseZipFooter(FILE* fp) {
                            global_header_offset);
 }
 
+/// Alignment of the array data of npz files written by WriteNpz().
+static constexpr size_t kNpzDataAlignment = 64;
+
 static void WriteNpzOneTensor(const std::string& file_name,
                               const std::string& tensor_name,
                               const core::Tensor& tensor,
@@ -412,6 +435,15 @@ static void WriteNpzOneTensor(const std::string& file_name,
     // The ".npy" suffix will be removed when npz is read.
     std::string var_name = tensor_name + ".npy";
 
+    // Pad the local header with an extra field, such that the array data is
+    // aligned to kNpzDataAlignment bytes in the file and can be memory-mapped.
+    // The padding field needs at least 4 bytes for its id and size.
+    const size_t data_offset = global_header_offset + 30 + var_name.size() +
+                               4 + npy_header.Size();
+    const uint16_t extra_field_len = static_cast<uint16_t>(
+            4 + (kNpzDataAlignment - data_offset % kNpzDataAlignment) %
+                        kNpzDataAlignment);
+
     // Build the local header.
     CharVector local_header;
     local_header.Append("PK");                       // First part of sig
@@ -425,14 +457,18 @@ static void WriteNpzOneTensor(const std::string& file_name,
     local_header.Append<uint32_t>(nbytes);           // Compressed size
     local_header.Append<uint32_t>(nbytes);           // Uncompressed size
     local_header.Append<uint16_t>(var_name.size());  // Varaible's name length
-    local_header.Append<uint16_t>(0);                // Extra field length
+    local_header.Append<uint16_t>(extra_field_len);  // Extra field length
     local_header.Append(var_name);
+    local_header.Append<uint16_t>(0xd935);  // Alignment padding id
+    local_header.Append<uint16_t>(extra_field_len - 4);  // Padding size
+    local_header.Append(extra_field_len - 4, '\0');
 
     // Build global header.
     global_header.Append("PK");              // First part of sig
     global_header.Append<uint16_t>(0x0201);  // Second part of sig
     global_header.Append<uint16_t>(20);      // Version made by
-    global_header.Append(local_header.Begin() + 4, local_header.Begin() + 30);
+    global_header.Append(local_header.Begin() + 4, local_header.Begin() + 28);
+    global_header.Append<uint16_t>(0);  // Extra field length
     global_header.Append<uint16_t>(0);  // File comment length
     global_header.Append<uint16_t>(0);  // Disk number where file starts
     global_header.Append<uint16_t>(0);  // Internal file attributes
@@ -513,6 +549,23 @@ public:
         blob_ = std::make_shared<core::Blob>(NumBytes(), core::Device("CPU:0"));
     }
 
+    /// Refers to the array data at \p offset of a mapped file, without copy.
+    NumpyArray(const core::SizeVector& shape,
+               char type,
+               int64_t word_size,
+               bool fortran_order,
+               const std::shared_ptr<utility::MappedFile>& mapped_file,
+               size_t offset)
+        : shape_(shape),
+          type_(type),
+          word_size_(word_size),
+          fortran_order_(fortran_order) {
+        // The blob keeps the whole mapping alive.
+        blob_ = std::make_shared<core::Blob>(
+                core::Device("CPU:0"), mapped_file->GetData() + offset,
+                [mapped_file](void*) {});
+    }
+
     template <typename T>
     T* GetDataPtr() {
         return reinterpret_cast<T*>(blob_->GetDataPtr());
@@ -524,6 +577,7 @@ public:
     }
 
     core::Dtype GetDtype() const {
+        if (type_ == 'f' && word_size_ == 2) return core::Float16;
         if (type_ == 'f' && word_size_ == 4) return core::Float32;
         if (type_ == 'f' && word_size_ == 8) return core::Float64;
         if (type_ == 'i' && word_size_ == 1) return core::Int8;
@@ -588,7 +642,11 @@ private:
     bool fortran_order_;
 };
 
-static NumpyArray CreateNumpyArrayFromFile(FILE* fp) {
+// If mapped_file is not nullptr, the array refers to the mapped data when
+// possible. Otherwise, the data is read from fp.
+static NumpyArray CreateNumpyArrayFromFile(
+        FILE* fp,
+        const std::shared_ptr<utility::MappedFile>& mapped_file = nullptr) {
     if (!fp) {
         utility::LogError("Unable to open file ptr.");
     }
@@ -600,6 +658,21 @@ static NumpyArray CreateNumpyArrayFromFile(FILE* fp) {
     std::tie(shape, type, word_size, fortran_order) =
             ParseNpyHeaderFromFile(fp);
 
+    if (mapped_file && word_size > 0) {
+        // Kernels assume aligned elements, unaligned data is read instead.
+        const int64_t offset = FileTell(fp);
+        const int64_t num_bytes = shape.NumElements() * word_size;
+        if (offset >= 0 && num_bytes > 0 && offset % word_size == 0 &&
+            static_cast<size_t>(offset + num_bytes) <=
+                    mapped_file->GetByteSize()) {
+            if (FileSeek(fp, num_bytes, SEEK_CUR) != 0) {
+                utility::LogError("Failed to skip array data.");
+            }
+            return NumpyArray(shape, type, word_size, fortran_order,
+                              mapped_file, static_cast<size_t>(offset));
+        }
+    }
+
     NumpyArray arr(shape, type, word_size, fortran_order);
     size_t nread = fread(arr.GetDataPtr<char>(), 1,
                          static_cast<size_t>(arr.NumBytes()), fp);
@@ -659,13 +732,15 @@ static NumpyArray CreateNumpyArrayFromCompressedFile(
     return array;
 }
 
-core::Tensor ReadNpy(const std::string& file_name) {
+core::Tensor ReadNpy(const std::string& file_name, bool memory_map) {
     utility::filesystem::CFile cfile;
     if (!cfile.Open(file_name, "rb")) {
         utility::LogError("Failed to open file {}, error: {}.", file_name,
                           cfile.GetError());
     }
-    return CreateNumpyArrayFromFile(cfile.GetFILE()).ToTensor();
+    std::shared_ptr<utility::MappedFile> mapped_file =
+            memory_map ? utility::MappedFile::Open(file_name) : nullptr;
+    return CreateNumpyArrayFromFile(cfile.GetFILE(), mapped_file).ToTensor();
 }
 
 void WriteNpy(const std::string& file_name, const core::Tensor& tensor) {
@@ -673,7 +748,7 @@ void WriteNpy(const std::string& file_name, const core::Tensor& tensor) {
 }
 
 std::unordered_map<std::string, core::Tensor> ReadNpz(
-        const std::string& file_name) {
+        const std::string& file_name, bool memory_map) {
     utility::filesystem::CFile cfile;
     if (!cfile.Open(file_name, "rb")) {
         utility::LogError("Failed to open file {}, error: {}.", file_name,
@@ -681,6 +756,10 @@ std::unordered_map<std::string, core::Tensor> ReadNpz(
     }
     FILE* fp = cfile.GetFILE();
 
+    // All arrays share one mapping of the whole file.
+    std::shared_ptr<utility::MappedFile> mapped_file =
+            memory_map ? utility::MappedFile::Open(file_name) : nullptr;
+
     std::unordered_map<std::string, core::Tensor> tensor_map;
 
     // It's possible to check tensor_name and only one selected numpy array,
@@ -744,7 +823,8 @@ std::unordered_map<std::string, core::Tensor> ReadNpz(
                 *reinterpret_cast<uint32_t*>(&local_header[22]);
 
         if (compressed_method == 0) {
-            tensor_map[tensor_name] = CreateNumpyArrayFromFile(fp).ToTensor();
+            tensor_map[tensor_name] =
+                    CreateNumpyArrayFromFile(fp, mapped_file).ToTensor();
         } else {
             tensor_map[tensor_name] =
                     CreateNumpyArrayFromCompressedFile(fp, num_compressed_bytes,
@@ -19,7 +19,12 @@ namespace io {
 /// Read Numpy .npy file to a tensor.
 ///
 /// \param file_name The file name to read from.
-core::Tensor ReadNpy(const std::string& file_name);
+/// \param memory_map If true, the file is memory-mapped copy-on-write and the
+/// tensor refers to the mapped pages instead of a copy of the data. Pages are
+/// loaded on first access and writes to the tensor do not change the file. The
+/// file must not be truncated or overwritten while the tensor is alive. Falls
+/// back to reading the file if it cannot be mapped.
+core::Tensor ReadNpy(const std::string& file_name, bool memory_map = false);
 
 /// Save a tensor to a Numpy .npy file.
 ///
@@ -30,8 +35,11 @@ void WriteNpy(const std::string& file_name, const core::Tensor& tensor);
 /// Read Numpy .npz file to an unordered_map from string to tensor.
 ///
 /// \param file_name The file name to read from.
+/// \param memory_map If true, arrays stored without compression refer to the
+/// memory-mapped file instead of a copy of the data, see ReadNpy(). Compressed
+/// arrays are always decompressed into new tensors.
 std::unordered_map<std::string, core::Tensor> ReadNpz(
-        const std::string& file_name);
+        const std::string& file_name, bool memory_map = false);
 
 /// Save a string to tensor map as Numpy .npz file.
 ///
@@ -7,11 +7,13 @@
 
 #include "open3d/t/pipelines/odometry/RGBDOdometry.h"
 
+#include "open3d/core/ScopedArena.h"
 #include "open3d/t/geometry/PointCloud.h"
 #include "open3d/t/geometry/RGBDImage.h"
 #include "open3d/t/geometry/kernel/Image.h"
 #include "open3d/t/pipelines/kernel/RGBDOdometry.h"
 #include "open3d/t/pipelines/kernel/TransformationConverter.h"
+#include "open3d/utility/Profiler.h"
 #include "open3d/visualization/utility/DrawGeometry.h"
 
 namespace open3d {
@@ -63,6 +65,7 @@ OdometryResult RGBDOdometryMultiScale(
         const std::vector<OdometryConvergenceCriteria>& criteria,
         const Method method,
         const OdometryLossParams& params) {
+    OPEN3D_PROFILE_SCOPE("t::odometry::RGBDOdometryMultiScale");
     // TODO (wei): more device check
     const core::Device device = source.depth_.GetDevice();
     core::AssertTensorDevice(target.depth_.AsTensor(), device);
@@ -115,6 +118,7 @@ OdometryResult RGBDOdometryMultiScalePointToPlane(
         const float depth_max,
         const std::vector<OdometryConvergenceCriteria>& criteria,
         const OdometryLossParams& params) {
+    OPEN3D_PROFILE_SCOPE("t::odometry::RGBDOdometryMultiScalePointToPlane");
     int64_t n_levels = int64_t(criteria.size());
     std::vector<Tensor> source_vertex_maps(n_levels);
     std::vector<Tensor> target_vertex_maps(n_levels);
@@ -157,15 +161,29 @@ OdometryResult RGBDOdometryMultiScalePointToPlane(
     }
 
     OdometryResult result(trans, /*prev rmse*/ 0.0, /*prev fitness*/ 1.0);
+    // The cumulative transformation alternates between two buffers, as the
+    // product must not be written into one of its factors. They are allocated
+    // outside of the arenas of the iterations, as they outlive them.
+    const core::Device host("CPU:0");
+    Tensor transformation_buffers[2] = {
+            Tensor::Empty({4, 4}, core::Float64, host),
+            Tensor::Empty({4, 4}, core::Float64, host)};
+    int buffer_idx = 0;
     for (int64_t i = 0; i < n_levels; ++i) {
         for (int iter = 0; iter < criteria[i].max_iteration_; ++iter) {
+            // Residuals and linear systems of the iteration are temporaries,
+            // which are served from the arena.
+            core::ScopedArena arena(source.depth_.GetDevice());
             auto delta_result = ComputeOdometryResultPointToPlane(
                     source_vertex_maps[i], target_vertex_maps[i],
                     target_normal_maps[i], intrinsic_matrices[i],
                     result.transformation_, params.depth_outlier_trunc_,
                     params.depth_huber_delta_);
-            result.transformation_ =
-                    delta_result.transformation_.Matmul(result.transformation_);
+            Tensor& transformation = transformation_buffers[buffer_idx];
+            buffer_idx = 1 - buffer_idx;
+            delta_result.transformation_.Matmul(result.transformation_,
+                                                transformation);
+            result.transformation_ = transformation;
             utility::LogDebug("level {}, iter {}: rmse = {}, fitness = {}", i,
                               iter, delta_result.inlier_rmse_,
                               delta_result.fitness_);
@@ -196,6 +214,7 @@ OdometryResult RGBDOdometryMultiScaleIntensity(
         const float depth_max,
         const std::vector<OdometryConvergenceCriteria>& criteria,
         const OdometryLossParams& params) {
+    OPEN3D_PROFILE_SCOPE("t::odometry::RGBDOdometryMultiScaleIntensity");
     int64_t n_levels = int64_t(criteria.size());
     std::vector<Tensor> source_intensity(n_levels);
     std::vector<Tensor> target_intensity(n_levels);
@@ -254,16 +273,30 @@ OdometryResult RGBDOdometryMultiScaleIntensity(
 
     // Odometry
     OdometryResult result(trans, /*prev rmse*/ 0.0, /*prev fitness*/ 1.0);
+    // The cumulative transformation alternates between two buffers, as the
+    // product must not be written into one of its factors. They are allocated
+    // outside of the arenas of the iterations, as they outlive them.
+    const core::Device host("CPU:0");
+    Tensor transformation_buffers[2] = {
+            Tensor::Empty({4, 4}, core::Float64, host),
+            Tensor::Empty({4, 4}, core::Float64, host)};
+    int buffer_idx = 0;
     for (int64_t i = 0; i < n_levels; ++i) {
         for (int iter = 0; iter < criteria[i].max_iteration_; ++iter) {
+            // Residuals and linear systems of the iteration are temporaries,
+            // which are served from the arena.
+            core::ScopedArena arena(source.depth_.GetDevice());
             auto delta_result = ComputeOdometryResultIntensity(
                     source_depth[i], target_depth[i], source_intensity[i],
                     target_intensity[i], target_intensity_dx[i],
                     target_intensity_dy[i], source_vertex_maps[i],
                     intrinsic_matrices[i], result.transformation_,
                     params.depth_outlier_trunc_, params.intensity_huber_delta_);
-            result.transformation_ =
-                    delta_result.transformation_.Matmul(result.transformation_);
+            Tensor& transformation = transformation_buffers[buffer_idx];
+            buffer_idx = 1 - buffer_idx;
+            delta_result.transformation_.Matmul(result.transformation_,
+                                                transformation);
+            result.transformation_ = transformation;
             utility::LogDebug("level {}, iter {}: rmse = {}, fitness = {}", i,
                               iter, delta_result.inlier_rmse_,
                               delta_result.fitness_);
@@ -294,6 +327,7 @@ OdometryResult RGBDOdometryMultiScaleHybrid(
         const float depth_max,
         const std::vector<OdometryConvergenceCriteria>& criteria,
         const OdometryLossParams& params) {
+    OPEN3D_PROFILE_SCOPE("t::odometry::RGBDOdometryMultiScaleHybrid");
     int64_t n_levels = int64_t(criteria.size());
     std::vector<Tensor> source_intensity(n_levels);
     std::vector<Tensor> target_intensity(n_levels);
@@ -357,8 +391,19 @@ OdometryResult RGBDOdometryMultiScaleHybrid(
 
     // Odometry
     OdometryResult result(trans, /*prev rmse*/ 0.0, /*prev fitness*/ 1.0);
+    // The cumulative transformation alternates between two buffers, as the
+    // product must not be written into one of its factors. They are allocated
+    // outside of the arenas of the iterations, as they outlive them.
+    const core::Device host("CPU:0");
+    Tensor transformation_buffers[2] = {
+            Tensor::Empty({4, 4}, core::Float64, host),
+            Tensor::Empty({4, 4}, core::Float64, host)};
+    int buffer_idx = 0;
     for (int64_t i = 0; i < n_levels; ++i) {
         for (int iter = 0; iter < criteria[i].max_iteration_; ++iter) {
+            // Residuals and linear systems of the iteration are temporaries,
+            // which are served from the arena.
+            core::ScopedArena arena(source.depth_.GetDevice());
             auto delta_result = ComputeOdometryResultHybrid(
                     source_depth[i], target_depth[i], source_intensity[i],
                     target_intensity[i], target_depth_dx[i], target_depth_dy[i],
@@ -366,8 +411,11 @@ OdometryResult RGBDOdometryMultiScaleHybrid(
                     source_vertex_maps[i], intrinsic_matrices[i],
                     result.transformation_, params.depth_outlier_trunc_,
                     params.depth_huber_delta_, params.intensity_huber_delta_);
-            result.transformation_ =
-                    delta_result.transformation_.Matmul(result.transformation_);
+            Tensor& transformation = transformation_buffers[buffer_idx];
+            buffer_idx = 1 - buffer_idx;
+            delta_result.transformation_.Matmul(result.transformation_,
+                                                transformation);
+            result.transformation_ = transformation;
             utility::LogDebug("level {}, iter {}: rmse = {}, fitness = {}", i,
                               iter, delta_result.inlier_rmse_,
                               delta_result.fitness_);
@@ -397,6 +445,7 @@ OdometryResult ComputeOdometryResultPointToPlane(
         const Tensor& init_source_to_target,
         const float depth_outlier_trunc,
         const float depth_huber_delta) {
+    OPEN3D_PROFILE_SCOPE("t::odometry::ComputeOdometryResultPointToPlane");
     // Delta target_to_source on host.
     Tensor se3_delta;
     float inlier_residual;
@@ -429,6 +478,7 @@ OdometryResult ComputeOdometryResultIntensity(
         const Tensor& init_source_to_target,
         const float depth_outlier_trunc,
         const float intensity_huber_delta) {
+    OPEN3D_PROFILE_SCOPE("t::odometry::ComputeOdometryResultIntensity");
     // Delta target_to_source on host.
     Tensor se3_delta;
     float inlier_residual;
@@ -464,6 +514,7 @@ OdometryResult ComputeOdometryResultHybrid(const Tensor& source_depth,
                                            const float depth_outlier_trunc,
                                            const float depth_huber_delta,
                                            const float intensity_huber_delta) {
+    OPEN3D_PROFILE_SCOPE("t::odometry::ComputeOdometryResultHybrid");
     // Delta target_to_source on host.
     Tensor se3_delta;
     float inlier_residual;
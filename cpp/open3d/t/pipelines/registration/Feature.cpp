@@ -94,7 +94,17 @@ core::Tensor ComputeFPFHFeature(const geometry::PointCloud &input,
 core::Tensor CorrespondencesFromFeatures(const core::Tensor &source_features,
                                          const core::Tensor &target_features,
                                          bool mutual_filter,
-                                         float mutual_consistent_ratio) {
+                                         float mutual_consistent_ratio,
+                                         int approximate_ef_search) {
+    // Indices cannot be built on empty features, and errors raised within
+    // the parallel region below would terminate the process.
+    if (source_features.GetLength() == 0 || target_features.GetLength() == 0) {
+        utility::LogWarning(
+                "Empty source or target features, no correspondences found.");
+        return core::Tensor::Empty({0, 2}, core::Int64,
+                                   source_features.GetDevice());
+    }
+
     const int num_searches = mutual_filter ? 2 : 1;
 
     std::array<core::Tensor, 2> features{source_features, target_features};
@@ -108,7 +118,11 @@ core::Tensor CorrespondencesFromFeatures(const core::Tensor &source_features,
     for (int i = 0; i < num_searches; ++i) {
         core::nns::NearestNeighborSearch nns(features[1 - i],
                                              core::Dtype::Int64);
-        nns.KnnIndex();
+        if (approximate_ef_search > 0) {
+            nns.ApproximateKnnIndex(approximate_ef_search);
+        } else {
+            nns.KnnIndex();
+        }
         auto result = nns.KnnSearch(features[i], 1);
 
         corres[i] = result.first.View({-1});
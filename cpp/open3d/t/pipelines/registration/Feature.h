@@ -53,10 +53,16 @@ core::Tensor ComputeFPFHFeature(
 /// of the aforementioned correspondence set where source[i] and target[j] are
 /// mutually the nearest neighbor. If the subset size is smaller than
 /// mutual_consistency_ratio * N, return the unfiltered set.
+/// \param approximate_ef_search If positive, the nearest neighbors are
+/// searched approximately with a core::nns::HnswIndex, using this size of the
+/// candidate list. Larger values find more of the exact nearest neighbors at a
+/// lower speed. This is much faster for large feature sets. Only supported on
+/// CPU.
 core::Tensor CorrespondencesFromFeatures(const core::Tensor &source_features,
                                          const core::Tensor &target_features,
                                          bool mutual_filter = false,
-                                         float mutual_consistency_ratio = 0.1);
+                                         float mutual_consistency_ratio = 0.1,
+                                         int approximate_ef_search = 0);
 }  // namespace registration
 }  // namespace pipelines
 }  // namespace t
@@ -7,6 +7,7 @@
 
 #include "open3d/t/pipelines/registration/Registration.h"
 
+#include "open3d/core/ScopedArena.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/TensorCheck.h"
 #include "open3d/core/TensorFunction.h"
@@ -15,6 +16,7 @@
 #include "open3d/t/pipelines/kernel/Registration.h"
 #include "open3d/utility/Helper.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Profiler.h"
 
 namespace open3d {
 namespace t {
@@ -26,6 +28,7 @@ static RegistrationResult ComputeRegistrationResult(
         const core::nns::NearestNeighborSearch &target_nns,
         const double max_correspondence_distance,
         const core::Tensor &transformation) {
+    OPEN3D_PROFILE_SCOPE("t::registration::ComputeRegistrationResult");
     core::AssertTensorShape(transformation, {4, 4});
 
     RegistrationResult result(
@@ -78,6 +81,7 @@ RegistrationResult EvaluateRegistration(const geometry::PointCloud &source,
     source_transformed.Transform(transformation);
 
     core::nns::NearestNeighborSearch target_nns(target.GetPointPositions());
+    target_nns.SetSortQueries(true);
 
     bool check = target_nns.HybridIndex(max_correspondence_distance);
     if (!check) {
@@ -189,6 +193,7 @@ InitializePointCloudPyramidForMultiScaleICP(
         const double &max_correspondence_distance,
         const TransformationEstimation &estimation,
         const int64_t &num_iterations) {
+    OPEN3D_PROFILE_SCOPE("t::registration::InitializePointCloudPyramid");
     std::vector<t::geometry::PointCloud> source_down_pyramid(num_iterations);
     std::vector<t::geometry::PointCloud> target_down_pyramid(num_iterations);
 
@@ -252,31 +257,53 @@ static std::tuple<RegistrationResult, int> DoSingleScaleICPIterations(
     double prev_fitness = current_result.fitness_;
     double prev_inlier_rmse = current_result.inlier_rmse_;
     int iteration_count = 0;
+
+    // The cumulative transformation alternates between two buffers, as the
+    // product must not be written into one of its factors. They are allocated
+    // outside of the arenas of the iterations, as they outlive them.
+    core::Tensor transformation_buffers[2] = {
+            core::Tensor::Empty({4, 4}, core::Float64,
+                                current_result.transformation_.GetDevice()),
+            core::Tensor::Empty({4, 4}, core::Float64,
+                                current_result.transformation_.GetDevice())};
+    bool no_correspondences = false;
     for (iteration_count = 0; iteration_count < criteria.max_iteration_;
          ++iteration_count) {
-        result = ComputeRegistrationResult(
-                source.GetPointPositions(), target_nns,
-                max_correspondence_distance, result.transformation_);
-
-        if (result.fitness_ <= std::numeric_limits<double>::min()) {
-            return std::make_tuple(result,
-                                   prev_iteration_count + iteration_count);
+        OPEN3D_PROFILE_SCOPE("t::registration::ICPIteration");
+        {
+            // Correspondences, residuals and linear systems of the iteration
+            // are temporaries, which are served from the arena.
+            core::ScopedArena arena(device);
+            result = ComputeRegistrationResult(
+                    source.GetPointPositions(), target_nns,
+                    max_correspondence_distance, result.transformation_);
+
+            if (result.fitness_ <= std::numeric_limits<double>::min()) {
+                no_correspondences = true;
+            } else {
+                // Computing Transform between source and target, given
+                // correspondences. ComputeTransformation returns {4,4} shaped
+                // Float64 transformation tensor on CPU device.
+                core::Tensor update =
+                        estimation
+                                .ComputeTransformation(source, target,
+                                                       result.correspondences_)
+                                .To(core::Float64);
+
+                // Multiply the transform to the cumulative transformation
+                // (update).
+                core::Tensor &transformation =
+                        transformation_buffers[iteration_count % 2];
+                update.Matmul(result.transformation_, transformation);
+                result.transformation_ = transformation;
+
+                // Apply the transform on source pointcloud.
+                source.Transform(update);
+            }
+        }
+        if (no_correspondences) {
+            break;
         }
-
-        // Computing Transform between source and target, given
-        // correspondences. ComputeTransformation returns {4,4} shaped
-        // Float64 transformation tensor on CPU device.
-        core::Tensor update =
-                estimation
-                        .ComputeTransformation(source, target,
-                                               result.correspondences_)
-                        .To(core::Float64);
-
-        // Multiply the transform to the cumulative transformation (update).
-        result.transformation_ = update.Matmul(result.transformation_);
-
-        // Apply the transform on source pointcloud.
-        source.Transform(update);
 
         utility::LogDebug(
                 "ICP Scale #{:d} Iteration #{:d}: Fitness {:.4f}, RMSE "
@@ -297,7 +324,8 @@ static std::tuple<RegistrationResult, int> DoSingleScaleICPIterations(
                     {"inlier_rmse",
                      core::Tensor::Init<double>(result.inlier_rmse_)},
                     {"fitness", core::Tensor::Init<double>(result.fitness_)},
-                    {"transformation", result.transformation_.To(host)}};
+                    {"transformation",
+                     result.transformation_.To(host, /*copy=*/true)}};
             callback_after_iteration(loss_attribute_map);
         }
 
@@ -312,6 +340,9 @@ static std::tuple<RegistrationResult, int> DoSingleScaleICPIterations(
         prev_fitness = result.fitness_;
         prev_inlier_rmse = result.inlier_rmse_;
     }
+
+    // Detach the correspondences from the arena of the last iteration.
+    result.correspondences_ = result.correspondences_.Clone();
     return std::make_tuple(result, prev_iteration_count + iteration_count);
 }
 
@@ -326,6 +357,7 @@ RegistrationResult MultiScaleICP(
         const std::function<
                 void(const std::unordered_map<std::string, core::Tensor> &)>
                 &callback_after_iteration) {
+    OPEN3D_PROFILE_SCOPE("t::registration::MultiScaleICP");
     core::AssertTensorDtypes(source.GetPointPositions(),
                              {core::Float64, core::Float32});
 
@@ -361,6 +393,8 @@ RegistrationResult MultiScaleICP(
         // Initialize Neighbor Search.
         core::nns::NearestNeighborSearch target_nns(
                 target_down_pyramid[scale_idx].GetPointPositions());
+        // The source points are queried in spatially coherent batches.
+        target_nns.SetSortQueries(true);
         bool check =
                 target_nns.HybridIndex(max_correspondence_distances[scale_idx]);
         if (!check) {
@@ -413,6 +447,7 @@ core::Tensor GetInformationMatrix(const geometry::PointCloud &source,
     source_transformed.Transform(transformation);
 
     core::nns::NearestNeighborSearch target_nns(target.GetPointPositions());
+    target_nns.SetSortQueries(true);
 
     target_nns.HybridIndex(max_correspondence_distance);
 
@@ -8,6 +8,7 @@
 #include "open3d/t/pipelines/slac/SLACOptimizer.h"
 
 #include "open3d/core/EigenConverter.h"
+#include "open3d/core/MemoryManagerStatistic.h"
 #include "open3d/core/TensorCheck.h"
 #include "open3d/core/nns/NearestNeighborSearch.h"
 #include "open3d/io/PointCloudIO.h"
@@ -25,6 +26,7 @@ using t::geometry::PointCloud;
 static std::vector<std::string> PreprocessPointClouds(
         const std::vector<std::string>& fnames,
         const SLACOptimizerParams& params) {
+    core::ScopedMemoryTag memory_tag("t::slac::PreprocessPointClouds");
     std::string subdir_name = params.GetSubfolderName();
     if (!subdir_name.empty()) {
         utility::filesystem::MakeDirectory(subdir_name);
@@ -210,6 +212,7 @@ void SaveCorrespondencesForPointClouds(
         const PoseGraph& pose_graph,
         const SLACOptimizerParams& params,
         const SLACDebugOption& debug_option) {
+    core::ScopedMemoryTag memory_tag("t::slac::Correspondences");
     // Enumerate pose graph edges.
     for (auto& edge : pose_graph.edges_) {
         int i = edge.source_node_id_;
@@ -327,6 +330,9 @@ std::pair<PoseGraph, ControlGrid> RunSLACOptimizerForFragments(
 
     PoseGraph pose_graph_update(pose_graph);
     for (int itr = 0; itr < params.max_iterations_; ++itr) {
+        // The Hessian, the residuals and the solver workspace. Memory of the
+        // control grid hash map is tagged by core::HashMap.
+        core::ScopedMemoryTag memory_tag("t::slac::LinearSystem");
         utility::LogInfo("Iteration {}", itr);
         core::Tensor AtA = core::Tensor::Zeros({num_params, num_params},
                                                core::Float32, device);
@@ -390,6 +396,8 @@ PoseGraph RunRigidOptimizerForFragments(const std::vector<std::string>& fnames,
 
     PoseGraph pose_graph_update(pose_graph);
     for (int itr = 0; itr < params.max_iterations_; ++itr) {
+        // The Hessian, the residuals and the solver workspace.
+        core::ScopedMemoryTag memory_tag("t::slac::LinearSystem");
         utility::LogInfo("Iteration {}", itr);
         core::Tensor AtA = core::Tensor::Zeros({num_params, num_params},
                                                core::Float32, device);
@@ -14,6 +14,7 @@
 #include "open3d/t/geometry/VoxelBlockGrid.h"
 #include "open3d/t/pipelines/odometry/RGBDOdometry.h"
 #include "open3d/t/pipelines/slam/Frame.h"
+#include "open3d/utility/Profiler.h"
 
 namespace open3d {
 namespace t {
@@ -42,6 +43,7 @@ void Model::SynthesizeModelFrame(Frame& raycast_frame,
                                  float trunc_voxel_multiplier,
                                  bool enable_color,
                                  float weight_threshold) {
+    OPEN3D_PROFILE_SCOPE("t::slam::Model::SynthesizeModelFrame");
     if (weight_threshold < 0) {
         weight_threshold = std::min(frame_id_ * 1.0f, 3.0f);
     }
@@ -73,6 +75,7 @@ odometry::OdometryResult Model::TrackFrameToModel(
         float depth_diff,
         const odometry::Method method,
         const std::vector<odometry::OdometryConvergenceCriteria>& criteria) {
+    OPEN3D_PROFILE_SCOPE("t::slam::Model::TrackFrameToModel");
     // TODO: Expose init_source_to_target as param, and make the input sequence
     // consistent with RGBDOdometryMultiScale.
     const static core::Tensor init_source_to_target =
@@ -92,6 +95,7 @@ void Model::Integrate(const Frame& input_frame,
                       float depth_scale,
                       float depth_max,
                       float trunc_voxel_multiplier) {
+    OPEN3D_PROFILE_SCOPE("t::slam::Model::Integrate");
     t::geometry::Image depth = input_frame.GetDataAsImage("depth");
     t::geometry::Image color = input_frame.GetDataAsImage("color");
     core::Tensor intrinsic = input_frame.GetIntrinsics();
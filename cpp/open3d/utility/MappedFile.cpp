@@ -0,0 +1,79 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include "open3d/utility/MappedFile.h"
+
+#include "open3d/utility/Logging.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace open3d {
+namespace utility {
+
+std::shared_ptr<MappedFile> MappedFile::Open(const std::string& file_name) {
+    void* data = nullptr;
+    size_t byte_size = 0;
+#ifdef _WIN32
+    HANDLE file = CreateFileA(file_name.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                              nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL,
+                              nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return nullptr;
+    }
+    LARGE_INTEGER file_size;
+    if (GetFileSizeEx(file, &file_size) && file_size.QuadPart > 0) {
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_WRITECOPY, 0, 0,
+                                            nullptr);
+        if (mapping) {
+            data = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+            byte_size = static_cast<size_t>(file_size.QuadPart);
+            // The view keeps the mapping alive.
+            CloseHandle(mapping);
+        }
+    }
+    CloseHandle(file);
+#else
+    int fd = open(file_name.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return nullptr;
+    }
+    struct stat st;
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+        byte_size = static_cast<size_t>(st.st_size);
+        data = mmap(nullptr, byte_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd,
+                    0);
+        if (data == MAP_FAILED) {
+            data = nullptr;
+        }
+    }
+    // The mapping keeps the file alive.
+    close(fd);
+#endif
+    if (!data) {
+        LogDebug("Failed to memory-map file {}.", file_name);
+        return nullptr;
+    }
+    return std::shared_ptr<MappedFile>(new MappedFile(data, byte_size));
+}
+
+MappedFile::~MappedFile() {
+#ifdef _WIN32
+    UnmapViewOfFile(data_);
+#else
+    munmap(data_, byte_size_);
+#endif
+}
+
+}  // namespace utility
+}  // namespace open3d
@@ -0,0 +1,42 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace open3d {
+namespace utility {
+
+/// Copy-on-write memory mapping of a whole file. Pages are loaded on first
+/// access, writes go to private copies of the pages and never reach the file.
+class MappedFile {
+public:
+    /// Returns nullptr if the file cannot be mapped, e.g. if it is empty.
+    static std::shared_ptr<MappedFile> Open(const std::string& file_name);
+
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    char* GetData() const { return static_cast<char*>(data_); }
+
+    size_t GetByteSize() const { return byte_size_; }
+
+private:
+    MappedFile(void* data, size_t byte_size)
+        : data_(data), byte_size_(byte_size) {}
+
+    void* data_;
+    size_t byte_size_;
+};
+
+}  // namespace utility
+}  // namespace open3d
@@ -11,7 +11,15 @@
 #include <omp.h>
 #endif
 
+#include <tbb/blocked_range.h>
+#include <tbb/global_control.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_group.h>
+
+#include <algorithm>
+#include <atomic>
 #include <cstdlib>
+#include <mutex>
 #include <string>
 
 #include "open3d/utility/CPUInfo.h"
@@ -28,7 +36,14 @@ static std::string GetEnvVar(const std::string& name) {
     }
 }
 
-int EstimateMaxThreads() {
+/// The limit set with SetMaxConcurrency(), or 0 for the default.
+static std::atomic<int> g_max_concurrency(0);
+
+/// Number of scheduler tasks the current thread is running. Tasks nest when a
+/// thread waiting for a nested parallel loop picks up other pending tasks.
+static thread_local int g_task_depth = 0;
+
+static int DefaultMaxConcurrency() {
 #ifdef _OPENMP
     if (!GetEnvVar("OMP_NUM_THREADS").empty() ||
         !GetEnvVar("OMP_DYNAMIC").empty()) {
@@ -45,8 +60,54 @@ int EstimateMaxThreads() {
 #endif
 }
 
+/// Owns the TBB global_control that limits the size of the shared thread
+/// pool. It is created on first use, so that the TBB default is kept in
+/// programs that never use the scheduler.
+class SchedulerControl {
+public:
+    static SchedulerControl& GetInstance() {
+        static SchedulerControl instance;
+        return instance;
+    }
+
+    /// Applies the current concurrency limit if it changed.
+    void Update() {
+        const int max_concurrency = GetMaxConcurrency();
+        if (applied_concurrency_.load() == max_concurrency) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (applied_concurrency_.load() == max_concurrency) {
+            return;
+        }
+        control_.reset();
+        control_ = std::make_unique<tbb::global_control>(
+                tbb::global_control::max_allowed_parallelism,
+                static_cast<size_t>(max_concurrency));
+        applied_concurrency_.store(max_concurrency);
+    }
+
+private:
+    SchedulerControl() = default;
+
+    std::mutex mutex_;
+    std::unique_ptr<tbb::global_control> control_;
+    std::atomic<int> applied_concurrency_{0};
+};
+
+/// Marks the current thread as running a scheduler task.
+class TaskScope {
+public:
+    TaskScope() { ++g_task_depth; }
+    ~TaskScope() { --g_task_depth; }
+};
+
+int EstimateMaxThreads() { return GetMaxConcurrency(); }
+
 bool InParallel() {
-    // TODO: when we add TBB/Parallel STL support to ParallelFor, update this.
+    if (g_task_depth > 0) {
+        return true;
+    }
 #ifdef _OPENMP
     return omp_in_parallel();
 #else
@@ -54,5 +115,80 @@ bool InParallel() {
 #endif
 }
 
+void SetMaxConcurrency(int max_concurrency) {
+    g_max_concurrency.store(std::max(max_concurrency, 0));
+    SchedulerControl::GetInstance().Update();
+}
+
+int GetMaxConcurrency() {
+    const int max_concurrency = g_max_concurrency.load();
+    return max_concurrency > 0 ? max_concurrency : DefaultMaxConcurrency();
+}
+
+void ParallelForRange(int64_t begin,
+                      int64_t end,
+                      int64_t grain_size,
+                      const std::function<void(int64_t, int64_t)>& func,
+                      ParallelSchedule schedule) {
+    if (begin >= end) {
+        return;
+    }
+    grain_size = std::max<int64_t>(grain_size, 1);
+    bool in_omp_parallel = false;
+#ifdef _OPENMP
+    in_omp_parallel = omp_in_parallel();
+#endif
+    // OpenMP threads are not part of the scheduler's pool, running nested
+    // tasks from them would oversubscribe the cores.
+    if (end - begin <= grain_size || in_omp_parallel ||
+        GetMaxConcurrency() == 1) {
+        func(begin, end);
+        return;
+    }
+
+    SchedulerControl::GetInstance().Update();
+    const tbb::blocked_range<int64_t> range(begin, end, grain_size);
+    auto body = [&func](const tbb::blocked_range<int64_t>& sub_range) {
+        TaskScope scope;
+        func(sub_range.begin(), sub_range.end());
+    };
+    switch (schedule) {
+        case ParallelSchedule::Static:
+            tbb::parallel_for(range, body, tbb::static_partitioner());
+            break;
+        case ParallelSchedule::Dynamic:
+            tbb::parallel_for(range, body, tbb::simple_partitioner());
+            break;
+        case ParallelSchedule::Guided:
+            tbb::parallel_for(range, body, tbb::auto_partitioner());
+            break;
+    }
+}
+
+struct TaskGroup::Impl {
+    tbb::task_group group_;
+};
+
+TaskGroup::TaskGroup() : impl_(std::make_unique<Impl>()) {
+    SchedulerControl::GetInstance().Update();
+}
+
+TaskGroup::~TaskGroup() {
+    try {
+        impl_->group_.wait();
+    } catch (...) {
+        // Exceptions are only reported by Wait().
+    }
+}
+
+void TaskGroup::Run(std::function<void()> task) {
+    impl_->group_.run([task = std::move(task)]() {
+        TaskScope scope;
+        task();
+    });
+}
+
+void TaskGroup::Wait() { impl_->group_.wait(); }
+
 }  // namespace utility
 }  // namespace open3d
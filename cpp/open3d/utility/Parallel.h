@@ -7,14 +7,107 @@
 
 #pragma once
 
+#include <cstdint>
+#include <functional>
+#include <memory>
+
 namespace open3d {
 namespace utility {
 
 /// Estimate the maximum number of threads to be used in a parallel region.
+///
+/// This is the global concurrency limit, see SetMaxConcurrency().
 int EstimateMaxThreads();
 
-/// Returns true if in an parallel section.
+/// Returns true if in an parallel section, i.e. in an OpenMP parallel region
+/// or in a task of the task scheduler (ParallelForRange() or TaskGroup).
 bool InParallel();
 
+/// Sets the global concurrency limit, i.e. the maximum number of threads
+/// used by all CPU parallel algorithms together.
+///
+/// The limit applies to the task scheduler (ParallelForRange(), TaskGroup and
+/// core::ParallelFor), to code using TBB directly and to the OpenMP parallel
+/// regions sized with EstimateMaxThreads(). A value <= 0 restores the default,
+/// which is the number of physical cores, or the OpenMP setting if the
+/// OMP_NUM_THREADS or OMP_DYNAMIC environment variables are set.
+void SetMaxConcurrency(int max_concurrency);
+
+/// Returns the global concurrency limit.
+int GetMaxConcurrency();
+
+/// Distribution of the iterations of ParallelForRange() over the threads.
+enum class ParallelSchedule {
+    /// One contiguous chunk of equal size per thread. Lowest overhead when
+    /// all iterations take the same time.
+    Static,
+    /// Chunks of grain size iterations, picked up by the threads as they
+    /// become idle. Balances irregular iterations.
+    Dynamic,
+    /// Large chunks first, which are split further on demand when other
+    /// threads run out of work.
+    Guided,
+};
+
+/// Calls \p func on disjoint sub-ranges [sub_begin, sub_end) that together
+/// cover [begin, end), in parallel on the task scheduler.
+///
+/// The scheduler uses a pool of at most GetMaxConcurrency() threads with work
+/// stealing: ranges are split recursively and idle threads steal the pending
+/// halves of busy ones, so irregular workloads are balanced and nested calls
+/// from within \p func share the same threads instead of creating new ones.
+/// Ranges are not split below \p grain_size elements, so ranges of at most
+/// \p grain_size elements are processed serially. When called from an OpenMP
+/// parallel region, \p func is called once on the whole range.
+///
+/// Exceptions thrown by \p func are rethrown in the calling thread.
+///
+/// \param begin The first index of the range.
+/// \param end The index past the last index of the range.
+/// \param grain_size The minimum size of a sub-range.
+/// \param func The function to be called, i.e.
+/// `void func(int64_t sub_begin, int64_t sub_end)`.
+/// \param schedule How the sub-ranges are distributed over the threads.
+void ParallelForRange(int64_t begin,
+                      int64_t end,
+                      int64_t grain_size,
+                      const std::function<void(int64_t, int64_t)>& func,
+                      ParallelSchedule schedule = ParallelSchedule::Guided);
+
+/// \class TaskGroup
+///
+/// \brief Runs independent tasks concurrently on the task scheduler.
+///
+/// Tasks share the thread pool of ParallelForRange() and may themselves run
+/// parallel loops, e.g. several processing pipelines can run side by side
+/// without oversubscribing the cores:
+///
+/// \code
+/// utility::TaskGroup group;
+/// for (auto& frame : frames) {
+///     group.Run([&frame]() { Process(frame); });
+/// }
+/// group.Wait();
+/// \endcode
+class TaskGroup {
+public:
+    TaskGroup();
+    /// Waits for the remaining tasks.
+    ~TaskGroup();
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+    /// Schedules \p task to run asynchronously.
+    void Run(std::function<void()> task);
+
+    /// Waits until all scheduled tasks are finished. Rethrows the first
+    /// exception thrown by a task.
+    void Wait();
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
 }  // namespace utility
 }  // namespace open3d
@@ -10,6 +10,14 @@
 #include <tbb/parallel_for.h>
 #include <tbb/parallel_scan.h>
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+#include "open3d/utility/Parallel.h"
+
 // clang-format off
 #if TBB_INTERFACE_VERSION >= 10000
     #ifdef OPEN3D_USE_ONEAPI_PACKAGES
@@ -65,6 +73,49 @@ public:
     void reverse_join(ScanSumBody& a) { sum = a.sum + sum; }
     void assign(ScanSumBody& b) { sum = b.sum; }
 };
+
+/// Maps keys to unsigned integers of the same size with the same order.
+template <class T, class Enable = void>
+struct RadixKey;
+
+template <class T>
+struct RadixKey<T, typename std::enable_if<std::is_integral<T>::value>::type> {
+    using UInt = typename std::make_unsigned<T>::type;
+    static constexpr UInt kSignBit = UInt(1) << (sizeof(T) * 8 - 1);
+
+    static UInt Encode(T key) {
+        return std::is_signed<T>::value ? UInt(key) ^ kSignBit : UInt(key);
+    }
+    static T Decode(UInt bits) {
+        return std::is_signed<T>::value ? T(bits ^ kSignBit) : T(bits);
+    }
+};
+
+template <class T>
+struct RadixKey<
+        T,
+        typename std::enable_if<std::is_floating_point<T>::value>::type> {
+    using UInt = typename std::conditional<sizeof(T) == sizeof(uint32_t),
+                                           uint32_t,
+                                           uint64_t>::type;
+    static constexpr UInt kSignBit = UInt(1) << (sizeof(T) * 8 - 1);
+
+    // Negative numbers have all bits flipped and positive numbers the sign
+    // bit, so that the order of the bits is the order of the numbers. -0 is
+    // mapped to +0.
+    static UInt Encode(T key) {
+        if (key == 0) key = 0;
+        UInt bits;
+        std::memcpy(&bits, &key, sizeof(T));
+        return (bits & kSignBit) ? ~bits : bits | kSignBit;
+    }
+    static T Decode(UInt bits) {
+        bits = (bits & kSignBit) ? bits ^ kSignBit : ~bits;
+        T key;
+        std::memcpy(&key, &bits, sizeof(T));
+        return key;
+    }
+};
 }  // namespace
 
 template <class Tin, class Tout>
@@ -84,5 +135,106 @@ void InclusivePrefixSum(const Tin* first, const Tin* last, Tout* out) {
 #endif
 }
 
+/// Sorts \p keys in ascending order and applies the same permutation to
+/// \p values, with a parallel least significant digit radix sort. The sort is
+/// stable. Passes over bytes that are equal for all keys are skipped, so small
+/// integer keys are sorted in few passes.
+///
+/// \param keys Integer or floating point keys. NaNs are sorted after +inf if
+/// their sign bit is not set.
+/// \param values Values to permute with the keys, or nullptr.
+/// \param n Number of keys.
+template <class TKey, class TValue>
+void RadixSortPairs(TKey* keys, TValue* values, size_t n) {
+    using UInt = typename RadixKey<TKey>::UInt;
+    constexpr size_t kNumBuckets = 256;
+    constexpr size_t kMinBlockSize = 1 << 14;
+    if (n < 2) {
+        return;
+    }
+
+    // Each block is histogrammed and scattered by one task, in order, which
+    // keeps the sort stable.
+    const size_t num_blocks = std::max<size_t>(
+            1, std::min<size_t>(EstimateMaxThreads() * 4, n / kMinBlockSize));
+    const size_t block_size = (n + num_blocks - 1) / num_blocks;
+    auto for_each_block = [&](const auto& func) {
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, num_blocks, 1),
+                          [&](const tbb::blocked_range<size_t>& r) {
+                              for (size_t b = r.begin(); b != r.end(); ++b) {
+                                  func(b, b * block_size,
+                                       std::min(n, (b + 1) * block_size));
+                              }
+                          });
+    };
+
+    std::vector<UInt> bits(n), bits_out(n);
+    std::vector<TValue> values_out(values ? n : 0);
+    for_each_block([&](size_t, size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            bits[i] = RadixKey<TKey>::Encode(keys[i]);
+        }
+    });
+
+    TValue* values_in = values;
+    TValue* values_tmp = values_out.data();
+    std::vector<size_t> offsets(num_blocks * kNumBuckets);
+    for (size_t shift = 0; shift < sizeof(UInt) * 8; shift += 8) {
+        std::fill(offsets.begin(), offsets.end(), 0);
+        for_each_block([&](size_t b, size_t begin, size_t end) {
+            size_t* histogram = offsets.data() + b * kNumBuckets;
+            for (size_t i = begin; i < end; ++i) {
+                ++histogram[(bits[i] >> shift) & (kNumBuckets - 1)];
+            }
+        });
+
+        // Offsets of the blocks in the output, ordered by digit, then block.
+        size_t offset = 0;
+        bool single_digit = false;
+        for (size_t d = 0; d < kNumBuckets; ++d) {
+            const size_t digit_begin = offset;
+            for (size_t b = 0; b < num_blocks; ++b) {
+                const size_t count = offsets[b * kNumBuckets + d];
+                offsets[b * kNumBuckets + d] = offset;
+                offset += count;
+            }
+            single_digit = single_digit || offset - digit_begin == n;
+        }
+        if (single_digit) {
+            continue;
+        }
+
+        for_each_block([&](size_t b, size_t begin, size_t end) {
+            size_t* block_offsets = offsets.data() + b * kNumBuckets;
+            for (size_t i = begin; i < end; ++i) {
+                const size_t dst =
+                        block_offsets[(bits[i] >> shift) & (kNumBuckets - 1)]++;
+                bits_out[dst] = bits[i];
+                if (values_in) {
+                    values_tmp[dst] = values_in[i];
+                }
+            }
+        });
+        bits.swap(bits_out);
+        std::swap(values_in, values_tmp);
+    }
+
+    for_each_block([&](size_t, size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            keys[i] = RadixKey<TKey>::Decode(bits[i]);
+        }
+        if (values_in && values_in != values) {
+            std::copy(values_in + begin, values_in + end, values + begin);
+        }
+    });
+}
+
+/// Sorts \p keys in ascending order with a parallel radix sort, see
+/// RadixSortPairs().
+template <class TKey>
+void RadixSort(TKey* keys, size_t n) {
+    RadixSortPairs<TKey, TKey>(keys, nullptr, n);
+}
+
 }  // namespace utility
 }  // namespace open3d
@@ -0,0 +1,235 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include "open3d/utility/Profiler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <map>
+#include <sstream>
+
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace utility {
+
+namespace {
+
+int64_t NowInNanoseconds() {
+    static const auto epoch = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now() - epoch)
+            .count();
+}
+
+std::string EscapeJson(const char* str) {
+    std::string escaped;
+    for (const char* c = str; *c != '\0'; ++c) {
+        if (*c == '"' || *c == '\\') {
+            escaped += '\\';
+            escaped += *c;
+        } else if (static_cast<unsigned char>(*c) < 0x20) {
+            escaped += fmt::format("\\u{:04x}", static_cast<int>(*c));
+        } else {
+            escaped += *c;
+        }
+    }
+    return escaped;
+}
+
+}  // namespace
+
+struct Profiler::ThreadBuffer {
+    int thread_id_;
+    /// Guards events_ against Reset() and GetEvents() from other threads.
+    std::mutex mutex_;
+    std::vector<Event> events_;
+};
+
+struct Profiler::ThreadState {
+    std::shared_ptr<ThreadBuffer> buffer_;
+    int depth_ = 0;
+    int64_t allocated_bytes_ = 0;
+    int64_t num_allocations_ = 0;
+};
+
+Profiler::Profiler() : enabled_(false) { NowInNanoseconds(); }
+
+Profiler& Profiler::GetInstance() {
+    static Profiler instance;
+    return instance;
+}
+
+Profiler::ThreadState& Profiler::GetThreadState() {
+    thread_local ThreadState state;
+    if (!state.buffer_) {
+        Profiler& profiler = GetInstance();
+        std::lock_guard<std::mutex> lock(profiler.buffers_mutex_);
+        state.buffer_ = std::make_shared<ThreadBuffer>();
+        state.buffer_->thread_id_ = static_cast<int>(profiler.buffers_.size());
+        profiler.buffers_.push_back(state.buffer_);
+    }
+    return state;
+}
+
+void Profiler::SetEnabled(bool enabled) {
+    enabled_.store(enabled, std::memory_order_relaxed);
+}
+
+void Profiler::Reset() {
+    std::lock_guard<std::mutex> lock(buffers_mutex_);
+    for (const auto& buffer : buffers_) {
+        std::lock_guard<std::mutex> buffer_lock(buffer->mutex_);
+        buffer->events_.clear();
+    }
+}
+
+std::vector<Profiler::Event> Profiler::GetEvents() const {
+    std::vector<Event> events;
+    std::lock_guard<std::mutex> lock(buffers_mutex_);
+    for (const auto& buffer : buffers_) {
+        std::lock_guard<std::mutex> buffer_lock(buffer->mutex_);
+        events.insert(events.end(), buffer->events_.begin(),
+                      buffer->events_.end());
+    }
+    // Events are appended when their scope ends. Sorting by start time puts
+    // parents before their children.
+    std::sort(events.begin(), events.end(),
+              [](const Event& a, const Event& b) {
+                  if (a.thread_id_ != b.thread_id_) {
+                      return a.thread_id_ < b.thread_id_;
+                  }
+                  if (a.start_ns_ != b.start_ns_) {
+                      return a.start_ns_ < b.start_ns_;
+                  }
+                  return a.depth_ < b.depth_;
+              });
+    return events;
+}
+
+std::string Profiler::ToChromeTrace() const {
+    std::ostringstream trace;
+    trace << "{\"traceEvents\":[";
+    bool first = true;
+    for (const Event& event : GetEvents()) {
+        trace << (first ? "\n" : ",\n");
+        first = false;
+        trace << fmt::format(
+                "{{\"name\":\"{}\",\"cat\":\"open3d\",\"ph\":\"X\","
+                "\"ts\":{:.3f},\"dur\":{:.3f},\"pid\":0,\"tid\":{},"
+                "\"args\":{{\"allocated_bytes\":{},\"num_allocations\":{}}}}}",
+                EscapeJson(event.name_), event.start_ns_ / 1000.0,
+                event.duration_ns_ / 1000.0, event.thread_id_,
+                event.allocated_bytes_, event.num_allocations_);
+    }
+    trace << "\n],\"displayTimeUnit\":\"ms\"}\n";
+    return trace.str();
+}
+
+bool Profiler::WriteChromeTrace(const std::string& filename) const {
+    std::ofstream file(filename);
+    if (!file.is_open()) {
+        LogWarning("Write Chrome trace failed: unable to open file: {}",
+                   filename);
+        return false;
+    }
+    file << ToChromeTrace();
+    return file.good();
+}
+
+std::string Profiler::GetSummary() const {
+    struct Stats {
+        int64_t count_ = 0;
+        int64_t total_ns_ = 0;
+        int64_t self_ns_ = 0;
+        int64_t max_ns_ = 0;
+        int64_t allocated_bytes_ = 0;
+    };
+    // Call paths are compared component-wise, so that children are listed
+    // right after their parent.
+    std::map<std::vector<std::string>, Stats> stats;
+
+    std::vector<std::vector<std::string>> stack;
+    int thread_id = -1;
+    for (const Event& event : GetEvents()) {
+        if (event.thread_id_ != thread_id) {
+            thread_id = event.thread_id_;
+            stack.clear();
+        }
+        // The parent is missing if recording started inside of it.
+        stack.resize(std::min<size_t>(stack.size(), event.depth_));
+        std::vector<std::string> path =
+                stack.empty() ? std::vector<std::string>() : stack.back();
+        path.push_back(event.name_);
+
+        Stats& s = stats[path];
+        ++s.count_;
+        s.total_ns_ += event.duration_ns_;
+        s.self_ns_ += event.duration_ns_;
+        s.max_ns_ = std::max(s.max_ns_, event.duration_ns_);
+        s.allocated_bytes_ += event.allocated_bytes_;
+        if (!stack.empty()) {
+            stats[stack.back()].self_ns_ -= event.duration_ns_;
+        }
+        stack.push_back(std::move(path));
+    }
+
+    std::string summary = fmt::format(
+            "{:<48} {:>8} {:>12} {:>12} {:>12} {:>12} {:>14}\n", "Scope",
+            "Count", "Total (ms)", "Self (ms)", "Mean (ms)", "Max (ms)",
+            "Alloc (MiB)");
+    for (const auto& it : stats) {
+        const std::vector<std::string>& path = it.first;
+        const Stats& s = it.second;
+        summary += fmt::format(
+                "{:<48} {:>8} {:>12.3f} {:>12.3f} {:>12.3f} {:>12.3f} "
+                "{:>14.3f}\n",
+                std::string(2 * (path.size() - 1), ' ') + path.back(),
+                s.count_, s.total_ns_ / 1e6, s.self_ns_ / 1e6,
+                s.total_ns_ / 1e6 / s.count_, s.max_ns_ / 1e6,
+                s.allocated_bytes_ / double(1 << 20));
+    }
+    return summary;
+}
+
+void Profiler::CountAllocation(size_t byte_size) {
+    if (GetInstance().IsEnabled()) {
+        ThreadState& state = GetThreadState();
+        state.allocated_bytes_ += static_cast<int64_t>(byte_size);
+        ++state.num_allocations_;
+    }
+}
+
+ProfilerScope::ProfilerScope(const char* name)
+    : name_(name), active_(Profiler::GetInstance().IsEnabled()) {
+    if (active_) {
+        Profiler::ThreadState& state = Profiler::GetThreadState();
+        ++state.depth_;
+        start_allocated_bytes_ = state.allocated_bytes_;
+        start_num_allocations_ = state.num_allocations_;
+        start_ns_ = NowInNanoseconds();
+    }
+}
+
+ProfilerScope::~ProfilerScope() {
+    if (active_) {
+        const int64_t end_ns = NowInNanoseconds();
+        Profiler::ThreadState& state = Profiler::GetThreadState();
+        --state.depth_;
+        Profiler::ThreadBuffer& buffer = *state.buffer_;
+        std::lock_guard<std::mutex> lock(buffer.mutex_);
+        buffer.events_.push_back(
+                {name_, buffer.thread_id_, state.depth_, start_ns_,
+                 end_ns - start_ns_,
+                 state.allocated_bytes_ - start_allocated_bytes_,
+                 state.num_allocations_ - start_num_allocations_});
+    }
+}
+
+}  // namespace utility
+}  // namespace open3d
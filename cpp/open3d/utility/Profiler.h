@@ -0,0 +1,151 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "open3d/utility/Preprocessor.h"
+
+/// OPEN3D_PROFILE_SCOPE(name)
+///
+/// Records the enclosing scope as a profiler event with the given name, which
+/// must be a string literal. The macro expands to nothing unless Open3D is
+/// built with ENABLE_PROFILER=ON, so instrumented hot paths cost nothing in
+/// regular builds.
+///
+/// OPEN3D_PROFILE_ALLOCATION(byte_size)
+///
+/// Counts an allocation of byte_size bytes in the scopes of the calling
+/// thread. Called by MemoryManager::Malloc.
+#ifdef ENABLE_PROFILER
+#define OPEN3D_PROFILE_SCOPE(name)                                  \
+    ::open3d::utility::ProfilerScope OPEN3D_CONCAT(open3d_profiler_, \
+                                                   __LINE__)(name)
+#define OPEN3D_PROFILE_ALLOCATION(byte_size) \
+    ::open3d::utility::Profiler::CountAllocation(byte_size)
+#else
+#define OPEN3D_PROFILE_SCOPE(name)
+#define OPEN3D_PROFILE_ALLOCATION(byte_size)
+#endif
+
+namespace open3d {
+namespace utility {
+
+/// \class Profiler
+///
+/// Collects nested scopes recorded by ProfilerScope, with their thread, wall
+/// time and the memory allocated while they were open. Each thread appends
+/// to its own buffer, so recording does not contend between threads.
+///
+/// Recording is off until SetEnabled(true) is called. The events can be
+/// exported as a Chrome trace (chrome://tracing or https://ui.perfetto.dev)
+/// or aggregated into a summary table.
+///
+/// Example:
+/// \code
+/// utility::Profiler::GetInstance().SetEnabled(true);
+/// {
+///     OPEN3D_PROFILE_SCOPE("Frame");
+///     RunFrame();
+/// }
+/// utility::LogInfo("{}", utility::Profiler::GetInstance().GetSummary());
+/// utility::Profiler::GetInstance().WriteChromeTrace("trace.json");
+/// \endcode
+class Profiler {
+public:
+    struct Event {
+        /// Name of the scope.
+        const char* name_;
+        /// Sequential ID of the recording thread, starting from 0.
+        int thread_id_;
+        /// Number of enclosing recorded scopes on the same thread.
+        int depth_;
+        /// Start time in nanoseconds since the profiler was created.
+        int64_t start_ns_;
+        int64_t duration_ns_;
+        /// Bytes and number of allocations, including nested scopes.
+        int64_t allocated_bytes_;
+        int64_t num_allocations_;
+    };
+
+    static Profiler& GetInstance();
+
+    Profiler(const Profiler&) = delete;
+    Profiler& operator=(const Profiler&) = delete;
+
+    /// Enables or disables recording of new scopes.
+    void SetEnabled(bool enabled);
+
+    bool IsEnabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+    /// Removes all recorded events.
+    void Reset();
+
+    /// Returns the recorded events of all threads, sorted by thread and start
+    /// time.
+    std::vector<Event> GetEvents() const;
+
+    /// Returns the recorded events in the Chrome trace event JSON format.
+    std::string ToChromeTrace() const;
+
+    /// Writes ToChromeTrace() to a file. Returns false on failure.
+    bool WriteChromeTrace(const std::string& filename) const;
+
+    /// Returns a table of the recorded scopes aggregated by their call path,
+    /// with the number of calls, total, self and maximum wall time and the
+    /// allocated memory.
+    std::string GetSummary() const;
+
+    /// Counts an allocation in the open scopes of the calling thread.
+    static void CountAllocation(size_t byte_size);
+
+private:
+    Profiler();
+
+    struct ThreadBuffer;
+    struct ThreadState;
+    static ThreadState& GetThreadState();
+
+    std::atomic<bool> enabled_;
+    mutable std::mutex buffers_mutex_;
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers_;
+
+    friend class ProfilerScope;
+};
+
+/// \class ProfilerScope
+///
+/// Records an event from its construction to its destruction if the profiler
+/// is enabled at construction. Prefer OPEN3D_PROFILE_SCOPE, which is removed
+/// at compile time unless ENABLE_PROFILER is set.
+class ProfilerScope {
+public:
+    /// \param name Name of the scope. The pointer is stored, so it must
+    /// outlive the profiler, e.g. a string literal.
+    explicit ProfilerScope(const char* name);
+    ~ProfilerScope();
+
+    ProfilerScope(const ProfilerScope&) = delete;
+    ProfilerScope& operator=(const ProfilerScope&) = delete;
+
+private:
+    const char* name_;
+    bool active_;
+    int64_t start_ns_;
+    int64_t start_allocated_bytes_;
+    int64_t start_num_allocations_;
+};
+
+}  // namespace utility
+}  // namespace open3d
@@ -964,6 +964,10 @@ Returns:
                     return py::float_(tensor.Item<float>());
                 if (dtype == core::Float64)
                     return py::float_(tensor.Item<double>());
+                if (dtype == core::Float16)
+                    return py::float_(tensor.Item<float16_t>());
+                if (dtype == core::BFloat16)
+                    return py::float_(tensor.Item<bfloat16_t>());
                 if (dtype == core::Int8) return py::int_(tensor.Item<int8_t>());
                 if (dtype == core::Int16)
                     return py::int_(tensor.Item<int16_t>());
@@ -96,7 +96,8 @@ void pybind_kdtreeflann(py::module &m) {
                      "At maximum, ``max_nn`` neighbors will be searched."},
                     {"knn", "``knn`` neighbors will be searched."},
                     {"feature", "Feature data."},
-                    {"data", "Matrix data."}};
+                    {"data", "Matrix data."},
+                    {"filename", "Path to the index file."}};
     py::class_<KDTreeFlann, std::shared_ptr<KDTreeFlann>> kdtreeflann(
             m, "KDTreeFlann", "KDTree with FLANN for nearest neighbor search.");
     kdtreeflann.def(py::init<>())
@@ -111,6 +112,18 @@ void pybind_kdtreeflann(py::module &m) {
             .def("set_feature", &KDTreeFlann::SetFeature,
                  "Sets the data for the KDTree from the feature data.",
                  "feature"_a)
+            .def_property("build_threads", &KDTreeFlann::GetBuildThreads,
+                          &KDTreeFlann::SetBuildThreads,
+                          "Number of subtrees built concurrently when the "
+                          "data is set. 1 builds the KDTree serially, values "
+                          "<= 0 use all threads.")
+            .def("save_index", &KDTreeFlann::SaveIndex,
+                 "Saves the data points and the built KDTree to a file.",
+                 "filename"_a)
+            .def("load_index", &KDTreeFlann::LoadIndex,
+                 "Loads the data points and the KDTree saved by "
+                 "``save_index`` without building the KDTree again.",
+                 "filename"_a)
             // Although these C++ style functions are fast by orders of
             // magnitudes when similar queries are performed for a large number
             // of times and memory management is involved, we prefer not to
@@ -236,6 +249,10 @@ void pybind_kdtreeflann(py::module &m) {
                         return std::make_tuple(k, indices, distance2);
                     },
                     "query"_a, "radius"_a, "max_nn"_a);
+    docstring::ClassMethodDocInject(m, "KDTreeFlann", "load_index",
+                                    map_kd_tree_flann_method_docs);
+    docstring::ClassMethodDocInject(m, "KDTreeFlann", "save_index",
+                                    map_kd_tree_flann_method_docs);
     docstring::ClassMethodDocInject(m, "KDTreeFlann", "search_hybrid_vector_3d",
                                     map_kd_tree_flann_method_docs);
     docstring::ClassMethodDocInject(m, "KDTreeFlann", "search_hybrid_vector_xd",
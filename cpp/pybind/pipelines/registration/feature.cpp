@@ -57,7 +57,7 @@ void pybind_feature_methods(py::module &m) {
     m.def("correspondences_from_features", &CorrespondencesFromFeatures,
           "Function to find nearest neighbor correspondences from features",
           "source_features"_a, "target_features"_a, "mutual_filter"_a = false,
-          "mutual_consistency_ratio"_a = 0.1f);
+          "mutual_consistency_ratio"_a = 0.1f, "approximate_ef_search"_a = 0);
     docstring::FunctionDocInject(
             m, "correspondences_from_features",
             {{"source_features", "The source features stored in (dim, N)."},
@@ -69,7 +69,11 @@ void pybind_feature_methods(py::module &m) {
              {"mutual_consistency_ratio",
               "Threshold to decide whether the number of filtered "
               "correspondences is sufficient. Only used when mutual_filter is "
-              "enabled."}});
+              "enabled."},
+             {"approximate_ef_search",
+              "If positive, search the nearest neighbors approximately with "
+              "this candidate list size. Larger values are more accurate and "
+              "slower."}});
 }
 
 }  // namespace registration
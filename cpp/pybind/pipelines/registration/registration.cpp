@@ -547,6 +547,10 @@ must hold true for all edges.)");
 // Registration functions have similar arguments, sharing arg docstrings
 static const std::unordered_map<std::string, std::string>
         map_shared_argument_docstrings = {
+                {"approximate_ef_search",
+                 "If positive, match the features with an approximate nearest "
+                 "neighbor search with this candidate list size. Larger "
+                 "values are more accurate and slower."},
                 {"checkers",
                  "Vector of Checker class to check if two point "
                  "clouds can be aligned. One of "
@@ -651,7 +655,8 @@ void pybind_registration_methods(py::module &m) {
           "ransac_n"_a = 3,
           "checkers"_a = std::vector<
                   std::reference_wrapper<const CorrespondenceChecker>>(),
-          "criteria"_a = RANSACConvergenceCriteria(100000, 0.999));
+          "criteria"_a = RANSACConvergenceCriteria(100000, 0.999),
+          "approximate_ef_search"_a = 0);
     docstring::FunctionDocInject(
             m, "registration_ransac_based_on_feature_matching",
             map_shared_argument_docstrings);
@@ -26,6 +26,8 @@ core::Dtype ArrayFormatToDtype(const std::string& format, size_t byte_size) {
         return core::Float32;
     if (format == py::format_descriptor<double>::format() && byte_size == 8)
         return core::Float64;
+    // Half precision float has the struct format character "e".
+    if (format == "e" && byte_size == 2) return core::Float16;
     if (format == py::format_descriptor<int8_t>::format() && byte_size == 1)
         return core::Int8;
     if (format == py::format_descriptor<int16_t>::format() && byte_size == 2)
@@ -62,6 +64,7 @@ core::Dtype ArrayFormatToDtype(const std::string& format, size_t byte_size) {
 std::string DtypeToArrayFormat(const core::Dtype& dtype) {
     if (dtype == core::Float32) return py::format_descriptor<float>::format();
     if (dtype == core::Float64) return py::format_descriptor<double>::format();
+    if (dtype == core::Float16) return "e";
     if (dtype == core::Int8) return py::format_descriptor<int8_t>::format();
     if (dtype == core::Int16) return py::format_descriptor<int16_t>::format();
     if (dtype == core::Int32) return py::format_descriptor<int32_t>::format();
@@ -160,7 +160,12 @@ void pybind_voxel_block_grid(py::module& m) {
             "depth_max"_a.noconvert() = 3.0f,
             "trunc_voxel_multiplier"_a.noconvert() = 8.0f);
 
-    vbg.def("ray_cast", &VoxelBlockGrid::RayCast,
+    vbg.def("ray_cast",
+            py::overload_cast<const core::Tensor&, const core::Tensor&,
+                              const core::Tensor&, int, int,
+                              const std::vector<std::string>, float, float,
+                              float, float, float, int>(
+                    &VoxelBlockGrid::RayCast),
             "Specific operation for TSDF volumes."
             "Perform volumetric ray casting in the selected block coordinates."
             "The block coordinates in the frustum can be taken from"
@@ -209,7 +214,10 @@ void pybind_voxel_block_grid(py::module& m) {
     vbg.def("save", &VoxelBlockGrid::Save,
             "Save the voxel block grid to a npz file.", "file_name"_a);
     vbg.def_static("load", &VoxelBlockGrid::Load,
-                   "Load a voxel block grid from a npz file.", "file_name"_a);
+                   "Load a voxel block grid from a npz file. If memory_map is "
+                   "True, uncompressed arrays are read from the memory-mapped "
+                   "file instead of copies.",
+                   "file_name"_a, "memory_map"_a = false);
 }
 
 }  // namespace geometry
@@ -40,7 +40,7 @@ parameter is provided, and Hybrid search (Recommended) if both are provided.)",
           py::call_guard<py::gil_scoped_release>(),
           R"(Function to query nearest neighbors of source_features in target_features.)",
           "source_features"_a, "target_features"_a, "mutual_filter"_a = false,
-          "mutual_consistency_ratio"_a = 0.1f);
+          "mutual_consistency_ratio"_a = 0.1f, "approximate_ef_search"_a = 0);
     docstring::FunctionDocInject(
             m, "correspondences_from_features",
             {{"source_features", "The source features in shape (N, dim)."},
@@ -54,7 +54,11 @@ parameter is provided, and Hybrid search (Recommended) if both are provided.)",
               "Threshold to decide whether the number of filtered "
               "correspondences is sufficient. Only used when "
               "mutual_filter is "
-              "enabled."}});
+              "enabled."},
+             {"approximate_ef_search",
+              "If positive, search the nearest neighbors approximately with "
+              "this candidate list size on CPU. Larger values are more "
+              "accurate and slower."}});
 }
 
 }  // namespace registration
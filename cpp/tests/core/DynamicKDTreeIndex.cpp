@@ -0,0 +1,157 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/nns/DynamicKDTreeIndex.h"
+
+#include <algorithm>
+#include <random>
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Dtype.h"
+#include "open3d/core/SizeVector.h"
+#include "open3d/core/Tensor.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(DynamicKDTreeIndex, SearchKnn) {
+    // The points are added in three batches, the results are the same as
+    // with a static index of all points.
+    core::Tensor dataset_points = core::Tensor::Init<double>({{0.0, 0.0, 0.0},
+                                                              {0.0, 0.0, 0.1},
+                                                              {0.0, 0.0, 0.2},
+                                                              {0.0, 0.1, 0.0},
+                                                              {0.0, 0.1, 0.1},
+                                                              {0.0, 0.1, 0.2},
+                                                              {0.0, 0.2, 0.0},
+                                                              {0.0, 0.2, 0.1},
+                                                              {0.0, 0.2, 0.2},
+                                                              {0.1, 0.0, 0.0}});
+    core::Tensor query_points =
+            core::Tensor::Init<double>({{0.064705, 0.043921, 0.087843}});
+
+    core::nns::DynamicKDTreeIndex index(dataset_points.Slice(0, 0, 2),
+                                        core::Int32);
+    EXPECT_TRUE(index.AddPoints(dataset_points.Slice(0, 2, 5))
+                        .AllEqual(core::Tensor::Init<int32_t>({2, 3, 4})));
+    index.AddPoints(dataset_points.Slice(0, 5, 10));
+    EXPECT_EQ(index.GetDatasetSize(), size_t(10));
+    EXPECT_EQ(index.GetNumActivePoints(), 10);
+
+    core::Tensor indices, distances;
+    std::tie(indices, distances) = index.SearchKnn(query_points, 3);
+    EXPECT_TRUE(indices.AllEqual(core::Tensor::Init<int32_t>({{1, 4, 9}})));
+    EXPECT_TRUE(distances.AllClose(core::Tensor::Init<double>(
+            {{0.00626358, 0.00747938, 0.0108912}})));
+
+    // Removed points are no longer found, but keep their indices.
+    index.RemovePoints(core::Tensor::Init<int64_t>({4, 4}));
+    EXPECT_EQ(index.GetNumActivePoints(), 9);
+    std::tie(indices, distances) = index.SearchKnn(query_points, 3);
+    EXPECT_TRUE(indices.AllEqual(core::Tensor::Init<int32_t>({{1, 9, 0}})));
+
+    core::Tensor counts;
+    std::tie(indices, distances, counts) =
+            index.SearchHybrid(query_points, 0.11, 3);
+    EXPECT_TRUE(indices.AllEqual(core::Tensor::Init<int32_t>({{1, 9, -1}})));
+    EXPECT_TRUE(counts.AllEqual(core::Tensor::Init<int32_t>({2})));
+
+    // knn is clamped to the number of active points.
+    index.RemovePoints(core::Tensor::Init<int32_t>({0, 1, 2, 3, 5, 6, 7}));
+    std::tie(indices, distances) = index.SearchKnn(query_points, 3);
+    EXPECT_TRUE(indices.AllEqual(core::Tensor::Init<int32_t>({{9, 8}})));
+
+    EXPECT_ANY_THROW(index.RemovePoints(core::Tensor::Init<int64_t>({10})));
+    EXPECT_ANY_THROW(index.AddPoints(query_points.To(core::Float32)));
+    EXPECT_ANY_THROW(index.SearchKnn(query_points, 0));
+}
+
+TEST(DynamicKDTreeIndex, AddRemovePoints) {
+    // Random insertions and removals, compared with a brute force search over
+    // the active points.
+    const int64_t dim = 3;
+    const int knn = 5;
+    const float radius = 0.1f;
+    std::default_random_engine rng(0);
+    std::uniform_real_distribution<float> uniform(0, 1);
+    std::vector<float> points;
+    std::vector<bool> active;
+
+    core::nns::DynamicKDTreeIndex index(core::Tensor({0, dim}, core::Float32),
+                                        core::Int64);
+    for (int step = 0; step < 20; ++step) {
+        const int64_t num_new = 1 + int64_t(uniform(rng) * 500);
+        std::vector<float> new_points(num_new * dim);
+        for (auto &v : new_points) v = uniform(rng);
+        points.insert(points.end(), new_points.begin(), new_points.end());
+        active.resize(active.size() + num_new, true);
+        index.AddPoints(
+                core::Tensor(new_points, {num_new, dim}, core::Float32));
+
+        std::vector<int64_t> removed;
+        for (size_t i = 0; i < active.size(); ++i) {
+            if (active[i] && uniform(rng) < 0.2) {
+                removed.push_back(int64_t(i));
+                active[i] = false;
+            }
+        }
+        index.RemovePoints(
+                core::Tensor(removed, {int64_t(removed.size())}, core::Int64));
+        ASSERT_EQ(index.GetNumActivePoints(),
+                  std::count(active.begin(), active.end(), true));
+    }
+
+    const int64_t num_queries = 50;
+    std::vector<float> queries(num_queries * dim);
+    for (auto &v : queries) v = uniform(rng);
+    const core::Tensor query_points(queries, {num_queries, dim},
+                                    core::Float32);
+    core::Tensor indices, distances;
+    std::tie(indices, distances) = index.SearchKnn(query_points, knn);
+    ASSERT_EQ(indices.GetShape(), core::SizeVector({num_queries, knn}));
+    core::Tensor radius_indices, radius_distances, splits;
+    std::tie(radius_indices, radius_distances, splits) =
+            index.SearchRadius(query_points, radius);
+    const std::vector<int64_t> indices_vec = indices.ToFlatVector<int64_t>();
+    const std::vector<float> distances_vec = distances.ToFlatVector<float>();
+    const std::vector<int64_t> radius_indices_vec =
+            radius_indices.ToFlatVector<int64_t>();
+    const std::vector<int64_t> splits_vec = splits.ToFlatVector<int64_t>();
+
+    for (int64_t q = 0; q < num_queries; ++q) {
+        std::vector<std::pair<float, int64_t>> gt;
+        for (size_t i = 0; i < active.size(); ++i) {
+            if (!active[i]) continue;
+            float distance = 0;
+            for (int64_t d = 0; d < dim; ++d) {
+                const float diff = points[i * dim + d] - queries[q * dim + d];
+                distance += diff * diff;
+            }
+            gt.emplace_back(distance, int64_t(i));
+        }
+        std::sort(gt.begin(), gt.end());
+        for (int k = 0; k < knn; ++k) {
+            EXPECT_EQ(indices_vec[q * knn + k], gt[k].second);
+            EXPECT_NEAR(distances_vec[q * knn + k], gt[k].first, 1e-6);
+        }
+
+        std::vector<int64_t> gt_radius;
+        for (const auto &neighbor : gt) {
+            if (neighbor.first < radius * radius) {
+                gt_radius.push_back(neighbor.second);
+            }
+        }
+        EXPECT_EQ(std::vector<int64_t>(
+                          radius_indices_vec.begin() + splits_vec[q],
+                          radius_indices_vec.begin() + splits_vec[q + 1]),
+                  gt_radius);
+    }
+}
+
+}  // namespace tests
+}  // namespace open3d
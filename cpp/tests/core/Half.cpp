@@ -0,0 +1,177 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/Half.h"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/TensorExpr.h"
+#include "tests/Tests.h"
+#include "tests/core/CoreTest.h"
+
+namespace open3d {
+namespace tests {
+
+class HalfPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(Half,
+                         HalfPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST(Half, Float16Conversion) {
+    using core::float16_t;
+    EXPECT_EQ(float16_t(0.f).bits_, 0x0000);
+    EXPECT_EQ(float16_t(-0.f).bits_, 0x8000);
+    EXPECT_EQ(float16_t(1.f).bits_, 0x3c00);
+    EXPECT_EQ(float16_t(-2.f).bits_, 0xc000);
+    EXPECT_EQ(float16_t(65504.f).bits_, 0x7bff);
+    EXPECT_EQ(float16_t(1e-7f).bits_, 0x0002);
+
+    // Round to nearest even.
+    EXPECT_EQ(float16_t(1.f + 1.f / 2048).bits_, 0x3c00);
+    EXPECT_EQ(float16_t(1.f + 3.f / 2048).bits_, 0x3c02);
+    EXPECT_EQ(float16_t(65519.f).bits_, 0x7bff);
+
+    // Overflow, infinity and NaN.
+    EXPECT_EQ(float16_t(65520.f).bits_, 0x7c00);
+    EXPECT_EQ(float16_t(-1e10f).bits_, 0xfc00);
+    EXPECT_TRUE(std::isinf(
+            float(float16_t(std::numeric_limits<float>::infinity()))));
+    EXPECT_TRUE(std::isnan(
+            float(float16_t(std::numeric_limits<float>::quiet_NaN()))));
+
+    // Every half value converts to float and back exactly.
+    for (uint32_t bits = 0; bits < 0x10000; ++bits) {
+        const float16_t h = float16_t::FromBits(static_cast<uint16_t>(bits));
+        const float f = h;
+        if (std::isnan(f)) {
+            continue;
+        }
+        EXPECT_EQ(float16_t(f).bits_, bits);
+    }
+    EXPECT_EQ(float(float16_t::FromBits(0x0001)), std::ldexp(1.f, -24));
+    EXPECT_EQ(float(std::numeric_limits<float16_t>::max()), 65504.f);
+    EXPECT_EQ(float(std::numeric_limits<float16_t>::lowest()), -65504.f);
+}
+
+TEST(Half, BFloat16Conversion) {
+    using core::bfloat16_t;
+    EXPECT_EQ(bfloat16_t(1.f).bits_, 0x3f80);
+    EXPECT_EQ(bfloat16_t(-2.f).bits_, 0xc000);
+    EXPECT_EQ(float(bfloat16_t(1e-40f)), float(bfloat16_t::FromBits(0x0001)));
+    EXPECT_EQ(bfloat16_t(std::numeric_limits<float>::max()).bits_, 0x7f80);
+
+    // Round to nearest even.
+    EXPECT_EQ(bfloat16_t(1.f + 1.f / 256).bits_, 0x3f80);
+    EXPECT_EQ(bfloat16_t(1.f + 3.f / 256).bits_, 0x3f82);
+    EXPECT_TRUE(std::isnan(
+            float(bfloat16_t(std::numeric_limits<float>::quiet_NaN()))));
+    EXPECT_TRUE(std::isinf(float(std::numeric_limits<bfloat16_t>::infinity())));
+}
+
+TEST_P(HalfPermuteDevices, To) {
+    core::Device device = GetParam();
+
+    for (core::Dtype dtype : {core::Float16, core::BFloat16}) {
+        EXPECT_EQ(dtype.ByteSize(), 2);
+        core::Tensor src = core::Tensor::Init<float>(
+                {{0.5, -1.25, 3}, {256, -0.0625, 100}}, device);
+        core::Tensor half = src.To(dtype);
+        EXPECT_EQ(half.GetDtype(), dtype);
+        EXPECT_TRUE(half.To(core::Float32).AllEqual(src));
+        EXPECT_TRUE(half.To(core::Float64).AllEqual(src.To(core::Float64)));
+        EXPECT_TRUE(half.To(core::Int32).AllEqual(src.To(core::Int32)));
+        EXPECT_TRUE(src.To(core::Int32).To(dtype).AllEqual(
+                src.To(core::Int32).To(core::Float32).To(dtype)));
+
+        // Non-contiguous conversion and indexing.
+        EXPECT_TRUE(half.T().To(core::Float32).AllEqual(src.T()));
+        core::Tensor rows = core::Tensor::Init<int64_t>({1, 0, 1}, device);
+        EXPECT_TRUE(half.IndexGet({rows}).To(core::Float32).AllEqual(
+                src.IndexGet({rows})));
+        core::Tensor cols = core::Tensor::Init<int64_t>({2, 0}, device);
+        core::Tensor selected =
+                half.GetItem({core::TensorKey::Slice(0, 2, 1),
+                              core::TensorKey::IndexTensor(cols)});
+        EXPECT_TRUE(selected.To(core::Float32)
+                            .AllEqual(src.GetItem(
+                                    {core::TensorKey::Slice(0, 2, 1),
+                                     core::TensorKey::IndexTensor(cols)})));
+
+        core::Tensor full = core::Tensor::Full({2, 2}, 1.5, dtype, device);
+        EXPECT_EQ(full.To(core::Float32).ToFlatVector<float>(),
+                  std::vector<float>(4, 1.5));
+    }
+
+    core::Tensor h = core::Tensor::Init<float>({0.1f}, device)
+                             .To(core::Float16)
+                             .Reshape({});
+    EXPECT_EQ(h.Item<core::float16_t>().bits_, core::float16_t(0.1f).bits_);
+}
+
+TEST_P(HalfPermuteDevices, ElementWise) {
+    core::Device device = GetParam();
+
+    core::Tensor a = core::Tensor::Init<float>({1.5, -2, 3.25, 100}, device);
+    core::Tensor b = core::Tensor::Init<float>({0.5, 4, -1, 3}, device);
+    for (core::Dtype dtype : {core::Float16, core::BFloat16}) {
+        core::Tensor ah = a.To(dtype);
+        core::Tensor bh = b.To(dtype);
+
+        // Computed in Float32 and rounded once.
+        auto expected = [&](const core::Tensor& t) { return t.To(dtype); };
+        EXPECT_TRUE((ah + bh).AllEqual(expected(a + b)));
+        EXPECT_TRUE((ah * bh - ah)
+                            .AllEqual(expected(
+                                    expected(a * b).To(core::Float32) - a)));
+        EXPECT_TRUE((ah / bh).AllEqual(expected(a / b)));
+        EXPECT_TRUE((ah + 1.5).AllEqual(expected(a + 1.5)));
+        EXPECT_TRUE(ah.Abs().Sqrt().AllEqual(expected(a.Abs().Sqrt())));
+        EXPECT_TRUE(ah.Neg().AllEqual(expected(a.Neg())));
+        EXPECT_TRUE(ah.Gt(bh).AllEqual(a.Gt(b)));
+        EXPECT_TRUE(ah.Le(1.5).AllEqual(a.Le(1.5)));
+        EXPECT_TRUE(ah.IsFinite().All().Item<bool>());
+        EXPECT_TRUE(ah.Clip(-1, 2).AllEqual(expected(a.Clip(-1, 2))));
+
+        core::Tensor c = ah.Clone();
+        c.Add_(bh);
+        EXPECT_TRUE(c.AllEqual(expected(a + b)));
+        EXPECT_EQ(c.GetDtype(), dtype);
+
+        // Lazy expressions on half tensors are evaluated eagerly.
+        EXPECT_TRUE(((ah.Lazy() + bh) * 2).Eval().AllEqual((ah + bh) * 2));
+    }
+
+    EXPECT_THROW(a.To(core::Float16) + a, std::runtime_error);
+}
+
+TEST_P(HalfPermuteDevices, Reduction) {
+    core::Device device = GetParam();
+
+    // A half precision accumulator would get stuck at 2048.
+    const int64_t n = 10000;
+    core::Tensor ones = core::Tensor::Ones({n}, core::Float16, device);
+    EXPECT_EQ(float(ones.Sum({0}).Item<core::float16_t>()), 10000.f);
+
+    core::Tensor a = core::Tensor::Init<float>(
+            {{1, -2, 3.5, 8}, {0.25, 6, -7, 2}}, device);
+    for (core::Dtype dtype : {core::Float16, core::BFloat16}) {
+        core::Tensor ah = a.To(dtype);
+        EXPECT_TRUE(ah.Sum({1}).AllEqual(a.Sum({1}).To(dtype)));
+        EXPECT_TRUE(ah.Mean({0}).AllEqual(a.Mean({0}).To(dtype)));
+        EXPECT_TRUE(ah.Max({0, 1}).AllEqual(a.Max({0, 1}).To(dtype)));
+        EXPECT_TRUE(ah.Min({0}, true).AllEqual(a.Min({0}, true).To(dtype)));
+        EXPECT_TRUE(ah.ArgMax({1}).AllEqual(a.ArgMax({1})));
+        EXPECT_TRUE(ah.ArgMin({0, 1}).AllEqual(a.ArgMin({0, 1})));
+        EXPECT_EQ(ah.Sum({0}).GetDtype(), dtype);
+    }
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -7,13 +7,19 @@
 
 #include "open3d/core/hashmap/HashMap.h"
 
+#include <algorithm>
+#include <atomic>
 #include <random>
+#include <thread>
+#include <tuple>
 #include <unordered_map>
+#include <vector>
 
 #include "open3d/core/Device.h"
 #include "open3d/core/Indexer.h"
 #include "open3d/core/MemoryManager.h"
 #include "open3d/core/SizeVector.h"
+#include "open3d/core/hashmap/HashMultiMap.h"
 #include "open3d/core/hashmap/HashSet.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Optional.h"
@@ -63,6 +69,7 @@ TEST_P(HashMapPermuteDevices, SimpleInit) {
         backends.push_back(core::HashBackendType::StdGPU);
     } else {
         backends.push_back(core::HashBackendType::TBB);
+        backends.push_back(core::HashBackendType::OpenAddressing);
     }
 
     for (auto backend : backends) {
@@ -93,6 +100,7 @@ TEST_P(HashMapPermuteDevices, Find) {
         backends.push_back(core::HashBackendType::StdGPU);
     } else {
         backends.push_back(core::HashBackendType::TBB);
+        backends.push_back(core::HashBackendType::OpenAddressing);
     }
 
     const int n = 1000000;
@@ -137,6 +145,7 @@ TEST_P(HashMapPermuteDevices, Insert) {
         backends.push_back(core::HashBackendType::StdGPU);
     } else {
         backends.push_back(core::HashBackendType::TBB);
+        backends.push_back(core::HashBackendType::OpenAddressing);
     }
 
     const int n = 1000000;
@@ -190,6 +199,7 @@ TEST_P(HashMapPermuteDevices, Erase) {
         backends.push_back(core::HashBackendType::StdGPU);
     } else {
         backends.push_back(core::HashBackendType::TBB);
+        backends.push_back(core::HashBackendType::OpenAddressing);
     }
 
     const int n = 1000000;
@@ -245,6 +255,260 @@ TEST_P(HashMapPermuteDevices, Erase) {
     }
 }
 
+TEST(HashMap, OpenAddressingEraseInsertCycles) {
+    const core::Device device("CPU:0");
+    const int n = 600;
+    core::HashMap hashmap(1000, core::Int32, {3}, core::Int32, {1}, device,
+                          core::HashBackendType::OpenAddressing);
+
+    // Erased slots are reused once the table is rebuilt, so the bucket count
+    // stays the same over many cycles.
+    const int64_t bucket_count = hashmap.GetBucketCount();
+    core::Tensor persistent_keys = core::Tensor::Init<int>({{-1, -2, -3}});
+    hashmap.Insert(persistent_keys, core::Tensor::Init<int>({{-1}}));
+    for (int cycle = 0; cycle < 20; ++cycle) {
+        core::Tensor keys = core::Tensor::Arange(cycle * n, (cycle + 1) * n, 1,
+                                                 core::Int32)
+                                    .Reshape({n / 3, 3});
+        core::Tensor values = core::Tensor::Zeros({n / 3, 1}, core::Int32);
+        core::Tensor buf_indices, masks;
+        hashmap.Insert(keys, values, buf_indices, masks);
+        EXPECT_TRUE(masks.All().Item<bool>());
+        EXPECT_EQ(hashmap.Size(), n / 3 + 1);
+
+        hashmap.Find(keys, buf_indices, masks);
+        EXPECT_TRUE(masks.All().Item<bool>());
+        EXPECT_TRUE(hashmap.GetKeyTensor()
+                            .IndexGet({buf_indices.To(core::Int64)})
+                            .AllEqual(keys));
+
+        masks = hashmap.Erase(keys);
+        EXPECT_TRUE(masks.All().Item<bool>());
+        EXPECT_EQ(hashmap.Size(), 1);
+    }
+    EXPECT_EQ(hashmap.GetBucketCount(), bucket_count);
+
+    core::Tensor buf_indices, masks;
+    hashmap.Find(persistent_keys, buf_indices, masks);
+    EXPECT_TRUE(masks.All().Item<bool>());
+    EXPECT_EQ(hashmap.GetActiveIndices().GetLength(), 1);
+}
+
+TEST(HashMap, OpenAddressingIncrementalGrowth) {
+    const core::Device device("CPU:0");
+    const int n = 100000;
+    const int batch = 1000;
+    core::HashMap hashmap(batch, core::Int32, {1}, core::Int32, {1}, device,
+                          core::HashBackendType::OpenAddressing);
+
+    // Growing keeps the buffer indices, so that the indices returned by
+    // earlier insertions stay valid while the table is migrated.
+    core::Tensor keys = core::Tensor::Arange(0, n, 1, core::Int32)
+                                .Reshape({n, 1});
+    core::Tensor values = keys * 2;
+    std::vector<int> all_buf_indices;
+    for (int i = 0; i < n; i += batch) {
+        core::Tensor buf_indices, masks;
+        core::Tensor batch_keys = keys.Slice(0, i, i + batch);
+        hashmap.Insert(batch_keys, values.Slice(0, i, i + batch), buf_indices,
+                       masks);
+        EXPECT_TRUE(masks.All().Item<bool>());
+        for (int buf_index : buf_indices.ToFlatVector<int>()) {
+            all_buf_indices.push_back(buf_index);
+        }
+
+        // Duplicates of keys that are not migrated yet are rejected.
+        hashmap.Insert(keys.Slice(0, 0, i + batch),
+                       values.Slice(0, 0, i + batch), buf_indices, masks);
+        EXPECT_FALSE(masks.Any().Item<bool>());
+        EXPECT_EQ(hashmap.Size(), i + batch);
+
+        hashmap.Find(keys.Slice(0, 0, i + batch), buf_indices, masks);
+        EXPECT_TRUE(masks.All().Item<bool>());
+        ASSERT_EQ(buf_indices.ToFlatVector<int>(), all_buf_indices);
+        EXPECT_EQ(hashmap.GetActiveIndices().GetLength(), i + batch);
+    }
+    EXPECT_GE(hashmap.GetCapacity(), n);
+
+    core::Tensor buf_indices(all_buf_indices, {n}, core::Int32, device);
+    EXPECT_TRUE(hashmap.GetKeyTensor()
+                        .IndexGet({buf_indices.To(core::Int64)})
+                        .AllEqual(keys));
+    EXPECT_TRUE(hashmap.GetValueTensor()
+                        .IndexGet({buf_indices.To(core::Int64)})
+                        .AllEqual(values));
+
+    // Erase every other key right after a growth, while the previous table
+    // still holds entries.
+    hashmap.Reserve(hashmap.GetCapacity() * 2);
+    core::Tensor erase_keys = core::Tensor::Arange(0, n, 2, core::Int32)
+                                      .Reshape({n / 2, 1});
+    core::Tensor masks = hashmap.Erase(erase_keys);
+    EXPECT_TRUE(masks.All().Item<bool>());
+    EXPECT_EQ(hashmap.Size(), n / 2);
+
+    core::Tensor found_indices;
+    hashmap.Find(keys, found_indices, masks);
+    std::vector<bool> found = masks.ToFlatVector<bool>();
+    for (int i = 0; i < n; ++i) {
+        ASSERT_EQ(found[i], i % 2 == 1);
+    }
+    int64_t sum = 0;
+    for (int64_t bucket_size : hashmap.BucketSizes()) {
+        sum += bucket_size;
+    }
+    EXPECT_EQ(sum, n / 2);
+}
+
+TEST(HashMap, Snapshot) {
+    const core::Device device("CPU:0");
+    core::HashMap hashmap(10, core::Int32, {1}, core::Int32, {1}, device,
+                          core::HashBackendType::OpenAddressing);
+    core::Tensor keys = core::Tensor::Init<int>({{1}, {2}, {3}});
+    hashmap.Insert(keys, keys * 10);
+
+    core::HashMap snapshot = hashmap.GetSnapshot();
+    hashmap.Insert(core::Tensor::Init<int>({{4}, {5}}),
+                   core::Tensor::Init<int>({{40}, {50}}));
+    hashmap.Reserve(1000);
+    EXPECT_EQ(hashmap.Size(), 5);
+    EXPECT_EQ(snapshot.Size(), 3);
+    EXPECT_EQ(snapshot.GetCapacity(), 10);
+    EXPECT_EQ(snapshot.GetActiveIndices().GetLength(), 3);
+
+    core::Tensor buf_indices, masks;
+    snapshot.Find(core::Tensor::Init<int>({{1}, {2}, {3}, {4}, {5}}),
+                  buf_indices, masks);
+    EXPECT_EQ(masks.ToFlatVector<bool>(),
+              std::vector<bool>({true, true, true, false, false}));
+    EXPECT_TRUE(snapshot.GetValueTensor()
+                        .IndexGet({buf_indices.Slice(0, 0, 3).To(core::Int64)})
+                        .AllEqual(keys * 10));
+
+    // Erase invalidates the snapshots taken before it.
+    core::HashMap erased_snapshot = hashmap.GetSnapshot();
+    hashmap.Erase(core::Tensor::Init<int>({{6}}));
+    EXPECT_EQ(erased_snapshot.GetActiveIndices().GetLength(), 5);
+    hashmap.Erase(core::Tensor::Init<int>({{1}}));
+    EXPECT_ANY_THROW(erased_snapshot.Find(keys, buf_indices, masks));
+    EXPECT_ANY_THROW(erased_snapshot.GetActiveIndices());
+    EXPECT_EQ(hashmap.GetSnapshot().GetActiveIndices().GetLength(), 4);
+
+    // Snapshots are read-only and only supported by OpenAddressing.
+    EXPECT_ANY_THROW(snapshot.Insert(keys, keys));
+    EXPECT_ANY_THROW(snapshot.Erase(keys));
+    core::HashMap tbb_hashmap(10, core::Int32, {1}, core::Int32, {1}, device,
+                              core::HashBackendType::TBB);
+    EXPECT_ANY_THROW(tbb_hashmap.GetSnapshot());
+}
+
+TEST(HashMap, SnapshotGrowSameSlots) {
+    const core::Device device("CPU:0");
+    const int n = 1000;
+    const int m = 20;
+    core::HashMap hashmap(n, core::Int32, {1}, core::Int32, {1}, device,
+                          core::HashBackendType::OpenAddressing);
+    core::Tensor keys = core::Tensor::Arange(0, n + m, 1, core::Int32)
+                                .Reshape({n + m, 1});
+    hashmap.Insert(keys.Slice(0, 0, n), keys.Slice(0, 0, n));
+
+    // Both capacities use the same number of slots, so the table is shared
+    // with the snapshot while the new entries get buffer indices beyond its
+    // capacity.
+    core::HashMap snapshot = hashmap.GetSnapshot();
+    const int64_t bucket_count = hashmap.GetBucketCount();
+    hashmap.Reserve(n + m);
+    EXPECT_EQ(hashmap.GetBucketCount(), bucket_count);
+    core::Tensor buf_indices, masks;
+    hashmap.Insert(keys.Slice(0, n, n + m), keys.Slice(0, n, n + m),
+                   buf_indices, masks);
+    EXPECT_TRUE(masks.All().Item<bool>());
+    EXPECT_EQ(buf_indices.To(core::Int64).Min({0}).Item<int64_t>(), n);
+
+    snapshot.Find(keys, buf_indices, masks);
+    std::vector<bool> found = masks.ToFlatVector<bool>();
+    for (int i = 0; i < n + m; ++i) {
+        ASSERT_EQ(found[i], i < n);
+    }
+    EXPECT_EQ(snapshot.GetActiveIndices().GetLength(), n);
+    EXPECT_EQ(hashmap.Size(), n + m);
+}
+
+TEST(HashMap, SnapshotConcurrentInsert) {
+    const core::Device device("CPU:0");
+    const int n = 200000;
+    const int batch = 2000;
+    const int num_readers = 3;
+    core::HashMap hashmap(batch, core::Int32, {1}, core::Int32, {1}, device,
+                          core::HashBackendType::OpenAddressing);
+    core::Tensor keys = core::Tensor::Arange(0, n, 1, core::Int32)
+                                .Reshape({n, 1});
+    core::Tensor values = keys * 3;
+
+    // The writer grows the hash map by batches of keys, while the readers
+    // check that each snapshot contains exactly the completed batches.
+    std::atomic<bool> done(false);
+    std::atomic<int> num_errors(0);
+    std::atomic<int> num_snapshots(0);
+    std::vector<std::thread> readers;
+    for (int r = 0; r < num_readers; ++r) {
+        readers.emplace_back([&]() {
+            int64_t last_size = 0;
+            do {
+                core::HashMap snapshot = hashmap.GetSnapshot();
+                const int64_t size = snapshot.Size();
+                if (size % batch != 0 || size < last_size) {
+                    num_errors++;
+                    break;
+                }
+                last_size = size;
+                if (size == 0) {
+                    continue;
+                }
+
+                // Completed batches and the next one.
+                const int64_t end = std::min<int64_t>(size + batch, n);
+                core::Tensor buf_indices, masks;
+                snapshot.Find(keys.Slice(0, 0, end), buf_indices, masks);
+                std::vector<bool> found = masks.ToFlatVector<bool>();
+                for (int64_t i = 0; i < end; ++i) {
+                    if (found[i] != (i < size)) {
+                        num_errors++;
+                        break;
+                    }
+                }
+                core::Tensor indices =
+                        buf_indices.Slice(0, 0, size).To(core::Int64);
+                if (!snapshot.GetKeyTensor()
+                             .IndexGet({indices})
+                             .AllEqual(keys.Slice(0, 0, size)) ||
+                    !snapshot.GetValueTensor()
+                             .IndexGet({indices})
+                             .AllEqual(values.Slice(0, 0, size)) ||
+                    snapshot.GetActiveIndices().GetLength() != size) {
+                    num_errors++;
+                }
+                num_snapshots++;
+            } while (!done.load());
+        });
+    }
+
+    for (int i = 0; i < n; i += batch) {
+        core::Tensor buf_indices, masks;
+        hashmap.Insert(keys.Slice(0, i, i + batch),
+                       values.Slice(0, i, i + batch), buf_indices, masks);
+        EXPECT_TRUE(masks.All().Item<bool>());
+    }
+    done.store(true);
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    EXPECT_EQ(num_errors.load(), 0);
+    EXPECT_GT(num_snapshots.load(), 0);
+    EXPECT_EQ(hashmap.GetSnapshot().Size(), n);
+}
+
 TEST_P(HashMapPermuteDevices, Reserve) {
     core::Device device = GetParam();
     std::vector<core::HashBackendType> backends;
@@ -253,6 +517,7 @@ TEST_P(HashMapPermuteDevices, Reserve) {
         backends.push_back(core::HashBackendType::StdGPU);
     } else {
         backends.push_back(core::HashBackendType::TBB);
+        backends.push_back(core::HashBackendType::OpenAddressing);
     }
 
     const int n = 1000000;
@@ -307,6 +572,7 @@ TEST_P(HashMapPermuteDevices, Clear) {
         backends.push_back(core::HashBackendType::StdGPU);
     } else {
         backends.push_back(core::HashBackendType::TBB);
+        backends.push_back(core::HashBackendType::OpenAddressing);
     }
 
     const int n = 1000000;
@@ -385,6 +651,7 @@ TEST_P(HashMapPermuteDevices, InsertComplexKeys) {
         backends.push_back(core::HashBackendType::StdGPU);
     } else {
         backends.push_back(core::HashBackendType::TBB);
+        backends.push_back(core::HashBackendType::OpenAddressing);
     }
 
     const int n = 1000000;
@@ -444,6 +711,7 @@ TEST_P(HashMapPermuteDevices, MultivalueInsertion) {
         backends.push_back(core::HashBackendType::StdGPU);
     } else {
         backends.push_back(core::HashBackendType::TBB);
+        backends.push_back(core::HashBackendType::OpenAddressing);
     }
 
     const int n = 1000000;
@@ -517,6 +785,7 @@ TEST_P(HashMapPermuteDevices, HashSet) {
         backends.push_back(core::HashBackendType::StdGPU);
     } else {
         backends.push_back(core::HashBackendType::TBB);
+        backends.push_back(core::HashBackendType::OpenAddressing);
     }
 
     const int n = 1000000;
@@ -543,6 +812,111 @@ TEST_P(HashMapPermuteDevices, HashSet) {
     }
 }
 
+TEST(HashMap, HashMultiMap) {
+    const core::Device device("CPU:0");
+    const int n = 100000;
+    const int grid = 20;
+
+    // Bucket points into voxels, storing their index and coordinates.
+    std::default_random_engine rng(0);
+    std::uniform_real_distribution<float> dist(0, grid);
+    std::vector<int> voxels(3 * n);
+    std::vector<float> points(3 * n);
+    std::unordered_map<int, std::vector<int64_t>> expected;
+    for (int i = 0; i < n; ++i) {
+        int linear = 0;
+        for (int d = 0; d < 3; ++d) {
+            points[3 * i + d] = dist(rng);
+            voxels[3 * i + d] = static_cast<int>(points[3 * i + d]);
+            linear = linear * grid + voxels[3 * i + d];
+        }
+        expected[linear].push_back(i);
+    }
+    core::Tensor keys(voxels, {n, 3}, core::Int32, device);
+    core::Tensor coords(points, {n, 3}, core::Float32, device);
+    core::Tensor indices = core::Tensor::Arange(0, n, 1, core::Int64, device);
+
+    for (auto backend : {core::HashBackendType::TBB,
+                         core::HashBackendType::OpenAddressing}) {
+        core::HashMultiMap multimap(10, core::Int32, {3},
+                                    {core::Int64, core::Float32}, {{1}, {3}},
+                                    device, 16, backend);
+
+        // Append in batches of different sizes, growing the map and the pool.
+        for (auto range : {std::make_pair(0, 1000), std::make_pair(1000, 1001),
+                           std::make_pair(1001, n)}) {
+            core::Tensor buf_indices = multimap.Append(
+                    keys.Slice(0, range.first, range.second),
+                    {indices.Slice(0, range.first, range.second),
+                     coords.Slice(0, range.first, range.second)});
+            EXPECT_EQ(buf_indices.GetLength(), range.second - range.first);
+        }
+        EXPECT_EQ(multimap.Size(), static_cast<int64_t>(expected.size()));
+        EXPECT_GE(multimap.GetNumPages(), multimap.Size());
+        EXPECT_LE(multimap.GetNumPages(), multimap.Size() + n / 16);
+
+        // Gather all voxels and an absent one.
+        std::vector<int> query_voxels;
+        std::vector<int> query_linears;
+        for (const auto& kv : expected) {
+            query_linears.push_back(kv.first);
+            query_voxels.push_back(kv.first / (grid * grid));
+            query_voxels.push_back(kv.first / grid % grid);
+            query_voxels.push_back(kv.first % grid);
+        }
+        query_voxels.insert(query_voxels.end(), {-1, -1, -1});
+        const int64_t num_queries = query_linears.size() + 1;
+        core::Tensor queries(query_voxels, {num_queries, 3}, core::Int32,
+                             device);
+
+        std::vector<core::Tensor> values;
+        core::Tensor row_splits;
+        std::tie(values, row_splits) = multimap.Gather(queries);
+        ASSERT_EQ(values.size(), 2u);
+        EXPECT_EQ(values[0].GetShape(), core::SizeVector({n, 1}));
+        EXPECT_EQ(values[1].GetShape(), core::SizeVector({n, 3}));
+        std::vector<int64_t> splits = row_splits.ToFlatVector<int64_t>();
+        std::vector<int64_t> gathered = values[0].ToFlatVector<int64_t>();
+        std::vector<float> gathered_coords = values[1].ToFlatVector<float>();
+        ASSERT_EQ(static_cast<int64_t>(splits.size()), num_queries + 1);
+        EXPECT_EQ(splits.back(), splits[num_queries - 1]);
+        core::Tensor sizes = multimap.GetListSizes(queries);
+        EXPECT_TRUE(sizes.AllEqual(row_splits.Slice(0, 1, num_queries + 1) -
+                                   row_splits.Slice(0, 0, num_queries)));
+        for (int64_t q = 0; q + 1 < num_queries; ++q) {
+            std::vector<int64_t> list(gathered.begin() + splits[q],
+                                      gathered.begin() + splits[q + 1]);
+            for (int64_t j = splits[q]; j < splits[q + 1]; ++j) {
+                for (int d = 0; d < 3; ++d) {
+                    ASSERT_EQ(gathered_coords[3 * j + d],
+                              points[3 * gathered[j] + d]);
+                }
+            }
+            std::sort(list.begin(), list.end());
+            ASSERT_EQ(list, expected[query_linears[q]]);
+        }
+
+        // Clear and reuse the pages.
+        const int64_t page_capacity = multimap.GetPageCapacity();
+        multimap.Clear();
+        EXPECT_EQ(multimap.Size(), 0);
+        EXPECT_EQ(multimap.GetNumPages(), 0);
+        multimap.Append(keys.Slice(0, 0, 100),
+                        {indices.Slice(0, 0, 100), coords.Slice(0, 0, 100)});
+        EXPECT_TRUE(multimap.GetListSizes(keys.Slice(0, 0, 1))
+                            .AllEqual(core::Tensor::Ones({1}, core::Int64)));
+        EXPECT_EQ(multimap.GetPageCapacity(), page_capacity);
+
+        EXPECT_ANY_THROW(multimap.Append(keys, indices));
+        EXPECT_ANY_THROW(multimap.Append(keys, {indices, indices}));
+    }
+    EXPECT_ANY_THROW(core::HashMultiMap(
+            10, core::Int32, {3}, std::vector<core::Dtype>{core::Int64},
+            std::vector<core::SizeVector>{{1}, {3}}, device));
+    EXPECT_ANY_THROW(core::HashMultiMap(10, core::Int32, {3}, core::Int64, {1},
+                                        device, 0));
+}
+
 TEST_P(HashMapPermuteDevices, HashMapIO) {
     const core::Device &device = GetParam();
     const std::string file_name_noext = "hashmap";
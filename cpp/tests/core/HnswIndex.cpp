@@ -0,0 +1,140 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/nns/HnswIndex.h"
+
+#include <random>
+#include <set>
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Dtype.h"
+#include "open3d/core/SizeVector.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/nns/KnnIndex.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(HnswIndex, SearchKnn) {
+    // Every point is its own nearest neighbor. With a candidate list as large
+    // as the dataset, the search is exact.
+    core::Tensor dataset_points = core::Tensor::Init<double>({{0.0, 0.0, 0.0},
+                                                              {0.0, 0.0, 0.1},
+                                                              {0.0, 0.0, 0.2},
+                                                              {0.0, 0.1, 0.0},
+                                                              {0.0, 0.1, 0.1},
+                                                              {0.0, 0.1, 0.2},
+                                                              {0.0, 0.2, 0.0},
+                                                              {0.0, 0.2, 0.1},
+                                                              {0.0, 0.2, 0.2},
+                                                              {0.1, 0.0, 0.0}});
+    core::Tensor query_points =
+            core::Tensor::Init<double>({{0.064705, 0.043921, 0.087843}});
+    core::Tensor gt_indices = core::Tensor::Init<int32_t>({{1, 4, 9}});
+    core::Tensor gt_distances = core::Tensor::Init<double>(
+            {{0.00626358, 0.00747938, 0.0108912}});
+
+    core::nns::HnswIndex index(/*max_degree=*/4, /*ef_construction=*/16,
+                               /*ef_search=*/16);
+    index.SetTensorData(dataset_points, core::Int32);
+
+    core::Tensor indices, distances;
+    std::tie(indices, distances) = index.SearchKnn(dataset_points, 1);
+    EXPECT_TRUE(indices.View({-1}).AllEqual(
+            core::Tensor::Arange(0, 10, 1, core::Int32)));
+    EXPECT_TRUE(
+            distances.AllClose(core::Tensor::Zeros({10, 1}, core::Float64)));
+
+    std::tie(indices, distances) = index.SearchKnn(query_points, 3);
+    EXPECT_TRUE(indices.AllEqual(gt_indices));
+    EXPECT_TRUE(distances.AllClose(gt_distances));
+
+    // knn is clamped to the dataset size.
+    std::tie(indices, distances) = index.SearchKnn(query_points, 20);
+    EXPECT_EQ(indices.GetShape(), core::SizeVector({1, 10}));
+
+    EXPECT_ANY_THROW(index.SearchKnn(query_points, 0));
+    EXPECT_ANY_THROW(index.SearchKnn(query_points.To(core::Float32), 1));
+    EXPECT_ANY_THROW(index.SetEfSearch(0));
+    EXPECT_ANY_THROW(core::nns::HnswIndex(1));
+}
+
+TEST(HnswIndex, Recall) {
+    // Approximate neighbors of 33-D clustered features, like FPFH features,
+    // compared with the exact ones.
+    const int64_t num_points = 3000;
+    const int64_t num_queries = 300;
+    const int64_t dim = 33;
+    const int knn = 5;
+    std::default_random_engine rng(0);
+    std::uniform_real_distribution<float> center_dist(0, 100);
+    std::normal_distribution<float> noise(0, 5);
+    std::vector<float> centers(20 * dim);
+    for (auto& v : centers) v = center_dist(rng);
+    std::vector<float> points((num_points + num_queries) * dim);
+    for (int64_t i = 0; i < num_points + num_queries; ++i) {
+        const int64_t c = i % 20;
+        for (int64_t d = 0; d < dim; ++d) {
+            points[i * dim + d] = centers[c * dim + d] + noise(rng);
+        }
+    }
+    core::Tensor all_points(points, {num_points + num_queries, dim},
+                            core::Float32);
+    core::Tensor dataset_points = all_points.Slice(0, 0, num_points);
+    core::Tensor query_points =
+            all_points.Slice(0, num_points, num_points + num_queries);
+
+    core::nns::KnnIndex exact_index(dataset_points, core::Int64);
+    std::vector<int64_t> gt_indices = exact_index.SearchKnn(query_points, knn)
+                                              .first.ToFlatVector<int64_t>();
+
+    core::nns::HnswIndex index;
+    index.SetTensorData(dataset_points, core::Int64);
+    double last_recall = 0;
+    for (int ef_search : {8, 128}) {
+        index.SetEfSearch(ef_search);
+        EXPECT_EQ(index.GetEfSearch(), ef_search);
+        core::Tensor indices, distances;
+        std::tie(indices, distances) = index.SearchKnn(query_points, knn);
+        ASSERT_EQ(indices.GetShape(), core::SizeVector({num_queries, knn}));
+
+        // The distances are exact and sorted.
+        core::Tensor neighbors = dataset_points.IndexGet({indices.View({-1})});
+        core::Tensor diff = neighbors -
+                            query_points.Reshape({num_queries, 1, dim})
+                                    .Expand({num_queries, knn, dim})
+                                    .Reshape({-1, dim});
+        core::Tensor expected_distances =
+                (diff * diff).Sum({1}).View({num_queries, knn});
+        EXPECT_TRUE(distances.AllClose(expected_distances, 1e-3, 1e-3));
+        std::vector<float> distances_vec = distances.ToFlatVector<float>();
+        for (int64_t q = 0; q < num_queries; ++q) {
+            for (int k = 1; k < knn; ++k) {
+                EXPECT_LE(distances_vec[q * knn + k - 1],
+                          distances_vec[q * knn + k]);
+            }
+        }
+
+        std::vector<int64_t> indices_vec = indices.ToFlatVector<int64_t>();
+        int64_t num_found = 0;
+        for (int64_t q = 0; q < num_queries; ++q) {
+            std::set<int64_t> gt(gt_indices.begin() + q * knn,
+                                 gt_indices.begin() + (q + 1) * knn);
+            for (int k = 0; k < knn; ++k) {
+                num_found += gt.count(indices_vec[q * knn + k]);
+            }
+        }
+        const double recall = double(num_found) / (num_queries * knn);
+        EXPECT_GE(recall, last_recall);
+        last_recall = recall;
+    }
+    EXPECT_GT(last_recall, 0.95);
+}
+
+}  // namespace tests
+}  // namespace open3d
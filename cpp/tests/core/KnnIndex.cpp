@@ -6,8 +6,10 @@
 // ----------------------------------------------------------------------------
 #include "open3d/core/nns/KnnIndex.h"
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
+#include <random>
 
 #include "core/CoreTest.h"
 #include "open3d/core/Device.h"
@@ -24,9 +26,14 @@ using namespace std;
 namespace open3d {
 namespace tests {
 
-TEST(KnnIndex, KnnSearch) {
+class KnnIndexPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(KnnIndex,
+                         KnnIndexPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(KnnIndexPermuteDevices, KnnSearch) {
     // Define test data.
-    core::Device device = core::Device("CUDA:0");
+    core::Device device = GetParam();
     core::Tensor dataset_points = core::Tensor::Init<float>({{0.0, 0.0, 0.0},
                                                              {0.0, 0.0, 0.1},
                                                              {0.0, 0.0, 0.2},
@@ -149,9 +156,9 @@ TEST(KnnIndex, KnnSearch) {
     EXPECT_TRUE(distances.AllClose(gt_distances));
 }
 
-TEST(KnnIndex, KnnSearchHighdim) {
+TEST_P(KnnIndexPermuteDevices, KnnSearchHighdim) {
     // Define test data.
-    core::Device device = core::Device("CUDA:0");
+    core::Device device = GetParam();
     core::Tensor dataset_points = core::Tensor::Init<float>({{0.0, 0.0, 0.0},
                                                              {0.0, 0.0, 0.1},
                                                              {0.0, 0.0, 0.2},
@@ -231,9 +238,9 @@ TEST(KnnIndex, KnnSearchHighdim) {
     EXPECT_TRUE(distances64.AllClose(gt_distances));
 }
 
-TEST(KnnIndex, KnnSearchBatch) {
+TEST_P(KnnIndexPermuteDevices, KnnSearchBatch) {
     // Define test data.
-    core::Device device = core::Device("CUDA:0");
+    core::Device device = GetParam();
     core::Tensor dataset_points = core::Tensor::Init<float>(
             {{0.719, 0.128, 0.431}, {0.764, 0.970, 0.678},
              {0.692, 0.786, 0.211}, {0.692, 0.969, 0.942},
@@ -329,6 +336,58 @@ TEST(KnnIndex, KnnSearchBatch) {
     EXPECT_EQ(distances.GetShape(), shape);
     EXPECT_TRUE(indices.AllClose(gt_indices));
     EXPECT_TRUE(distances.AllClose(gt_distances, 1e-5, 1e-3));
+
+    // The queries must have the batch size of the points.
+    EXPECT_ANY_THROW(index64.SearchKnn(
+            query_points, core::Tensor::Init<int64_t>({0, 25}), 3));
+    EXPECT_ANY_THROW(index64.SearchKnn(query_points, 3));
+}
+
+TEST(KnnIndex, KnnSearchTiledCPU) {
+    // Several tiles of points and blocks of queries, compared with a naive
+    // search. Ties are resolved by index.
+    const core::Device device("CPU:0");
+    const int64_t num_points = 2500;
+    const int64_t num_queries = 37;
+    std::default_random_engine rng(0);
+    std::uniform_int_distribution<int> dist(0, 7);
+    for (int64_t dim : {3, 33}) {
+        std::vector<float> points(num_points * dim);
+        std::vector<float> queries(num_queries * dim);
+        for (auto& v : points) v = float(dist(rng));
+        for (auto& v : queries) v = float(dist(rng));
+        core::Tensor dataset_points(points, {num_points, dim}, core::Float32,
+                                    device);
+        core::Tensor query_points(queries, {num_queries, dim}, core::Float32,
+                                  device);
+        core::nns::KnnIndex index(dataset_points, core::Int64);
+
+        for (int knn : {1, 7, 40}) {
+            core::Tensor indices, distances;
+            std::tie(indices, distances) = index.SearchKnn(query_points, knn);
+            ASSERT_EQ(indices.GetShape(), core::SizeVector({num_queries, knn}));
+            std::vector<int64_t> indices_vec = indices.ToFlatVector<int64_t>();
+            std::vector<float> distances_vec = distances.ToFlatVector<float>();
+
+            for (int64_t q = 0; q < num_queries; ++q) {
+                std::vector<std::pair<float, int64_t>> gt(num_points);
+                for (int64_t i = 0; i < num_points; ++i) {
+                    float d2 = 0;
+                    for (int64_t d = 0; d < dim; ++d) {
+                        const float diff =
+                                queries[q * dim + d] - points[i * dim + d];
+                        d2 += diff * diff;
+                    }
+                    gt[i] = std::make_pair(d2, i);
+                }
+                std::partial_sort(gt.begin(), gt.begin() + knn, gt.end());
+                for (int k = 0; k < knn; ++k) {
+                    ASSERT_EQ(indices_vec[q * knn + k], gt[k].second);
+                    ASSERT_EQ(distances_vec[q * knn + k], gt[k].first);
+                }
+            }
+        }
+    }
 }
 
 }  // namespace tests
@@ -15,6 +15,8 @@
 #include "open3d/core/Tensor.h"
 #include "open3d/core/kernel/Kernel.h"
 #include "open3d/core/linalg/AddMM.h"
+#include "open3d/core/linalg/Batched.h"
+#include "open3d/core/linalg/Matmul.h"
 #include "open3d/core/linalg/kernel/SVD3x3.h"
 #include "open3d/utility/Helper.h"
 #include "tests/Tests.h"
@@ -69,6 +71,36 @@ TEST_P(LinalgPermuteDevices, Matmul) {
     EXPECT_ANY_THROW(A.Matmul(core::Tensor::Zeros({3, 4, 5}, dtype)));
     EXPECT_ANY_THROW(A.Matmul(core::Tensor::Zeros({3, 0}, dtype)));
     EXPECT_ANY_THROW(A.Matmul(core::Tensor::Zeros({2, 4}, dtype)));
+
+    // Output reuse test.
+    core::Tensor out = core::Tensor::Empty({2, 4}, dtype, device);
+    const void* out_ptr = out.GetDataPtr();
+    A.Matmul(B, out);
+    EXPECT_EQ(out.GetDataPtr(), out_ptr);
+    EXPECT_TRUE(out.AllClose(C));
+    out = core::Tensor::Empty({4, 2}, dtype, device);
+    out_ptr = out.GetDataPtr();
+    A.Matmul(B, out);
+    EXPECT_NE(out.GetDataPtr(), out_ptr);
+    EXPECT_TRUE(out.AllClose(C));
+
+    // Outputs aliasing an input are not written in place.
+    core::Tensor S = core::Tensor::Init<float>({{1, 2}, {3, 4}}, device)
+                             .To(dtype);
+    core::Tensor T = core::Tensor::Init<float>({{0, 1}, {1, 0}}, device)
+                             .To(dtype);
+    core::Tensor T_gt = S.Matmul(T);
+    core::Tensor T_copy = T;
+    S.Matmul(T, T);
+    EXPECT_TRUE(T.AllClose(T_gt));
+    EXPECT_TRUE(T_copy.AllClose(core::Tensor::Init<float>({{0, 1}, {1, 0}},
+                                                          device)
+                                        .To(dtype)));
+
+    // core::Matmul always assigns a new output.
+    core::Tensor C_copy = out;
+    core::Matmul(A, B, out);
+    EXPECT_NE(out.GetDataPtr(), C_copy.GetDataPtr());
 }
 
 TEST_P(LinalgPermuteDevices, AddMM) {
@@ -506,6 +538,124 @@ TEST_P(LinalgPermuteDevices, LeastSquares) {
     }
 }
 
+TEST_P(LinalgPermuteDevices, Batched) {
+    core::Device device = GetParam();
+    core::Dtype dtype = core::Float64;
+    const int64_t batch_size = 5;
+
+    // n <= kBatchedLinalgMaxSize uses the fixed-size kernels on CPU, larger
+    // matrices the LAPACK path. The results must match the LAPACK path.
+    for (int64_t n : {2, 3, 6, 8}) {
+        core::Tensor A = core::Tensor::Arange(0, batch_size * n * n, 1, dtype,
+                                              device)
+                                 .Sin()
+                                 .Reshape({batch_size, n, n}) +
+                         core::Tensor::Eye(n, dtype, device) * 2;
+        core::Tensor B = core::Tensor::Arange(0, batch_size * n * 2, 1, dtype,
+                                              device)
+                                 .Cos()
+                                 .Reshape({batch_size, n, 2});
+
+        core::Tensor det, inv, X, X_vector;
+        core::BatchedDet(A, det);
+        core::BatchedInverse(A, inv);
+        core::BatchedSolve(A, B, X);
+        core::BatchedSolve(A, B.Slice(2, 0, 1).Reshape({batch_size, n}),
+                           X_vector);
+        EXPECT_EQ(det.GetShape(), core::SizeVector({batch_size}));
+        EXPECT_EQ(X_vector.GetShape(), core::SizeVector({batch_size, n}));
+        for (int64_t i = 0; i < batch_size; ++i) {
+            EXPECT_NEAR(det[i].Item<double>(), A[i].Det(), 1e-10);
+            EXPECT_TRUE(inv[i].AllClose(A[i].Inverse()));
+            EXPECT_TRUE(X[i].AllClose(A[i].Solve(B[i])));
+            EXPECT_TRUE(X_vector[i].AllClose(X[i].Slice(1, 0, 1).Flatten()));
+        }
+
+        // Least squares with m = n + 2 rows.
+        core::Tensor A_tall = core::Tensor::Arange(0, batch_size * (n + 2) * n,
+                                                   1, dtype, device)
+                                      .Sin()
+                                      .Reshape({batch_size, n + 2, n});
+        core::Tensor B_tall = core::Tensor::Arange(0, batch_size * (n + 2), 1,
+                                                   dtype, device)
+                                      .Cos()
+                                      .Reshape({batch_size, n + 2});
+        core::BatchedLeastSquares(A_tall, B_tall, X);
+        EXPECT_EQ(X.GetShape(), core::SizeVector({batch_size, n}));
+        for (int64_t i = 0; i < batch_size; ++i) {
+            EXPECT_TRUE(X[i].AllClose(
+                    A_tall[i].LeastSquares(B_tall[i].Reshape({n + 2, 1}))
+                            .Flatten(),
+                    1e-5, 1e-8));
+        }
+
+        // Singular matrices.
+        EXPECT_ANY_THROW(core::BatchedInverse(
+                core::Tensor::Zeros({batch_size, n, n}, dtype, device), inv));
+        EXPECT_ANY_THROW(core::BatchedSolve(
+                core::Tensor::Zeros({batch_size, n, n}, dtype, device), B, X));
+    }
+
+    // Ill-conditioned least squares with an exact solution. Solving the normal
+    // equations would square the condition number of about 1e7.
+    {
+        const int64_t m = 8;
+        std::vector<double> A_data, B_data, X_data;
+        for (int64_t i = 0; i < batch_size; ++i) {
+            for (int64_t r = 0; r < m; ++r) {
+                const double t = (r + 1 + i) / 8.0;
+                const double a1 = t + 1e-6 * t * t;
+                A_data.push_back(t);
+                A_data.push_back(a1);
+                B_data.push_back(t + 2 * a1);
+            }
+            X_data.push_back(1);
+            X_data.push_back(2);
+        }
+        core::Tensor A(A_data, {batch_size, m, 2}, dtype, device);
+        core::Tensor B(B_data, {batch_size, m}, dtype, device);
+        core::Tensor X;
+        core::BatchedLeastSquares(A, B, X);
+        EXPECT_TRUE(X.AllClose(
+                core::Tensor(X_data, {batch_size, 2}, dtype, device), 1e-6,
+                1e-6));
+    }
+
+    // SVD, compared by reconstruction since the signs of the singular vectors
+    // are not unique.
+    for (int64_t m : {3, 4}) {
+        core::Tensor A = core::Tensor::Arange(0, batch_size * m * 3, 1, dtype,
+                                              device)
+                                 .Sin()
+                                 .Reshape({batch_size, m, 3});
+        core::Tensor U, S, VT;
+        core::BatchedSVD(A, U, S, VT);
+        EXPECT_EQ(U.GetShape(), core::SizeVector({batch_size, m, m}));
+        EXPECT_EQ(S.GetShape(), core::SizeVector({batch_size, 3}));
+        EXPECT_EQ(VT.GetShape(), core::SizeVector({batch_size, 3, 3}));
+        for (int64_t i = 0; i < batch_size; ++i) {
+            core::Tensor U_i, S_i, VT_i;
+            std::tie(U_i, S_i, VT_i) = A[i].SVD();
+            EXPECT_TRUE(S[i].AllClose(S_i));
+            core::Tensor U_3 = U[i].Slice(1, 0, 3);
+            EXPECT_TRUE((U_3 * S[i].Reshape({1, 3}))
+                                .Matmul(VT[i])
+                                .AllClose(A[i], 1e-5, 1e-8));
+        }
+    }
+
+    // Shape test.
+    core::Tensor output;
+    EXPECT_ANY_THROW(core::BatchedInverse(
+            core::Tensor::Ones({3, 3}, dtype, device), output));
+    EXPECT_ANY_THROW(core::BatchedInverse(
+            core::Tensor::Ones({2, 3, 4}, dtype, device), output));
+    EXPECT_ANY_THROW(
+            core::BatchedSolve(core::Tensor::Ones({2, 3, 3}, dtype, device),
+                               core::Tensor::Ones({3, 3}, dtype, device),
+                               output));
+}
+
 TEST_P(LinalgPermuteDevices, KernelOps) {
     core::Tensor A_3x3 =
             core::Tensor::Init<float>({{0, 1, 0}, {1, 0, 0}, {0, 0, 1}});
@@ -8,8 +8,10 @@
 #include "open3d/core/MemoryManager.h"
 
 #include <map>
+#include <thread>
 
 #include "open3d/core/Device.h"
+#include "open3d/core/MemoryManagerStatistic.h"
 #include "tests/Tests.h"
 #include "tests/core/CoreTest.h"
 
@@ -119,6 +121,42 @@ TEST_P(MemoryManagerPermuteDevices, MallocFree) {
     core::MemoryManager::Free(ptr, device);
 }
 
+TEST_P(MemoryManagerPermuteDevices, TagStatistic) {
+    core::Device device = GetParam();
+    auto& statistic = core::MemoryManagerStatistic::GetInstance();
+
+    void* untagged = core::MemoryManager::Malloc(7, device);
+    void* outer_ptr;
+    void* inner_ptr;
+    {
+        core::ScopedMemoryTag outer("TagStatisticOuter");
+        outer_ptr = core::MemoryManager::Malloc(100, device);
+        {
+            // Allocations are counted for the innermost tag only.
+            core::ScopedMemoryTag inner("TagStatisticInner");
+            inner_ptr = core::MemoryManager::Malloc(10, device);
+        }
+        core::MemoryManager::Free(outer_ptr, device);
+        outer_ptr = core::MemoryManager::Malloc(50, device);
+    }
+
+    auto tags = statistic.GetTagStatistics(device);
+    EXPECT_EQ(tags["TagStatisticOuter"].count_malloc_, 2);
+    EXPECT_EQ(tags["TagStatisticOuter"].live_byte_size_, 50u);
+    EXPECT_EQ(tags["TagStatisticOuter"].peak_byte_size_, 100u);
+    EXPECT_EQ(tags["TagStatisticInner"].count_malloc_, 1);
+    EXPECT_EQ(tags["TagStatisticInner"].live_byte_size_, 10u);
+
+    // Tagged memory is released when freed outside of the tag scope.
+    core::MemoryManager::Free(inner_ptr, device);
+    core::MemoryManager::Free(outer_ptr, device);
+    core::MemoryManager::Free(untagged, device);
+    tags = statistic.GetTagStatistics(device);
+    EXPECT_EQ(tags["TagStatisticOuter"].live_byte_size_, 0u);
+    EXPECT_EQ(tags["TagStatisticOuter"].peak_byte_size_, 100u);
+    EXPECT_EQ(tags["TagStatisticInner"].live_byte_size_, 0u);
+}
+
 TEST_P(MemoryManagerPermuteDevicePairs, Memcpy) {
     core::Device dst_device;
     core::Device src_device;
@@ -521,6 +559,133 @@ TEST(MemoryManagerPermuteDevices, CachedTooLargeAutoReleaseAll) {
     ExpectStatistic(dummy_mm, 3, 3, 0);
 }
 
+TEST(MemoryManagerPermuteDevices, CPUAllocationPolicy) {
+    core::Device device("CPU:0");
+    core::MemoryManagerCPU cpu_mm;
+
+    // Cache line alignment by default.
+    void* ptr = cpu_mm.Malloc(10, device);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) % 64, 0);
+    cpu_mm.Free(ptr, device);
+
+    core::CPUAllocationPolicy policy;
+    policy.alignment_ = 4096;
+    core::MemoryManagerCPU::SetAllocationPolicy(policy);
+    ptr = cpu_mm.Malloc(10, device);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) % 4096, 0);
+    cpu_mm.Free(ptr, device);
+
+    // Large blocks with hints are aligned to huge pages.
+    policy.huge_pages_ = true;
+    policy.numa_placement_ =
+            core::CPUAllocationPolicy::NUMAPlacement::Interleave;
+    policy.large_byte_size_threshold_ = 1 << 20;
+    core::MemoryManagerCPU::SetAllocationPolicy(policy);
+    ptr = cpu_mm.Malloc(5 << 20, device);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) % (2 << 20), 0);
+    std::memset(ptr, 1, 5 << 20);
+    cpu_mm.Free(ptr, device);
+
+    // Device-specific policies override the global one.
+    core::CPUAllocationPolicy device_policy;
+    device_policy.alignment_ = 256;
+    core::MemoryManagerCPU::SetAllocationPolicy(device_policy, device);
+    EXPECT_EQ(core::MemoryManagerCPU::GetAllocationPolicy(device).alignment_,
+              256);
+    ptr = cpu_mm.Malloc(10, device);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) % 256, 0);
+    cpu_mm.Free(ptr, device);
+
+    policy.alignment_ = 48;
+    EXPECT_THROW(core::MemoryManagerCPU::SetAllocationPolicy(policy),
+                 std::runtime_error);
+    EXPECT_THROW(core::MemoryManagerCPU::SetAllocationPolicy(
+                         device_policy, core::Device("CUDA:0")),
+                 std::runtime_error);
+
+    core::MemoryManagerCPU::ResetAllocationPolicy();
+    EXPECT_EQ(core::MemoryManagerCPU::GetAllocationPolicy(device).alignment_,
+              64);
+}
+
+TEST(MemoryManagerPermuteDevices, CachedCPUThreadCache) {
+    core::Device device("CPU:0");
+    auto cached_mm = MakeCachedMemoryManagerDevice(device);
+
+    core::MemoryManagerCached::ReleaseCache(device);
+
+    void* ptr = cached_mm->Malloc(100, device);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) % 64, 0);
+    std::memset(ptr, 0, 100);
+    cached_mm->Free(ptr, device);
+
+    // Sizes of the same size class reuse the block of the thread cache.
+    void* ptr2 = cached_mm->Malloc(110, device);
+    EXPECT_EQ(ptr2, ptr);
+    cached_mm->Free(ptr2, device);
+
+    // Blocks beyond the pooled range are served by the shared cache.
+    void* ptr3 = cached_mm->Malloc(64 << 20, device);
+    std::memset(ptr3, 0, 64 << 20);
+    cached_mm->Free(ptr3, device);
+
+    // Alignments beyond the block header are not supported.
+    core::CPUAllocationPolicy policy;
+    policy.alignment_ = 256;
+    core::MemoryManagerCPU::SetAllocationPolicy(policy, device);
+    EXPECT_THROW(cached_mm->Malloc(100, device), std::runtime_error);
+    core::MemoryManagerCPU::ResetAllocationPolicy();
+
+    core::MemoryManagerCached::ReleaseCache(device);
+}
+
+TEST(MemoryManagerPermuteDevices, CachedCPUMultiThreaded) {
+    core::Device device("CPU:0");
+    auto cached_mm = MakeCachedMemoryManagerDevice(device);
+
+    core::MemoryManagerCached::ReleaseCache(device);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&cached_mm, &device, t]() {
+            for (int i = 0; i < 1000; ++i) {
+                size_t byte_size = 16 + (i % 37) * 100 + t;
+                char* ptr = static_cast<char*>(
+                        cached_mm->Malloc(byte_size, device));
+                ptr[0] = static_cast<char>(t);
+                ptr[byte_size - 1] = static_cast<char>(t);
+                EXPECT_EQ(ptr[0], ptr[byte_size - 1]);
+                cached_mm->Free(ptr, device);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Blocks kept by the caches of exited and running threads are released.
+    core::MemoryManagerCached::ReleaseCache(device);
+}
+
+TEST(MemoryManagerPermuteDevices, SetCPUBackend) {
+    core::Device device("CPU:0");
+
+    // The first CPU allocation selects the backend for the whole process.
+    void* ptr = core::MemoryManager::Malloc(10, device);
+    core::MemoryManager::Free(ptr, device);
+
+    const core::MemoryManagerBackend backend =
+            core::MemoryManager::GetCPUBackend();
+    const core::MemoryManagerBackend other_backend =
+            backend == core::MemoryManagerBackend::Direct
+                    ? core::MemoryManagerBackend::Cached
+                    : core::MemoryManagerBackend::Direct;
+    EXPECT_NO_THROW(core::MemoryManager::SetCPUBackend(backend));
+    EXPECT_THROW(core::MemoryManager::SetCPUBackend(other_backend),
+                 std::runtime_error);
+    EXPECT_EQ(core::MemoryManager::GetCPUBackend(), backend);
+}
+
 // This must be the last test for core::MemoryManagerCached.
 TEST(MemoryManagerPermuteDevices, CachedFreeOnProgramEnd) {
     core::Device device = MakeDummyDevice();
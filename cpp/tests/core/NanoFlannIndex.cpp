@@ -8,6 +8,7 @@
 #include "open3d/core/nns/NanoFlannIndex.h"
 
 #include <cmath>
+#include <fstream>
 #include <limits>
 
 #include "core/CoreTest.h"
@@ -15,6 +16,7 @@
 #include "open3d/core/Dtype.h"
 #include "open3d/core/SizeVector.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Helper.h"
 #include "tests/Tests.h"
 #include "tests/core/CoreTest.h"
@@ -186,5 +188,120 @@ TEST(NanoFlannIndex, SearchRadius) {
     EXPECT_TRUE(neighbors_row_splits.AllClose(gt_neighbors_row_splits));
 }
 
+TEST(NanoFlannIndex, SaveLoadIndex) {
+    std::vector<float> points(3000);
+    for (size_t i = 0; i < points.size(); ++i) {
+        points[i] = float(i * 7919 % 1000) / 100;
+    }
+    core::Tensor dataset_points(points, {1000, 3}, core::Float32);
+    core::Tensor query_points = dataset_points.Slice(0, 0, 50) + 0.05;
+    core::nns::NanoFlannIndex index(dataset_points, core::Int32);
+
+    const std::string file_name =
+            utility::filesystem::GetTempDirectoryPath() + "/nanoflann.bin";
+    EXPECT_TRUE(index.SaveIndex(file_name));
+    core::nns::NanoFlannIndex loaded_index;
+    EXPECT_TRUE(loaded_index.LoadIndex(file_name));
+    EXPECT_EQ(loaded_index.GetDtype(), core::Float32);
+    EXPECT_EQ(loaded_index.GetIndexDtype(), core::Int32);
+    EXPECT_EQ(loaded_index.GetDatasetSize(), size_t(1000));
+    EXPECT_EQ(loaded_index.GetDimension(), 3);
+
+    core::Tensor indices, distances, loaded_indices, loaded_distances;
+    std::tie(indices, distances) = index.SearchKnn(query_points, 8);
+    std::tie(loaded_indices, loaded_distances) =
+            loaded_index.SearchKnn(query_points, 8);
+    EXPECT_TRUE(loaded_indices.AllEqual(indices));
+    EXPECT_TRUE(loaded_distances.AllClose(distances));
+
+    core::Tensor counts, loaded_counts;
+    std::tie(indices, distances, counts) =
+            index.SearchRadius(query_points, 1.0);
+    std::tie(loaded_indices, loaded_distances, loaded_counts) =
+            loaded_index.SearchRadius(query_points, 1.0);
+    EXPECT_TRUE(loaded_indices.AllEqual(indices));
+    EXPECT_TRUE(loaded_counts.AllEqual(counts));
+
+    // A stale header with fewer points than the saved tree refers to. The
+    // number of points is at byte 24 of the header, see KdTreeFileHeader.
+    {
+        std::fstream file(file_name,
+                          std::ios::in | std::ios::out | std::ios::binary);
+        const uint64_t num_points = 500;
+        file.seekp(24);
+        file.write(reinterpret_cast<const char *>(&num_points),
+                   sizeof(num_points));
+    }
+    EXPECT_ANY_THROW(loaded_index.LoadIndex(file_name));
+
+    EXPECT_FALSE(loaded_index.LoadIndex(file_name + ".missing"));
+    utility::filesystem::RemoveFile(file_name);
+}
+
+TEST(NanoFlannIndex, ParallelBuild) {
+    // Large enough to split the upper levels of the tree into parallel tasks.
+    core::Tensor dataset_points =
+            core::Tensor::Arange(0, 100000 * 3, 1, core::Float64)
+                    .Reshape({100000, 3})
+                    .Sin();
+    core::Tensor query_points = dataset_points.Slice(0, 0, 1000) + 0.001;
+
+    core::nns::NanoFlannIndex serial_index(dataset_points, core::Int64);
+    core::nns::NanoFlannIndex parallel_index;
+    parallel_index.SetBuildThreads(4);
+    EXPECT_EQ(parallel_index.GetBuildThreads(), 4);
+    parallel_index.SetTensorData(dataset_points, core::Int64);
+
+    core::Tensor indices, distances, parallel_indices, parallel_distances;
+    std::tie(indices, distances) = serial_index.SearchKnn(query_points, 8);
+    std::tie(parallel_indices, parallel_distances) =
+            parallel_index.SearchKnn(query_points, 8);
+    EXPECT_TRUE(parallel_indices.AllEqual(indices));
+    EXPECT_TRUE(parallel_distances.AllClose(distances));
+}
+
+TEST(NanoFlannIndex, SortQueries) {
+    // Searching the queries in Morton order gives the same results, in the
+    // original order of the queries.
+    core::Tensor dataset_points =
+            core::Tensor::Arange(0, 10000 * 3, 1, core::Float32)
+                    .Reshape({10000, 3})
+                    .Sin();
+    core::Tensor query_points =
+            (core::Tensor::Arange(0, 2000 * 3, 1, core::Float32) * 7)
+                    .Reshape({2000, 3})
+                    .Cos();
+
+    core::nns::NanoFlannIndex index(dataset_points, core::Int32);
+    core::nns::NanoFlannIndex sorted_index(dataset_points, core::Int32);
+    sorted_index.SetSortQueries(true);
+    EXPECT_TRUE(sorted_index.GetSortQueries());
+
+    core::Tensor indices, distances, sorted_indices, sorted_distances;
+    std::tie(indices, distances) = index.SearchKnn(query_points, 4);
+    std::tie(sorted_indices, sorted_distances) =
+            sorted_index.SearchKnn(query_points, 4);
+    EXPECT_TRUE(sorted_indices.AllEqual(indices));
+    EXPECT_TRUE(sorted_distances.AllClose(distances));
+
+    core::Tensor splits, sorted_splits;
+    std::tie(indices, distances, splits) =
+            index.SearchRadius(query_points, 0.1);
+    std::tie(sorted_indices, sorted_distances, sorted_splits) =
+            sorted_index.SearchRadius(query_points, 0.1);
+    EXPECT_TRUE(sorted_splits.AllEqual(splits));
+    EXPECT_TRUE(sorted_indices.AllEqual(indices));
+    EXPECT_TRUE(sorted_distances.AllClose(distances));
+
+    core::Tensor counts, sorted_counts;
+    std::tie(indices, distances, counts) =
+            index.SearchHybrid(query_points, 0.1, 4);
+    std::tie(sorted_indices, sorted_distances, sorted_counts) =
+            sorted_index.SearchHybrid(query_points, 0.1, 4);
+    EXPECT_TRUE(sorted_counts.AllEqual(counts));
+    EXPECT_TRUE(sorted_indices.AllEqual(indices));
+    EXPECT_TRUE(sorted_distances.AllClose(distances));
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -27,6 +27,14 @@ INSTANTIATE_TEST_SUITE_P(NearestNeighborSearch,
                          NNSPermuteDevices,
                          testing::ValuesIn(PermuteDevices::TestCases()));
 
+/// Exposes the indices built by NearestNeighborSearch.
+class NNSIndexState : public core::nns::NearestNeighborSearch {
+public:
+    using core::nns::NearestNeighborSearch::NearestNeighborSearch;
+    bool HasKnnIndex() const { return knn_index_ != nullptr; }
+    bool HasNanoFlannIndex() const { return nanoflann_index_ != nullptr; }
+};
+
 TEST_P(NNSPermuteDevices, KnnSearch) {
     // Define test data.
     core::Device device = GetParam();
@@ -376,5 +384,72 @@ TEST_P(NNSPermuteDevices, HybridSearch) {
     EXPECT_TRUE(counts.AllClose(gt_counts));
 }
 
+TEST(NearestNeighborSearch, ApproximateKnnSearch) {
+    core::Tensor dataset_points = core::Tensor::Init<float>({{0.0, 0.0, 0.0},
+                                                             {0.0, 0.0, 0.1},
+                                                             {0.0, 0.0, 0.2},
+                                                             {0.0, 0.1, 0.0},
+                                                             {0.0, 0.1, 0.1},
+                                                             {0.0, 0.1, 0.2},
+                                                             {0.0, 0.2, 0.0},
+                                                             {0.0, 0.2, 0.1},
+                                                             {0.0, 0.2, 0.2},
+                                                             {0.1, 0.0, 0.0},
+                                                             {0.1, 0.0, 0.1},
+                                                             {0.1, 0.1, 0.0}});
+    core::Tensor query_points =
+            core::Tensor::Init<float>({{0.064705, 0.043921, 0.087843}});
+
+    // The candidate list covers the whole dataset, so the search is exact.
+    core::nns::NearestNeighborSearch nns(dataset_points, core::Int64);
+    EXPECT_TRUE(nns.ApproximateKnnIndex(/*ef_search=*/12));
+    core::Tensor indices, distances;
+    std::tie(indices, distances) = nns.KnnSearch(query_points, 3);
+    EXPECT_TRUE(indices.AllEqual(core::Tensor::Init<int64_t>({{10, 1, 4}})));
+    EXPECT_TRUE(distances.AllClose(core::Tensor::Init<float>(
+            {{0.00332258, 0.00626358, 0.00747938}})));
+}
+
+TEST(NearestNeighborSearch, KnnSearchBruteForceThresholds) {
+    using NNS = core::nns::NearestNeighborSearch;
+    const int64_t dim = NNS::kMinBruteForceKnnDim;
+    const int64_t num_points = NNS::kMaxBruteForceKnnPoints + 1;
+    const int64_t num_queries = NNS::kMaxBruteForceKnnQueries + 1;
+    core::Tensor points =
+            core::Tensor::Arange(0, num_points * dim, 1, core::Float32)
+                    .Sin()
+                    .Reshape({num_points, dim});
+    core::Tensor queries =
+            core::Tensor::Arange(0, num_queries * dim, 1, core::Float32)
+                    .Cos()
+                    .Reshape({num_queries, dim});
+
+    // Small high-dimensional datasets are searched by brute force, unless
+    // there are too many queries.
+    NNSIndexState nns(points.Slice(0, 0, 100));
+    EXPECT_TRUE(nns.KnnIndex());
+    EXPECT_TRUE(nns.HasKnnIndex());
+    EXPECT_FALSE(nns.HasNanoFlannIndex());
+    core::Tensor indices, distances, kdtree_indices, kdtree_distances;
+    std::tie(indices, distances) =
+            nns.KnnSearch(queries.Slice(0, 0, num_queries - 1), 3);
+    EXPECT_FALSE(nns.HasNanoFlannIndex());
+    std::tie(kdtree_indices, kdtree_distances) = nns.KnnSearch(queries, 3);
+    EXPECT_TRUE(nns.HasNanoFlannIndex());
+    EXPECT_TRUE(kdtree_indices.Slice(0, 0, num_queries - 1).AllEqual(indices));
+    EXPECT_TRUE(kdtree_distances.Slice(0, 0, num_queries - 1)
+                        .AllClose(distances));
+
+    // Large or low-dimensional datasets use the KD-tree.
+    NNSIndexState large_nns(points);
+    EXPECT_TRUE(large_nns.KnnIndex());
+    EXPECT_FALSE(large_nns.HasKnnIndex());
+    EXPECT_TRUE(large_nns.HasNanoFlannIndex());
+    NNSIndexState low_dim_nns(points.Slice(0, 0, 100).Slice(1, 0, dim - 1));
+    EXPECT_TRUE(low_dim_nns.KnnIndex());
+    EXPECT_FALSE(low_dim_nns.HasKnnIndex());
+    EXPECT_TRUE(low_dim_nns.HasNanoFlannIndex());
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -37,6 +37,35 @@ TEST(ParallelFor, LambdaCPU) {
     }
 }
 
+TEST(ParallelFor, Options) {
+    const core::Device device("CPU:0");
+    const int64_t n = 100000;
+    for (utility::ParallelSchedule schedule :
+         {utility::ParallelSchedule::Static, utility::ParallelSchedule::Dynamic,
+          utility::ParallelSchedule::Guided}) {
+        for (int64_t grain_size : {int64_t(1), int64_t(100), 2 * n}) {
+            std::vector<int> v(n, 0);
+            core::ParallelFor(device, n, {schedule, grain_size},
+                              [&](int64_t idx) { v[idx]++; });
+            for (int64_t i = 0; i < n; ++i) {
+                ASSERT_EQ(v[i], 1);
+            }
+        }
+    }
+
+    // Below the serial cutoff, the loop runs in the calling thread.
+    bool in_parallel = false;
+    int64_t count = 0;
+    core::ParallelFor(device, 1000,
+                      {utility::ParallelSchedule::Guided, 1, 1000},
+                      [&](int64_t idx) {
+                          in_parallel = in_parallel || utility::InParallel();
+                          count++;
+                      });
+    EXPECT_FALSE(in_parallel);
+    EXPECT_EQ(count, 1000);
+}
+
 TEST(ParallelFor, VectorizedLambda1) {
     const size_t N = 10000000;
     std::vector<int64_t> v(N);
@@ -0,0 +1,119 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/ScopedArena.h"
+
+#include <thread>
+
+#include "open3d/core/Blob.h"
+#include "open3d/core/Device.h"
+#include "open3d/core/MemoryManagerStatistic.h"
+#include "open3d/core/Tensor.h"
+#include "tests/Tests.h"
+#include "tests/core/CoreTest.h"
+
+namespace open3d {
+namespace tests {
+
+class ScopedArenaPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(ScopedArena,
+                         ScopedArenaPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(ScopedArenaPermuteDevices, BumpAllocation) {
+    core::Device device = GetParam();
+
+    core::ScopedArena arena(device, 1 << 20);
+    core::Blob b0(100, device);
+    core::Blob b1(100, device);
+
+    char* ptr0 = static_cast<char*>(b0.GetDataPtr());
+    char* ptr1 = static_cast<char*>(b1.GetDataPtr());
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr0) % core::ScopedArena::kAlignment,
+              0);
+    EXPECT_EQ(ptr1 - ptr0, 128);
+    EXPECT_EQ(arena.GetMallocCount(), 2);
+    EXPECT_EQ(arena.GetPeakByteSize(), 256);
+    EXPECT_EQ(arena.GetReservedByteSize(), 1 << 20);
+}
+
+TEST_P(ScopedArenaPermuteDevices, ReuseAcrossIterations) {
+    core::Device device = GetParam();
+
+    core::ScopedArena arena(device, 1 << 20);
+    core::Tensor a = core::Tensor::Ones({1000, 3}, core::Float32, device);
+    for (int i = 0; i < 100; ++i) {
+        core::Tensor b = (a * 2 + 1).Abs();
+        a = b - 2;
+        EXPECT_TRUE(a.AllClose(
+                core::Tensor::Ones({1000, 3}, core::Float32, device)));
+    }
+
+    // Chunks whose blocks have all been freed are rewound and reused.
+    EXPECT_LE(arena.GetReservedByteSize(), 2 << 20);
+    EXPECT_GT(arena.GetMallocCount(), 100);
+}
+
+TEST_P(ScopedArenaPermuteDevices, BlobOutlivesArena) {
+    core::Device device = GetParam();
+
+    core::Tensor t;
+    {
+        core::ScopedArena arena(device);
+        t = core::Tensor::Full({100}, 3, core::Int32, device);
+    }
+    EXPECT_TRUE(t.AllClose(core::Tensor::Full({100}, 3, core::Int32, device)));
+}
+
+TEST_P(ScopedArenaPermuteDevices, Bypass) {
+    core::Device device = GetParam();
+
+    core::ScopedArena arena(device, 1 << 10);
+
+    // Larger than a chunk.
+    core::Blob large(1 << 11, device);
+    EXPECT_EQ(arena.GetMallocCount(), 0);
+
+    // Other threads.
+    std::thread thread([&device]() { core::Blob b(10, device); });
+    thread.join();
+    EXPECT_EQ(arena.GetMallocCount(), 0);
+
+    core::Blob b(10, device);
+    EXPECT_EQ(arena.GetMallocCount(), 1);
+}
+
+TEST_P(ScopedArenaPermuteDevices, Nested) {
+    core::Device device = GetParam();
+
+    core::ScopedArena outer(device);
+    {
+        core::ScopedArena inner(device);
+        core::Blob b(10, device);
+        EXPECT_EQ(inner.GetMallocCount(), 1);
+        EXPECT_EQ(outer.GetMallocCount(), 0);
+    }
+    core::Blob b(10, device);
+    EXPECT_EQ(outer.GetMallocCount(), 1);
+}
+
+TEST_P(ScopedArenaPermuteDevices, Statistic) {
+    core::Device device = GetParam();
+
+    auto& statistic = core::MemoryManagerStatistic::GetInstance();
+    const int64_t count_malloc = statistic.GetArenaMallocCount(device);
+    {
+        core::ScopedArena arena(device, 1 << 20);
+        core::Blob b0(1000, device);
+        core::Blob b1(1000, device);
+    }
+    EXPECT_EQ(statistic.GetArenaMallocCount(device), count_malloc + 2);
+    EXPECT_GE(statistic.GetArenaPeakByteSize(device), 2048);
+}
+
+}  // namespace tests
+}  // namespace open3d
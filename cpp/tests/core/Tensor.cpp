@@ -9,8 +9,10 @@
 
 #include <gmock/gmock.h>
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
+#include <numeric>
 
 #include "open3d/core/AdvancedIndexing.h"
 #include "open3d/core/Dtype.h"
@@ -1627,6 +1629,44 @@ TEST_P(TensorPermuteDevices, Add_BroadcastException) {
                                   20, 22, 24, 26, 28, 30, 32, 34}));
 }
 
+TEST_P(TensorPermuteDevices, BinaryEWLayouts) {
+    // Large enough to be split into multiple chunks by contiguous kernels.
+    core::Device device = GetParam();
+    const int64_t n = 100003;
+    core::Tensor a = core::Tensor::Arange(0, n, 1, core::Int32, device);
+    core::Tensor b = core::Tensor::Full({n}, 2, core::Int32, device);
+    core::Tensor two = core::Tensor::Init<int32_t>({2}, device);
+    std::vector<int32_t> a_vals = a.ToFlatVector<int32_t>();
+
+    auto expect_sum = [&](const core::Tensor& t) {
+        std::vector<int32_t> vals = t.ToFlatVector<int32_t>();
+        ASSERT_EQ(vals.size(), a_vals.size());
+        for (size_t i = 0; i < vals.size(); ++i) {
+            ASSERT_EQ(vals[i], a_vals[i] + 2);
+        }
+    };
+
+    // Contiguous, scalar broadcasted to either side, strided.
+    expect_sum(a + b);
+    expect_sum(a + two);
+    expect_sum(two + a);
+    core::Tensor a_strided =
+            core::Tensor::Arange(0, 2 * n, 1, core::Int32, device)
+                    .Slice(0, 0, 2 * n, 2);
+    core::Tensor diff = a_strided + b - a * 2;
+    EXPECT_TRUE(diff.AllEqual(b));
+
+    // In-place with aliased output.
+    core::Tensor c = a.Clone();
+    c += c;
+    EXPECT_TRUE(c.AllEqual(a * 2));
+
+    // Boolean output.
+    core::Tensor gt = a > two;
+    EXPECT_EQ(gt.GetDtype(), core::Bool);
+    EXPECT_EQ(gt.To(core::Int64).Sum({0}).Item<int64_t>(), n - 3);
+}
+
 TEST_P(TensorPermuteDevices, Sub) {
     core::Device device = GetParam();
     core::Tensor a =
@@ -2278,6 +2318,51 @@ TEST_P(TensorPermuteDevices, ReduceArgMax) {
               std::vector<int64_t>({1, 2, 2, 1, 3, 2}));
 }
 
+TEST_P(TensorPermuteDevices, ReduceContiguous) {
+    core::Device device = GetParam();
+
+    // Compares the contiguous reduction path with the strided path.
+    const int64_t n = 100003;
+    std::vector<int64_t> values_vec(n * 6);
+    for (int64_t i = 0; i < n * 6; ++i) {
+        values_vec[i] = i * 7919 % 1000;
+    }
+    core::Tensor values(values_vec, {n * 6}, core::Int64, device);
+    for (core::Dtype dtype : {core::Int32, core::Float32, core::Float64}) {
+        core::Tensor strided =
+                values.To(dtype).Reshape({n, 6}).Slice(1, 0, 6, 2);
+        core::Tensor src = strided.Contiguous();
+        ASSERT_FALSE(strided.IsContiguous());
+
+        // The strided path sums sequentially, which is less accurate for
+        // Float32, so the sums are compared with Float64 sums instead.
+        core::Tensor ref = strided.To(core::Float64);
+        EXPECT_TRUE(src.Sum({0}).AllClose(ref.Sum({0}).To(dtype)));
+        EXPECT_TRUE(src.Sum({1}).AllClose(ref.Sum({1}).To(dtype)));
+        EXPECT_TRUE(src.Sum({0, 1}).AllClose(ref.Sum({0, 1}).To(dtype)));
+        EXPECT_TRUE(src.Min({0}).AllEqual(strided.Min({0})));
+        EXPECT_TRUE(src.Max({0}).AllEqual(strided.Max({0})));
+        EXPECT_TRUE(src.Max({1}, true).AllEqual(strided.Max({1}, true)));
+        EXPECT_TRUE(src.T().Contiguous().Min({1}).AllEqual(
+                strided.T().Min({1})));
+
+        // Values repeat, the first index of the extremum is returned.
+        EXPECT_TRUE(src.ArgMin({0}).AllEqual(strided.ArgMin({0})));
+        EXPECT_TRUE(src.ArgMax({0}).AllEqual(strided.ArgMax({0})));
+        EXPECT_TRUE(src.ArgMin({1}).AllEqual(strided.ArgMin({1})));
+        EXPECT_TRUE(src.ArgMax({0, 1}).AllEqual(strided.ArgMax({0, 1})));
+    }
+
+    core::Tensor ints = values.Reshape({n, 6}).Gt(500).To(core::Int32) + 1;
+    EXPECT_TRUE(
+            ints.Prod({1}).AllEqual(ints.T().Contiguous().T().Prod({1})));
+
+    // Pairwise summation keeps the error of large float sums small.
+    core::Tensor small = core::Tensor::Full({1 << 22}, 0.1, core::Float32,
+                                            device);
+    EXPECT_NEAR(small.Sum({0}).Item<float>(), 0.1 * (1 << 22), 1.0);
+}
+
 TEST_P(TensorPermuteDevices, Sqrt) {
     core::Device device = GetParam();
     core::Tensor src =
@@ -2797,6 +2882,100 @@ TEST_P(TensorPermuteDevices, NonZeroNumpy) {
     EXPECT_EQ(results[1].GetShape(), core::SizeVector{3});
 }
 
+TEST_P(TensorPermuteDevices, Sort) {
+    core::Device device = GetParam();
+    core::Tensor a = core::Tensor::Init<float>({3, -1, 2, -0.5, 2, 0}, device);
+    if (!device.IsCPU()) {
+        EXPECT_ANY_THROW(a.Sort());
+        return;
+    }
+    EXPECT_EQ(a.Sort().ToFlatVector<float>(),
+              std::vector<float>({-1, -0.5, 0, 2, 2, 3}));
+    EXPECT_EQ(a.ArgSort().ToFlatVector<int64_t>(),
+              std::vector<int64_t>({1, 3, 5, 2, 4, 0}));
+    EXPECT_EQ(a.Sort().GetDtype(), core::Float32);
+    EXPECT_EQ(core::Tensor({0}, core::Int32, device).Sort().GetShape(),
+              core::SizeVector{0});
+
+    // Large enough to use multiple blocks, compared with std::stable_sort.
+    const int64_t n = 100000;
+    std::vector<int64_t> values(n);
+    for (int64_t i = 0; i < n; ++i) {
+        values[i] = (i * 7919) % 1000 - 500 + (i % 3 == 0 ? (1LL << 40) : 0);
+    }
+    std::vector<int64_t> indices(n);
+    std::iota(indices.begin(), indices.end(), 0);
+    std::stable_sort(
+            indices.begin(), indices.end(),
+            [&](int64_t i, int64_t j) { return values[i] < values[j]; });
+    core::Tensor b(values, {n}, core::Int64, device);
+    EXPECT_EQ(b.ArgSort().ToFlatVector<int64_t>(), indices);
+    std::sort(values.begin(), values.end());
+    EXPECT_EQ(b.Sort().ToFlatVector<int64_t>(), values);
+
+    // Only 1D tensors are supported.
+    EXPECT_ANY_THROW(b.Reshape({1000, 100}).Sort());
+    EXPECT_ANY_THROW(core::Tensor::Init<bool>({true, false}, device).Sort());
+}
+
+TEST_P(TensorPermuteDevices, Unique) {
+    core::Device device = GetParam();
+    core::Tensor a = core::Tensor::Init<int32_t>({5, 1, 5, 3, 1, 5}, device);
+    if (!device.IsCPU()) {
+        EXPECT_ANY_THROW(a.Unique());
+        return;
+    }
+    core::Tensor values, inverse, counts;
+    std::tie(values, inverse, counts) = a.Unique();
+    EXPECT_EQ(values.ToFlatVector<int32_t>(), std::vector<int32_t>({1, 3, 5}));
+    EXPECT_EQ(inverse.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({2, 0, 2, 1, 0, 2}));
+    EXPECT_EQ(counts.ToFlatVector<int64_t>(), std::vector<int64_t>({2, 1, 3}));
+    EXPECT_TRUE(values.IndexGet({inverse}).AllEqual(a));
+
+    std::tie(values, inverse, counts) =
+            core::Tensor({0}, core::Float64, device).Unique();
+    EXPECT_EQ(values.GetShape(), core::SizeVector{0});
+    EXPECT_EQ(inverse.GetShape(), core::SizeVector{0});
+    EXPECT_EQ(counts.GetShape(), core::SizeVector{0});
+}
+
+TEST_P(TensorPermuteDevices, SegmentReduce) {
+    core::Device device = GetParam();
+    core::Tensor a = core::Tensor::Init<float>(
+            {{1, 2}, {3, 4}, {5, 0}, {-1, 8}, {2, 2}}, device);
+    core::Tensor row_splits =
+            core::Tensor::Init<int64_t>({0, 2, 2, 5}, device);
+    if (!device.IsCPU()) {
+        EXPECT_ANY_THROW(a.SegmentSum(row_splits));
+        return;
+    }
+    EXPECT_TRUE(a.SegmentSum(row_splits).AllClose(
+            core::Tensor::Init<float>({{4, 6}, {0, 0}, {6, 10}}, device)));
+    EXPECT_TRUE(a.SegmentMean(row_splits).AllClose(
+            core::Tensor::Init<float>({{2, 3}, {0, 0}, {2, 10.f / 3}},
+                                      device)));
+    EXPECT_TRUE(a.SegmentMin(row_splits).AllClose(
+            core::Tensor::Init<float>({{1, 2}, {0, 0}, {-1, 0}}, device)));
+    EXPECT_TRUE(a.SegmentMax(row_splits).AllClose(
+            core::Tensor::Init<float>({{3, 4}, {0, 0}, {5, 8}}, device)));
+
+    // Integer tensors support all reductions but SegmentMean.
+    EXPECT_TRUE(a.To(core::Int32)
+                        .SegmentMax(row_splits)
+                        .AllEqual(core::Tensor::Init<int32_t>(
+                                {{3, 4}, {0, 0}, {5, 8}}, device)));
+    EXPECT_ANY_THROW(a.To(core::Int32).SegmentMean(row_splits));
+
+    // row_splits must cover all rows in non-decreasing order.
+    EXPECT_ANY_THROW(
+            a.SegmentSum(core::Tensor::Init<int64_t>({0, 2, 4}, device)));
+    EXPECT_ANY_THROW(
+            a.SegmentSum(core::Tensor::Init<int64_t>({0, 3, 2, 5}, device)));
+    EXPECT_ANY_THROW(
+            a.SegmentSum(core::Tensor::Init<int32_t>({0, 2, 5}, device)));
+}
+
 TEST_P(TensorPermuteDevices, All) {
     core::Device device = GetParam();
     core::Tensor t = core::Tensor::Init<bool>(
@@ -3114,6 +3293,57 @@ TEST_P(TensorPermuteDevices, ReduceMean) {
     EXPECT_TRUE(std::isnan(dst.ToFlatVector<float>()[0]));
 }
 
+TEST_P(TensorPermuteDevices, OutputReuse) {
+    core::Device device = GetParam();
+    core::Tensor src =
+            core::Tensor::Init<float>({{0, 1, 2}, {3, 4, 5}}, device);
+
+    // Matching output is written in place.
+    core::Tensor out = core::Tensor::Empty({3}, core::Float32, device);
+    const void* out_ptr = out.GetDataPtr();
+    src.Sum({0}, false, out);
+    EXPECT_EQ(out.GetDataPtr(), out_ptr);
+    EXPECT_EQ(out.ToFlatVector<float>(), std::vector<float>({3, 5, 7}));
+    src.Mean({0}, false, out);
+    EXPECT_EQ(out.GetDataPtr(), out_ptr);
+    EXPECT_EQ(out.ToFlatVector<float>(), std::vector<float>({1.5, 2.5, 3.5}));
+    src.Max({0}, false, out);
+    EXPECT_EQ(out.GetDataPtr(), out_ptr);
+    EXPECT_EQ(out.ToFlatVector<float>(), std::vector<float>({3, 4, 5}));
+    src.IndexGet({core::Tensor::Init<int64_t>({1}, device),
+                  core::Tensor::Init<int64_t>({0, 2, 1}, device)},
+                 out);
+    EXPECT_EQ(out.GetDataPtr(), out_ptr);
+    EXPECT_EQ(out.ToFlatVector<float>(), std::vector<float>({3, 5, 4}));
+
+    // Mismatching shape, dtype or layout allocates a new output.
+    src.Sum({0}, true, out);
+    EXPECT_NE(out.GetDataPtr(), out_ptr);
+    EXPECT_EQ(out.GetShape(), core::SizeVector({1, 3}));
+    EXPECT_EQ(out.ToFlatVector<float>(), std::vector<float>({3, 5, 7}));
+    out = core::Tensor::Empty({2}, core::Float64, device);
+    out_ptr = out.GetDataPtr();
+    src.Min({1}, false, out);
+    EXPECT_NE(out.GetDataPtr(), out_ptr);
+    EXPECT_EQ(out.GetDtype(), core::Float32);
+    EXPECT_EQ(out.ToFlatVector<float>(), std::vector<float>({0, 3}));
+    out = core::Tensor::Empty({3, 2}, core::Float32, device).T();
+    out_ptr = out.GetDataPtr();
+    src.IndexGet({core::Tensor::Init<int64_t>({0, 1}, device)}, out);
+    EXPECT_NE(out.GetDataPtr(), out_ptr);
+    EXPECT_TRUE(out.IsContiguous());
+    EXPECT_TRUE(out.AllEqual(src));
+
+    // Outputs aliasing an input are not written in place.
+    core::Tensor row = src[0].Clone();
+    core::Tensor row_copy = row;
+    row.IndexGet({core::Tensor::Init<int64_t>({2, 1, 0}, device)}, row);
+    EXPECT_EQ(row.ToFlatVector<float>(), std::vector<float>({2, 1, 0}));
+    EXPECT_EQ(row_copy.ToFlatVector<float>(), std::vector<float>({0, 1, 2}));
+    EXPECT_TRUE(src[0].MayShareMemory(src[1]));
+    EXPECT_FALSE(src[0].MayShareMemory(row));
+}
+
 TEST_P(TensorPermuteDevices, ToDLPackFromDLPack) {
     core::Device device = GetParam();
     core::Tensor src_t = core::Tensor::Init<float>(
@@ -0,0 +1,213 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/TensorExpr.h"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/TensorFunction.h"
+#include "tests/Tests.h"
+#include "tests/core/CoreTest.h"
+
+namespace open3d {
+namespace tests {
+
+class TensorExprPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(TensorExpr,
+                         TensorExprPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(TensorExprPermuteDevices, Arithmetic) {
+    core::Device device = GetParam();
+
+    core::Tensor a = core::Tensor::Init<float>({{1, -2, 3}, {-4, 5, -6}},
+                                               device);
+    core::Tensor b = core::Tensor::Init<float>({{0.5, 1, 1.5}, {2, 2.5, 3}},
+                                               device);
+    core::Tensor w = core::Tensor::Init<float>({2, 3, 4}, device);
+    core::Tensor c = core::Tensor::Init<float>(0.25, device);
+
+    core::TensorExpr expr = ((a.Lazy() - b) * w + c).Abs();
+    EXPECT_EQ(expr.GetShape(), core::SizeVector({2, 3}));
+    EXPECT_EQ(expr.GetDtype(), core::Float32);
+    EXPECT_EQ(expr.GetDevice(), device);
+
+    core::Tensor fused = expr.Eval();
+    core::Tensor eager = ((a - b) * w + c).Abs();
+    EXPECT_TRUE(fused.AllEqual(eager));
+    EXPECT_TRUE(fused.IsContiguous());
+
+    fused = ((a.Lazy() / b).Maximum(w).Minimum(4.f) - 1).Sqrt().Eval();
+    eager = (core::Minimum(core::Maximum(a / b, w),
+                           core::Tensor::Full({}, 4, core::Float32, device)) -
+             1)
+                    .Sqrt();
+    EXPECT_TRUE(fused.AllEqual(eager));
+
+    fused = (2 - a.Lazy() * 3 + 1 / b).Neg().Floor().Eval();
+    eager = (core::Tensor::Full({}, 2, core::Float32, device) - a * 3 +
+             core::Tensor::Full({}, 1, core::Float32, device) / b)
+                    .Neg()
+                    .Floor();
+    EXPECT_TRUE(fused.AllEqual(eager));
+
+    fused = (a.Lazy().Sin() * a.Lazy().Cos() + b.Lazy().Exp()).Eval();
+    eager = a.Sin() * a.Cos() + b.Exp();
+    EXPECT_TRUE(fused.AllEqual(eager));
+}
+
+TEST_P(TensorExprPermuteDevices, Dtypes) {
+    core::Device device = GetParam();
+
+    for (core::Dtype dtype : {core::Int8, core::UInt8, core::Int16,
+                              core::UInt16, core::Int32, core::UInt32,
+                              core::Int64, core::UInt64, core::Float64}) {
+        core::Tensor a =
+                core::Tensor::Init<int>({7, 20, 33, 46}, device).To(dtype);
+        core::Tensor b =
+                core::Tensor::Init<int>({2, 3, 4, 5}, device).To(dtype);
+
+        core::Tensor fused =
+                ((a.Lazy() + b) * 2 / b - 1).Maximum(b).Abs().Eval();
+        core::Tensor eager = core::Maximum((a + b) * 2 / b - 1, b).Abs();
+        EXPECT_EQ(fused.GetDtype(), dtype);
+        EXPECT_TRUE(fused.AllEqual(eager));
+    }
+}
+
+TEST_P(TensorExprPermuteDevices, Broadcast) {
+    core::Device device = GetParam();
+
+    core::Tensor a = core::Tensor::Init<double>({{1}, {2}, {3}}, device);
+    core::Tensor b = core::Tensor::Init<double>({10, 20, 30, 40}, device);
+    core::Tensor c = core::Tensor::Ones({2, 1, 1}, core::Float64, device);
+
+    core::TensorExpr expr = a.Lazy() * b + c;
+    EXPECT_EQ(expr.GetShape(), core::SizeVector({2, 3, 4}));
+    EXPECT_TRUE(expr.Eval().AllEqual(a * b + c));
+
+    // Non-contiguous inputs.
+    core::Tensor t = core::Tensor::Init<double>({{1, 2, 3}, {4, 5, 6}}, device)
+                             .T();
+    EXPECT_TRUE((t.Lazy() * t + t).Eval().AllEqual(t * t + t));
+
+    EXPECT_THROW(b.Lazy() + core::Tensor::Ones({3}, core::Float64, device),
+                 std::runtime_error);
+}
+
+TEST_P(TensorExprPermuteDevices, Boolean) {
+    core::Device device = GetParam();
+
+    core::Tensor a = core::Tensor::Init<float>({1, 2, 3, 4, 5}, device);
+    core::Tensor b = core::Tensor::Init<float>({5, 4, 3, 2, 1}, device);
+    core::Tensor mask =
+            core::Tensor::Init<bool>({true, false, true, false, true}, device);
+
+    core::TensorExpr gt = a.Lazy().Gt(b);
+    EXPECT_EQ(gt.GetDtype(), core::Bool);
+    EXPECT_TRUE(gt.Eval().AllEqual(a.Gt(b)));
+
+    core::Tensor fused =
+            (a.Lazy().Ge(b).LogicalOr(mask).LogicalAnd(a.Lazy().Ne(4.f)))
+                    .LogicalXor(a.Lazy().Le(b).LogicalNot())
+                    .Eval();
+    core::Tensor eager = (a.Ge(b).LogicalOr(mask).LogicalAnd(a.Ne(4.f)))
+                                 .LogicalXor(a.Le(b).LogicalNot());
+    EXPECT_TRUE(fused.AllEqual(eager));
+
+    fused = mask.Lazy().LogicalAnd(true).Eq(a.Lazy().Lt(3.f)).Eval();
+    eager = mask.LogicalAnd(true).Eq(a.Lt(3.f));
+    EXPECT_TRUE(fused.AllEqual(eager));
+
+    // Float values are converted to bool by LogicalNot.
+    fused = (a.Lazy() - 3).LogicalNot().Eval();
+    EXPECT_TRUE(fused.AllEqual((a - 3).LogicalNot()));
+
+    core::Tensor f = core::Tensor::Init<float>(
+            {1, std::numeric_limits<float>::quiet_NaN(),
+             std::numeric_limits<float>::infinity()},
+            device);
+    EXPECT_TRUE(f.Lazy().IsNan().Eval().AllEqual(f.IsNan()));
+    EXPECT_TRUE(f.Lazy().IsInf().Eval().AllEqual(f.IsInf()));
+    EXPECT_TRUE(f.Lazy().IsFinite().Eval().AllEqual(f.IsFinite()));
+
+    core::Tensor i = core::Tensor::Init<int>({1, 2, 3}, device);
+    EXPECT_TRUE(i.Lazy().IsNan().Eval().AllEqual(i.IsNan()));
+    EXPECT_TRUE(i.Lazy().IsInf().Eval().AllEqual(i.IsInf()));
+    EXPECT_TRUE(i.Lazy().IsFinite().Eval().AllEqual(i.IsFinite()));
+}
+
+TEST_P(TensorExprPermuteDevices, SharedSubexpression) {
+    core::Device device = GetParam();
+
+    core::Tensor a = core::Tensor::Init<float>({1, 2, 3}, device);
+    core::TensorExpr sq = a.Lazy() * a;
+    core::Tensor fused = (sq + sq * sq).Eval();
+    EXPECT_TRUE(fused.AllEqual(a * a + (a * a) * (a * a)));
+
+    // A leaf evaluates to the leaf tensor itself.
+    core::Tensor leaf = a.Lazy().Eval();
+    EXPECT_EQ(leaf.GetDataPtr(), a.GetDataPtr());
+}
+
+TEST_P(TensorExprPermuteDevices, Fallback) {
+    core::Device device = GetParam();
+
+    // More leaves than the Indexer supports.
+    std::vector<core::Tensor> tensors;
+    core::TensorExpr sum = core::Tensor::Zeros({4}, core::Float32, device);
+    core::Tensor expected = core::Tensor::Zeros({4}, core::Float32, device);
+    for (int i = 0; i < 12; ++i) {
+        tensors.push_back(core::Tensor::Full({4}, i, core::Float32, device));
+        sum = sum + tensors.back();
+        expected = expected + tensors.back();
+    }
+    EXPECT_TRUE(sum.Eval().AllEqual(expected));
+
+    // Leaves with several non-boolean dtypes.
+    core::Tensor a = core::Tensor::Init<float>({1, 2, 3}, device);
+    core::Tensor b = core::Tensor::Init<int>({3, 2, 1}, device);
+    core::Tensor fused = a.Lazy().Gt(2.f).LogicalAnd(b.Lazy().Gt(0)).Eval();
+    EXPECT_TRUE(fused.AllEqual(a.Gt(2.f).LogicalAnd(b.Gt(0))));
+}
+
+TEST_P(TensorExprPermuteDevices, Large) {
+    core::Device device = GetParam();
+
+    // Spans several tasks and a partial block.
+    const int64_t n = 100000 + 7;
+    core::Tensor a = core::Tensor::Arange(0, n, 1, core::Float32, device);
+    core::Tensor b = core::Tensor::Full({n}, 0.5, core::Float32, device);
+    core::Tensor fused = ((a.Lazy() - b) * 2.f).Round().Eval();
+    EXPECT_TRUE(fused.AllEqual(((a - b) * 2.f).Round()));
+
+    // Strided output layout of the inputs.
+    core::Tensor m = a.Slice(0, 0, 100000).Reshape({400, 250}).T();
+    EXPECT_TRUE((m.Lazy() + m.Lazy().Trunc()).Eval().AllEqual(m + m.Trunc()));
+}
+
+TEST_P(TensorExprPermuteDevices, Errors) {
+    core::Device device = GetParam();
+
+    core::Tensor f = core::Tensor::Ones({3}, core::Float32, device);
+    core::Tensor d = core::Tensor::Ones({3}, core::Float64, device);
+    core::Tensor i = core::Tensor::Ones({3}, core::Int32, device);
+    core::Tensor m = core::Tensor::Ones({3}, core::Bool, device);
+
+    EXPECT_THROW(f.Lazy() + d, std::runtime_error);
+    EXPECT_THROW(f.Lazy().Gt(d), std::runtime_error);
+    EXPECT_THROW(i.Lazy().Sqrt(), std::runtime_error);
+    EXPECT_THROW(m.Lazy() + m, std::runtime_error);
+    EXPECT_THROW(m.Lazy().Neg(), std::runtime_error);
+    EXPECT_THROW(f.Lazy() * f.Lazy().Gt(0.f), std::runtime_error);
+}
+
+}  // namespace tests
+}  // namespace open3d
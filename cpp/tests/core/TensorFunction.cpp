@@ -111,6 +111,37 @@ TEST_P(TensorFunctionPermuteDevices, Concatenate) {
     }
 }
 
+TEST_P(TensorFunctionPermuteDevices, ConcatenateOutput) {
+    core::Device device = GetParam();
+
+    core::Tensor a = core::Tensor::Init<float>({{0, 1}, {2, 3}}, device);
+    core::Tensor b = core::Tensor::Init<float>({{4, 5}}, device);
+
+    core::Tensor out = core::Tensor::Empty({3, 2}, core::Float32, device);
+    const void* out_ptr = out.GetDataPtr();
+    core::Concatenate({a, b}, 0, out);
+    EXPECT_EQ(out.GetDataPtr(), out_ptr);
+    EXPECT_TRUE(out.AllClose(core::Concatenate({a, b}, 0)));
+
+    // Mismatching shape allocates a new output.
+    core::Concatenate({a, b}, utility::nullopt, out);
+    EXPECT_NE(out.GetDataPtr(), out_ptr);
+    EXPECT_EQ(out.ToFlatVector<float>(),
+              std::vector<float>({0, 1, 2, 3, 4, 5}));
+    out_ptr = out.GetDataPtr();
+    core::Concatenate({b, a}, utility::nullopt, out);
+    EXPECT_EQ(out.GetDataPtr(), out_ptr);
+    EXPECT_EQ(out.ToFlatVector<float>(),
+              std::vector<float>({4, 5, 0, 1, 2, 3}));
+
+    // Outputs aliasing an input are not written in place.
+    core::Tensor c = core::Tensor::Init<float>({0, 1, 2, 3}, device);
+    core::Tensor c_copy = c;
+    core::Concatenate({c.Slice(0, 2, 4), c.Slice(0, 0, 2)}, 0, c);
+    EXPECT_EQ(c.ToFlatVector<float>(), std::vector<float>({2, 3, 0, 1}));
+    EXPECT_EQ(c_copy.ToFlatVector<float>(), std::vector<float>({0, 1, 2, 3}));
+}
+
 TEST_P(TensorFunctionPermuteDevices, Append) {
     core::Device device = GetParam();
 
@@ -7,8 +7,11 @@
 
 #include "open3d/geometry/KDTreeFlann.h"
 
+#include <fstream>
+
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
+#include "open3d/utility/FileSystem.h"
 #include "tests/Tests.h"
 
 namespace open3d {
@@ -125,5 +128,56 @@ TEST(KDTreeFlann, SearchHybrid) {
     ExpectEQ(ref_distance2, distance2);
 }
 
+TEST(KDTreeFlann, SaveLoadIndex) {
+    geometry::PointCloud pc;
+    pc.points_.resize(1000);
+    Rand(pc.points_, Eigen::Vector3d(0.0, 0.0, 0.0),
+         Eigen::Vector3d(10.0, 10.0, 10.0), 0);
+    geometry::KDTreeFlann kdtree(pc);
+
+    const std::string file_name =
+            utility::filesystem::GetTempDirectoryPath() + "/kdtree.bin";
+    EXPECT_TRUE(kdtree.SaveIndex(file_name));
+    // The loaded tree does not refer to the point cloud.
+    pc.points_.clear();
+    geometry::KDTreeFlann loaded_kdtree;
+    EXPECT_TRUE(loaded_kdtree.LoadIndex(file_name));
+
+    std::vector<Eigen::Vector3d> queries(20);
+    Rand(queries, Eigen::Vector3d(0.0, 0.0, 0.0),
+         Eigen::Vector3d(10.0, 10.0, 10.0), 1);
+    for (const Eigen::Vector3d &query : queries) {
+        std::vector<int> indices, loaded_indices;
+        std::vector<double> distance2, loaded_distance2;
+        EXPECT_EQ(kdtree.SearchKNN(query, 10, indices, distance2), 10);
+        EXPECT_EQ(loaded_kdtree.SearchKNN(query, 10, loaded_indices,
+                                          loaded_distance2),
+                  10);
+        ExpectEQ(indices, loaded_indices);
+        ExpectEQ(distance2, loaded_distance2);
+
+        kdtree.SearchRadius(query, 1.5, indices, distance2);
+        loaded_kdtree.SearchRadius(query, 1.5, loaded_indices,
+                                   loaded_distance2);
+        ExpectEQ(indices, loaded_indices);
+        ExpectEQ(distance2, loaded_distance2);
+    }
+
+    // A stale header with fewer points than the saved tree refers to. The
+    // number of points is at byte 24 of the header, see KdTreeFileHeader.
+    {
+        std::fstream file(file_name,
+                          std::ios::in | std::ios::out | std::ios::binary);
+        const uint64_t num_points = 500;
+        file.seekp(24);
+        file.write(reinterpret_cast<const char *>(&num_points),
+                   sizeof(num_points));
+    }
+    EXPECT_ANY_THROW(loaded_kdtree.LoadIndex(file_name));
+
+    EXPECT_FALSE(loaded_kdtree.LoadIndex(file_name + ".missing"));
+    utility::filesystem::RemoveFile(file_name);
+}
+
 }  // namespace tests
 }  // namespace open3d
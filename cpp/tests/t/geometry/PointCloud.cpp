@@ -276,6 +276,45 @@ TEST_P(PointCloudPermuteDevices, NormalizeNormals) {
                                        device)));
 }
 
+TEST_P(PointCloudPermuteDevices, HalfPrecisionAttributes) {
+    core::Device device = GetParam();
+
+    // Half precision attributes are computed in float and keep their dtype.
+    t::geometry::PointCloud pcd(core::Tensor::Init<float>(
+            {{0, 0, 0}, {0.1, 0, 0}, {2, 2, 2}}, device));
+    pcd.SetPointNormals(core::Tensor::Init<float>(
+                                {{2, 0, 0}, {0, 2, 0}, {1, 1, 1}}, device)
+                                .To(core::Float16));
+    pcd.SetPointColors(core::Tensor::Init<float>(
+                               {{0, 0.5, 1}, {1, 0.5, 0}, {0.25, 0.25, 0.25}},
+                               device)
+                               .To(core::BFloat16));
+
+    pcd.NormalizeNormals();
+    EXPECT_EQ(pcd.GetPointNormals().GetDtype(), core::Float16);
+    EXPECT_TRUE(pcd.GetPointNormals().To(core::Float32).AllClose(
+            core::Tensor::Init<float>({{1, 0, 0},
+                                       {0, 1, 0},
+                                       {0.57735, 0.57735, 0.57735}},
+                                      device),
+            1e-3, 1e-3));
+
+    core::Tensor rotation = core::Tensor::Init<float>(
+            {{0, -1, 0}, {1, 0, 0}, {0, 0, 1}}, device);
+    pcd.Rotate(rotation, core::Tensor::Zeros({3}, core::Float32, device));
+    EXPECT_EQ(pcd.GetPointNormals().GetDtype(), core::Float16);
+    EXPECT_TRUE(pcd.GetPointNormals().To(core::Float32).AllClose(
+            core::Tensor::Init<float>({{0, 1, 0},
+                                       {-1, 0, 0},
+                                       {-0.57735, 0.57735, 0.57735}},
+                                      device),
+            1e-3, 1e-3));
+
+    t::geometry::PointCloud pcd_down = pcd.VoxelDownSample(1.0);
+    EXPECT_EQ(pcd_down.GetPointColors().GetDtype(), core::BFloat16);
+    EXPECT_EQ(pcd_down.GetPointColors().GetLength(), 2);
+}
+
 TEST_P(PointCloudPermuteDevices, EstimateNormals) {
     core::Device device = GetParam();
 
@@ -7,6 +7,9 @@
 
 #include "open3d/t/geometry/VoxelBlockGrid.h"
 
+#include <atomic>
+#include <thread>
+
 #include "core/CoreTest.h"
 #include "open3d/core/EigenConverter.h"
 #include "open3d/core/Tensor.h"
@@ -67,6 +70,7 @@ static std::vector<core::HashBackendType> EnumerateBackends(
         backends.push_back(core::HashBackendType::StdGPU);
     } else {
         backends.push_back(core::HashBackendType::TBB);
+        backends.push_back(core::HashBackendType::OpenAddressing);
     }
     return backends;
 }
@@ -80,8 +84,11 @@ static VoxelBlockGrid Integrate(const core::HashBackendType &backend,
     const float depth_scale = 1000.0;
     const float depth_max = 3.0;
 
+    // Half precision storage applies to all the values.
+    const core::Dtype tsdf_dtype =
+            dtype == core::Float16 ? core::Float16 : core::Float32;
     auto vbg = VoxelBlockGrid({"tsdf", "weight", "color"},
-                              {core::Float32, dtype, dtype}, {{1}, {1}, {3}},
+                              {tsdf_dtype, dtype, dtype}, {{1}, {1}, {3}},
                               3.0 / 512, resolution, 10000, device, backend);
 
     data::SampleRedwoodRGBDImages redwood_data;
@@ -296,8 +303,8 @@ TEST_P(VoxelBlockGridPermuteDevices, RayCasting) {
     const float depth_max = 3.0;
 
     for (auto backend : backends) {
-        for (auto &dtype :
-             std::vector<core::Dtype>{core::Float32, core::UInt16}) {
+        for (auto &dtype : std::vector<core::Dtype>{
+                     core::Float32, core::UInt16, core::Float16}) {
             auto vbg = Integrate(backend, dtype, device,
                                  /* block_resolution = */ 8);
 
@@ -344,6 +351,69 @@ TEST_P(VoxelBlockGridPermuteDevices, RayCasting) {
     }
 }
 
+TEST(VoxelBlockGrid, RayCastingSnapshotConcurrentIntegrate) {
+    const core::Device device("CPU:0");
+    core::Tensor intrinsic = GetIntrinsicTensor();
+    std::vector<core::Tensor> extrinsics = GetExtrinsicTensors();
+    const float depth_scale = 1000.0;
+    const float depth_min = 0.1;
+    const float depth_max = 3.0;
+
+    // A small initial capacity, so that the concurrent integration grows the
+    // hash map.
+    auto vbg = VoxelBlockGrid({"tsdf", "weight", "color"},
+                              {core::Float32, core::Float32, core::Float32},
+                              {{1}, {1}, {3}}, 3.0 / 512, 8, 1000, device,
+                              core::HashBackendType::OpenAddressing);
+
+    data::SampleRedwoodRGBDImages redwood_data;
+    Image depth = *t::io::CreateImageFromFile(redwood_data.GetDepthPaths()[0]);
+    Image color = *t::io::CreateImageFromFile(redwood_data.GetColorPaths()[0]);
+    core::Tensor frustum_block_coords = vbg.GetUniqueBlockCoordinates(
+            depth, intrinsic, extrinsics[0], depth_scale, depth_max);
+    vbg.Integrate(frustum_block_coords, depth, color, intrinsic, extrinsics[0],
+                  depth_scale, depth_max);
+
+    const std::vector<std::string> attrs = {"depth", "vertex", "color"};
+    TensorMap expected =
+            vbg.RayCast(frustum_block_coords, intrinsic, extrinsics[0],
+                        depth.GetCols(), depth.GetRows(), attrs, depth_scale,
+                        depth_min, depth_max, 1.0);
+    core::HashMap snapshot = vbg.GetHashMap().GetSnapshot();
+
+    // The writer integrates the frame again with the camera moved away, which
+    // only inserts and updates blocks that are not in the snapshot's frustum.
+    std::atomic<bool> done(false);
+    std::thread writer([&]() {
+        for (int k = 1; k <= 4; ++k) {
+            core::Tensor extrinsic = extrinsics[0].Clone();
+            extrinsic[0][3] = extrinsic[0][3].Item<double>() + 10.0 * k;
+            core::Tensor block_coords = vbg.GetUniqueBlockCoordinates(
+                    depth, intrinsic, extrinsic, depth_scale, depth_max);
+            vbg.Integrate(block_coords, depth, color, intrinsic, extrinsic,
+                          depth_scale, depth_max);
+        }
+        done.store(true);
+    });
+
+    int num_ray_casts = 0;
+    do {
+        TensorMap result = vbg.RayCast(
+                snapshot, frustum_block_coords, intrinsic, extrinsics[0],
+                depth.GetCols(), depth.GetRows(), attrs, depth_scale,
+                depth_min, depth_max, 1.0);
+        for (const auto &attr : attrs) {
+            EXPECT_TRUE(result[attr].AllClose(expected[attr]));
+        }
+        num_ray_casts++;
+    } while (!done.load());
+    writer.join();
+
+    EXPECT_GT(num_ray_casts, 0);
+    EXPECT_GT(vbg.GetHashMap().GetCapacity(), 1000);
+    EXPECT_EQ(snapshot.Size(), frustum_block_coords.GetLength());
+}
+
 TEST_P(VoxelBlockGridPermuteDevices, DISABLED_RayCastingVisualize) {
     core::Device device = GetParam();
     std::vector<core::HashBackendType> backends =
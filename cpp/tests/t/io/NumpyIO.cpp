@@ -52,6 +52,14 @@ TEST_P(NumpyIOPermuteDevices, NpyWriteRead) {
     EXPECT_EQ(t_load.ToFlatVector<float>(),
               std::vector<float>({0, 2, 8, 10, 12, 14, 20, 22}));
 
+    // Half precision tensor.
+    t = core::Tensor::Init<float>({{1.5, -2}, {0.1, 65504}}, device)
+                .To(core::Float16);
+    t.Save(file_name);
+    t_load = core::Tensor::Load(file_name);
+    EXPECT_EQ(t_load.GetDtype(), core::Float16);
+    EXPECT_TRUE(t.AllEqual(t_load.To(device)));
+
     // {} tensor (scalar).
     t = core::Tensor::Init<float>(3.14, device);
     t.Save(file_name);
@@ -157,5 +165,53 @@ TEST_P(NumpyIOPermuteDevices, NpzWriteRead) {
     utility::filesystem::RemoveFile(file_name);
 }
 
+TEST_P(NumpyIOPermuteDevices, NpyMemoryMap) {
+    const core::Device device = GetParam();
+    const std::string file_name = "tensor_mmap.npy";
+
+    core::Tensor t = core::Tensor::Init<float>({{1, 2}, {3, 4}}, device);
+    t.Save(file_name);
+    {
+        core::Tensor t_load = t::io::ReadNpy(file_name, /*memory_map=*/true);
+        EXPECT_TRUE(t.AllClose(t_load.To(device)));
+
+        // Writes go to private pages and do not change the file.
+        t_load.Fill(0);
+        EXPECT_EQ(t_load.ToFlatVector<float>(), std::vector<float>(4, 0));
+    }
+    EXPECT_TRUE(t.AllClose(t::io::ReadNpy(file_name).To(device)));
+
+    // {0} tensor.
+    t = core::Tensor::Ones({0}, core::Float32, device);
+    t.Save(file_name);
+    core::Tensor t_load = t::io::ReadNpy(file_name, /*memory_map=*/true);
+    EXPECT_TRUE(t.AllClose(t_load.To(device)));
+
+    // Clean up.
+    utility::filesystem::RemoveFile(file_name);
+}
+
+TEST_P(NumpyIOPermuteDevices, NpzMemoryMap) {
+    const core::Device device = GetParam();
+    const std::string file_name = "tensors_mmap.npz";
+
+    core::Tensor t0 = core::Tensor::Init<int32_t>({{1, 2}, {3, 4}}, device);
+    core::Tensor t1 = core::Tensor::Init<double>({5, 6, 7}, device);
+    core::Tensor t2 = core::Tensor::Init<uint8_t>({8, 9}, device);
+    t::io::WriteNpz(file_name, {{"t0", t0}, {"t1", t1}, {"t2", t2}});
+
+    std::unordered_map<std::string, core::Tensor> tensor_map =
+            t::io::ReadNpz(file_name, /*memory_map=*/true);
+    EXPECT_EQ(tensor_map.size(), 3);
+    EXPECT_TRUE(t0.AllClose(tensor_map.at("t0").To(device)));
+    EXPECT_TRUE(t1.AllClose(tensor_map.at("t1").To(device)));
+    EXPECT_TRUE(t2.AllClose(tensor_map.at("t2").To(device)));
+    EXPECT_EQ(tensor_map.at("t1").GetDtype(), core::Float64);
+
+    // Clean up.
+    tensor_map.clear();
+    utility::filesystem::RemoveFile(file_name);
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -106,5 +106,37 @@ TEST_P(FeaturePermuteDevices, CorrespondencesFromFeatures) {
     }
 }
 
+TEST(Feature, CorrespondencesFromEmptyFeatures) {
+    pipelines::registration::Feature features, empty_features;
+    features.Resize(33, 10);
+    features.data_.setRandom();
+    empty_features.Resize(33, 0);
+    core::Tensor t_features = core::Tensor::Ones({10, 33}, core::Float32);
+    core::Tensor t_empty_features = core::Tensor::Ones({0, 33}, core::Float32);
+
+    for (int approximate_ef_search : {0, 16}) {
+        for (bool mutual_filter : {true, false}) {
+            EXPECT_TRUE(pipelines::registration::CorrespondencesFromFeatures(
+                                features, empty_features, mutual_filter,
+                                0.1f, approximate_ef_search)
+                                .empty());
+            EXPECT_TRUE(pipelines::registration::CorrespondencesFromFeatures(
+                                empty_features, features, mutual_filter,
+                                0.1f, approximate_ef_search)
+                                .empty());
+            EXPECT_EQ(t::pipelines::registration::CorrespondencesFromFeatures(
+                              t_features, t_empty_features, mutual_filter,
+                              0.1f, approximate_ef_search)
+                              .GetShape(),
+                      core::SizeVector({0, 2}));
+            EXPECT_EQ(t::pipelines::registration::CorrespondencesFromFeatures(
+                              t_empty_features, t_features, mutual_filter,
+                              0.1f, approximate_ef_search)
+                              .GetShape(),
+                      core::SizeVector({0, 2}));
+        }
+    }
+}
+
 }  // namespace tests
 }  // namespace open3d
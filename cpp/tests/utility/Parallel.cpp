@@ -0,0 +1,122 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include "open3d/utility/Parallel.h"
+
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(Parallel, ParallelForRange) {
+    const int64_t n = 100000;
+    std::vector<int> counts(n, 0);
+    std::atomic<int64_t> total(0);
+    utility::ParallelForRange(10, n, 16, [&](int64_t begin, int64_t end) {
+        EXPECT_LT(begin, end);
+        EXPECT_TRUE(utility::InParallel() || end - begin == n - 10);
+        for (int64_t i = begin; i < end; ++i) {
+            counts[i]++;
+        }
+        total += end - begin;
+    });
+    EXPECT_EQ(total.load(), n - 10);
+    EXPECT_EQ(std::accumulate(counts.begin(), counts.begin() + 10, 0), 0);
+    for (int64_t i = 10; i < n; ++i) {
+        ASSERT_EQ(counts[i], 1);
+    }
+    EXPECT_FALSE(utility::InParallel());
+
+    // Empty ranges.
+    utility::ParallelForRange(5, 5, 1, [](int64_t, int64_t) { FAIL(); });
+    utility::ParallelForRange(5, 2, 1, [](int64_t, int64_t) { FAIL(); });
+}
+
+TEST(Parallel, ParallelForRangeNested) {
+    const int64_t n = 64;
+    const int64_t m = 1000;
+    std::vector<int64_t> sums(n, 0);
+    utility::ParallelForRange(0, n, 1, [&](int64_t begin, int64_t end) {
+        for (int64_t i = begin; i < end; ++i) {
+            std::atomic<int64_t> sum(0);
+            utility::ParallelForRange(0, m, 1, [&](int64_t b, int64_t e) {
+                for (int64_t j = b; j < e; ++j) {
+                    sum += i * j;
+                }
+            });
+            sums[i] = sum.load();
+        }
+    });
+    for (int64_t i = 0; i < n; ++i) {
+        EXPECT_EQ(sums[i], i * m * (m - 1) / 2);
+    }
+}
+
+TEST(Parallel, ParallelForRangeException) {
+    EXPECT_THROW(utility::ParallelForRange(0, 1000, 1,
+                                           [](int64_t begin, int64_t end) {
+                                               if (begin <= 500 && 500 < end) {
+                                                   throw std::runtime_error(
+                                                           "error");
+                                               }
+                                           }),
+                 std::runtime_error);
+}
+
+TEST(Parallel, MaxConcurrency) {
+    const int default_concurrency = utility::GetMaxConcurrency();
+    EXPECT_GE(default_concurrency, 1);
+    EXPECT_EQ(utility::EstimateMaxThreads(), default_concurrency);
+
+    // With a limit of one thread, the whole range is processed at once.
+    utility::SetMaxConcurrency(1);
+    EXPECT_EQ(utility::GetMaxConcurrency(), 1);
+    EXPECT_EQ(utility::EstimateMaxThreads(), 1);
+    int num_calls = 0;
+    utility::ParallelForRange(0, 1000, 1,
+                              [&](int64_t, int64_t) { num_calls++; });
+    EXPECT_EQ(num_calls, 1);
+
+    utility::SetMaxConcurrency(0);
+    EXPECT_EQ(utility::GetMaxConcurrency(), default_concurrency);
+}
+
+TEST(Parallel, TaskGroup) {
+    const int num_tasks = 16;
+    const int64_t n = 10000;
+    std::vector<std::vector<int64_t>> results(num_tasks);
+    utility::TaskGroup group;
+    for (int t = 0; t < num_tasks; ++t) {
+        group.Run([&results, t, n]() {
+            EXPECT_TRUE(utility::InParallel());
+            results[t].resize(n);
+            utility::ParallelForRange(0, n, 1, [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; ++i) {
+                    results[t][i] = i * t;
+                }
+            });
+        });
+    }
+    group.Wait();
+    for (int t = 0; t < num_tasks; ++t) {
+        ASSERT_EQ(static_cast<int64_t>(results[t].size()), n);
+        for (int64_t i = 0; i < n; ++i) {
+            ASSERT_EQ(results[t][i], i * t);
+        }
+    }
+
+    group.Run([]() { throw std::runtime_error("error"); });
+    EXPECT_THROW(group.Wait(), std::runtime_error);
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,104 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// Copyright (c) 2018-2023 www.open3d.org
+// SPDX-License-Identifier: MIT
+// ----------------------------------------------------------------------------
+
+#include "open3d/utility/Profiler.h"
+
+#include <thread>
+
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(Profiler, NestedScopes) {
+    utility::Profiler& profiler = utility::Profiler::GetInstance();
+    profiler.Reset();
+
+    // Nothing is recorded while the profiler is disabled.
+    { utility::ProfilerScope scope("Disabled"); }
+    EXPECT_TRUE(profiler.GetEvents().empty());
+
+    profiler.SetEnabled(true);
+    {
+        utility::ProfilerScope outer("Outer");
+        utility::Profiler::CountAllocation(100);
+        for (int i = 0; i < 2; ++i) {
+            utility::ProfilerScope inner("Inner");
+            utility::Profiler::CountAllocation(10);
+        }
+    }
+    profiler.SetEnabled(false);
+
+    const std::vector<utility::Profiler::Event> events = profiler.GetEvents();
+    ASSERT_EQ(events.size(), 3u);
+    EXPECT_STREQ(events[0].name_, "Outer");
+    EXPECT_EQ(events[0].depth_, 0);
+    EXPECT_EQ(events[0].allocated_bytes_, 120);
+    EXPECT_EQ(events[0].num_allocations_, 3);
+    for (int i = 1; i < 3; ++i) {
+        EXPECT_STREQ(events[i].name_, "Inner");
+        EXPECT_EQ(events[i].depth_, 1);
+        EXPECT_EQ(events[i].thread_id_, events[0].thread_id_);
+        EXPECT_EQ(events[i].allocated_bytes_, 10);
+        EXPECT_GE(events[i].start_ns_, events[0].start_ns_);
+        EXPECT_LE(events[i].start_ns_ + events[i].duration_ns_,
+                  events[0].start_ns_ + events[0].duration_ns_);
+    }
+
+    // Inner is listed once, indented under Outer, with both calls.
+    const std::string summary = profiler.GetSummary();
+    EXPECT_NE(summary.find("\nOuter "), std::string::npos);
+    EXPECT_NE(summary.find("\n  Inner "), std::string::npos);
+    EXPECT_EQ(summary.find("Inner", summary.find("\n  Inner ") + 8),
+              std::string::npos);
+
+    profiler.Reset();
+    EXPECT_TRUE(profiler.GetEvents().empty());
+}
+
+TEST(Profiler, Threads) {
+    utility::Profiler& profiler = utility::Profiler::GetInstance();
+    profiler.Reset();
+    profiler.SetEnabled(true);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([]() { utility::ProfilerScope scope("Worker"); });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    profiler.SetEnabled(false);
+
+    // Events of exited threads are kept.
+    const std::vector<utility::Profiler::Event> events = profiler.GetEvents();
+    ASSERT_EQ(events.size(), 4u);
+    for (size_t i = 1; i < events.size(); ++i) {
+        EXPECT_LT(events[i - 1].thread_id_, events[i].thread_id_);
+        EXPECT_EQ(events[i].depth_, 0);
+    }
+    profiler.Reset();
+}
+
+TEST(Profiler, ChromeTrace) {
+    utility::Profiler& profiler = utility::Profiler::GetInstance();
+    profiler.Reset();
+    profiler.SetEnabled(true);
+    { utility::ProfilerScope scope("Quoted \"name\""); }
+    profiler.SetEnabled(false);
+
+    const std::string trace = profiler.ToChromeTrace();
+    EXPECT_EQ(trace.find("{\"traceEvents\":["), 0u);
+    EXPECT_NE(trace.find("\"name\":\"Quoted \\\"name\\\"\""),
+              std::string::npos);
+    EXPECT_NE(trace.find("\"ph\":\"X\""), std::string::npos);
+    EXPECT_NE(trace.find("\"allocated_bytes\":0"), std::string::npos);
+    EXPECT_FALSE(profiler.WriteChromeTrace("/non/existent/dir/trace.json"));
+    profiler.Reset();
+}
+
+}  // namespace tests
+}  // namespace open3d